@@ -0,0 +1,37 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_GUI_BUILDER_BATCH_MODE_HPP
+#define TGUI_GUI_BUILDER_BATCH_MODE_HPP
+
+#include <string>
+#include <vector>
+
+// Validates forms without opening a window, for use from scripts and continuous integration.
+// The arguments are the command line arguments that followed "--batch". Returns the exit code of the program.
+int runBatchMode(const std::vector<std::string>& arguments);
+
+#endif // TGUI_GUI_BUILDER_BATCH_MODE_HPP
@@ -46,6 +46,8 @@ public:
     bool setSelectedWidgetName(const std::string& name);
     void setSelectedWidgetRenderer(const std::string& renderer);
     void updateSelectionSquarePositions();
+    void requestSelectionSquareUpdate();
+    void applyPendingSelectionSquareUpdate();
     void selectWidgetById(const std::string& id);
     void selectWidgetByName(const std::string& name);
     void selectParent();
@@ -85,6 +87,7 @@ private:
     std::map<std::string, std::shared_ptr<WidgetInfo>> m_widgets;
     bool m_changed = false;
     bool m_draggingWidget = false;
+    bool m_selectionSquaresUpdatePending = false;
     tgui::Button::Ptr m_draggingSelectionSquare;
     sf::Vector2f m_draggingPos;
     sf::String m_filename;
@@ -38,7 +38,8 @@ public:
     ~GuiBuilder();
     void mainLoop();
 
-    void reloadProperties();
+    void reloadProperties(const std::string& changedProperty = "");
+    void requestPropertiesReload();
     void widgetSelected(tgui::Widget::Ptr widget);
     void formSaved(const sf::String& filename);
     void closeForm(Form* form);
@@ -79,7 +80,9 @@ private:
     void copyWidgetToInternalClipboard(std::shared_ptr<WidgetInfo> widgetInfo);
     void pasteWidgetFromInternalClipboard();
 
+    void applyPendingUpdates();
     void widgetHierarchyChanged();
+    void rebuildWidgetHierarchy();
     void updateSelectedWidgetHierarchy();
     void fillWidgetHierarchyTreeRecursively(std::vector<sf::String>& hierarchy, std::shared_ptr<tgui::Widget> parentWidget);
     bool fillWidgetHierarchy(std::vector<sf::String>& hierarchy, tgui::Widget* widget);
@@ -132,6 +135,11 @@ private:
     std::map<std::string, std::unique_ptr<WidgetProperties>> m_widgetProperties;
     PropertyValueMapPair m_propertyValuePairs;
 
+    // Updates that are postponed until the next frame, as they could otherwise happen many times per frame
+    bool m_propertiesReloadPending = false;
+    bool m_widgetHierarchyRebuildPending = false;
+    bool m_selectedWidgetHierarchyUpdatePending = false;
+
     std::vector<CopiedWidget> m_copiedWidgets;
 
     std::map<std::string, tgui::Theme> m_themes;
@@ -0,0 +1,330 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "BatchMode.hpp"
+#include <TGUI/TGUI.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <thread>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    enum class SaveMode
+    {
+        None,   // Only validate the forms
+        Check,  // Report forms that aren't stored in the format in which the gui builder would save them
+        Resave  // Overwrite forms that aren't stored in the format in which the gui builder would save them
+    };
+
+    struct FormReport
+    {
+        std::string filename;
+        std::string contents;
+        std::unique_ptr<tgui::DataIO::Node> rootNode;
+        std::vector<std::string> errors;
+        std::vector<std::string> warnings;
+        std::size_t widgetCount = 0;
+        sf::Time parseTime;
+        sf::Time loadTime;
+        bool canonical = true;
+        bool resaved = false;
+    };
+
+    void printUsage()
+    {
+        std::cout << "Usage: gui-builder --batch [options] form1.txt form2.txt ...\n"
+                     "\n"
+                     "Loads the forms without opening a window and reports the load time and widget count of each form.\n"
+                     "\n"
+                     "Options:\n"
+                     "  --theme <file>  Warn about widgets for which the theme doesn't contain a renderer\n"
+                     "  --check         Report forms that differ from how the gui builder would save them\n"
+                     "  --resave        Save forms again in the format in which the gui builder would save them\n"
+                     "  --jobs <count>  Number of threads used to parse the forms (defaults to the number of cores)\n"
+                     "\n"
+                     "The exit code is 0 when all forms are valid, 1 when a form is invalid and 2 when the arguments are wrong.\n";
+    }
+
+    std::string unquoteSectionName(const std::string& name)
+    {
+        if ((name.size() >= 2) && (name.front() == '"') && (name.back() == '"'))
+            return name.substr(1, name.size() - 2);
+        else
+            return name;
+    }
+
+    void checkRendererReferences(const tgui::DataIO::Node& node, const std::set<std::string>& availableRenderers, FormReport& report)
+    {
+        const auto it = node.propertyValuePairs.find("renderer");
+        if ((it != node.propertyValuePairs.end()) && it->second)
+        {
+            const std::string& value = it->second->value;
+            if (value.empty() || (value[0] != '&'))
+                report.errors.push_back("Section '" + node.name + "' has a renderer property that isn't a reference to a renderer");
+            else if (availableRenderers.find(tgui::toLower(value.substr(1))) == availableRenderers.end())
+                report.errors.push_back("Section '" + node.name + "' refers to renderer '" + value.substr(1) + "', which doesn't exist");
+        }
+
+        for (const auto& child : node.children)
+            checkRendererReferences(*child, availableRenderers, report);
+    }
+
+    // Reads and parses a form. This function doesn't access any widgets or global state, so it can run on any thread.
+    void parseForm(FormReport& report)
+    {
+        sf::Clock clock;
+
+        std::ifstream in{report.filename};
+        if (!in.is_open())
+        {
+            report.errors.push_back("Failed to open the file");
+            return;
+        }
+
+        std::stringstream stream;
+        stream << in.rdbuf();
+        report.contents = stream.str();
+
+        try
+        {
+            report.rootNode = tgui::DataIO::parse(stream);
+        }
+        catch (const tgui::Exception& e)
+        {
+            report.errors.push_back(std::string{"Failed to parse the file: "} + e.what());
+            return;
+        }
+
+        // Renderers that are shared between widgets are stored in sections at the top level of the file
+        std::set<std::string> availableRenderers;
+        for (const auto& node : report.rootNode->children)
+        {
+            const auto nameSeparator = node->name.find('.');
+            if ((nameSeparator != std::string::npos) && (tgui::toLower(node->name.substr(0, nameSeparator)) == "renderer"))
+                availableRenderers.insert(tgui::toLower(unquoteSectionName(node->name.substr(nameSeparator + 1))));
+        }
+
+        checkRendererReferences(*report.rootNode, availableRenderers, report);
+        report.parseTime = clock.getElapsedTime();
+    }
+
+    void collectWidgets(const tgui::Container& container, std::size_t& widgetCount, std::set<std::string>& widgetTypes)
+    {
+        for (const auto& widget : container.getWidgets())
+        {
+            ++widgetCount;
+            widgetTypes.insert(widget->getWidgetType());
+
+            if (widget->isContainer())
+                collectWidgets(static_cast<const tgui::Container&>(*widget), widgetCount, widgetTypes);
+        }
+    }
+
+    // Creates the widgets from the parsed form, which has to happen on the main thread
+    void loadForm(FormReport& report, tgui::Theme* theme, SaveMode saveMode)
+    {
+        if (!report.rootNode || !report.errors.empty())
+            return;
+
+        auto group = tgui::Group::create();
+
+        sf::Clock clock;
+        try
+        {
+            group->loadWidgetsFromNodeTree(report.rootNode);
+        }
+        catch (const tgui::Exception& e)
+        {
+            report.errors.push_back(std::string{"Failed to load the widgets: "} + e.what());
+            return;
+        }
+        report.loadTime = clock.getElapsedTime();
+
+        std::set<std::string> widgetTypes;
+        collectWidgets(*group, report.widgetCount, widgetTypes);
+
+        // The theme loader is asked directly, because Theme::getRendererNoThrow would add an empty renderer to the theme and
+        // no longer report the type for the next forms. Widgets like Group or Grid don't have a section in most themes,
+        // so a missing section is only a warning.
+        if (theme)
+        {
+            for (const auto& type : widgetTypes)
+            {
+                if (!tgui::Theme::getThemeLoader()->canLoad(theme->getPrimary(), tgui::toLower(type)))
+                    report.warnings.push_back("The theme doesn't contain a renderer for widget type '" + type + "'");
+            }
+        }
+
+        if (saveMode == SaveMode::None)
+            return;
+
+        std::stringstream stream;
+        group->saveWidgetsToStream(stream);
+        report.canonical = (stream.str() == report.contents);
+
+        if (!report.canonical && (saveMode == SaveMode::Resave))
+        {
+            try
+            {
+                group->saveWidgetsToFile(report.filename);
+                report.resaved = true;
+            }
+            catch (const tgui::Exception& e)
+            {
+                report.errors.push_back(e.what());
+            }
+        }
+    }
+
+    void printReport(const FormReport& report, SaveMode saveMode)
+    {
+        const bool failed = !report.errors.empty() || (!report.canonical && (saveMode == SaveMode::Check));
+
+        std::cout << (failed ? "FAILED " : "OK     ") << report.filename
+                  << "  widgets: " << report.widgetCount
+                  << "  parse: " << report.parseTime.asMicroseconds() / 1000.f << " ms"
+                  << "  load: " << report.loadTime.asMicroseconds() / 1000.f << " ms";
+
+        if (report.resaved)
+            std::cout << "  (saved again)";
+        else if (!report.canonical)
+            std::cout << "  (not saved in canonical form)";
+
+        std::cout << "\n";
+
+        for (const auto& error : report.errors)
+            std::cout << "    error: " << error << "\n";
+        for (const auto& warning : report.warnings)
+            std::cout << "    warning: " << warning << "\n";
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int runBatchMode(const std::vector<std::string>& arguments)
+{
+    std::string themeFilename;
+    SaveMode saveMode = SaveMode::None;
+    unsigned int jobs = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<FormReport> reports;
+
+    for (std::size_t i = 0; i < arguments.size(); ++i)
+    {
+        if ((arguments[i] == "--theme") && (i + 1 < arguments.size()))
+            themeFilename = arguments[++i];
+        else if ((arguments[i] == "--jobs") && (i + 1 < arguments.size()))
+            jobs = std::max(1, tgui::strToInt(arguments[++i], 1));
+        else if (arguments[i] == "--check")
+            saveMode = SaveMode::Check;
+        else if (arguments[i] == "--resave")
+            saveMode = SaveMode::Resave;
+        else if ((arguments[i] == "--help") || (arguments[i].substr(0, 2) == "--"))
+        {
+            printUsage();
+            return (arguments[i] == "--help") ? 0 : 2;
+        }
+        else
+        {
+            reports.emplace_back();
+            reports.back().filename = arguments[i];
+        }
+    }
+
+    if (reports.empty())
+    {
+        printUsage();
+        return 2;
+    }
+
+    std::unique_ptr<tgui::Theme> theme;
+    if (!themeFilename.empty())
+    {
+        try
+        {
+            theme = std::make_unique<tgui::Theme>(themeFilename);
+        }
+        catch (const tgui::Exception& e)
+        {
+            std::cout << "Failed to load theme '" << themeFilename << "': " << e.what() << "\n";
+            return 2;
+        }
+    }
+
+    sf::Clock totalClock;
+
+    // Reading and parsing the files is independent of TGUI's global state, so it is divided over several threads.
+    // Creating the widgets uses the shared texture and font managers, so that part happens on the main thread.
+    std::atomic<std::size_t> nextReport{0};
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < std::min<std::size_t>(jobs, reports.size()); ++i)
+    {
+        threads.emplace_back([&]{
+            for (std::size_t index = nextReport++; index < reports.size(); index = nextReport++)
+                parseForm(reports[index]);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    const sf::Time parseWallTime = totalClock.getElapsedTime();
+
+    std::cout << std::fixed << std::setprecision(2);
+
+    std::size_t failedForms = 0;
+    std::size_t totalWidgets = 0;
+    sf::Time totalLoadTime;
+    for (auto& report : reports)
+    {
+        loadForm(report, theme.get(), saveMode);
+        printReport(report, saveMode);
+
+        if (!report.errors.empty() || (!report.canonical && (saveMode == SaveMode::Check)))
+            ++failedForms;
+
+        totalWidgets += report.widgetCount;
+        totalLoadTime += report.loadTime;
+
+        // The parsed nodes and file contents are no longer needed
+        report.rootNode = nullptr;
+        report.contents.clear();
+    }
+
+    std::cout << "\n" << reports.size() << " forms, " << failedForms << " failed, " << totalWidgets << " widgets\n"
+              << "Parsing took " << parseWallTime.asMicroseconds() / 1000.f << " ms on " << threads.size() << " threads, "
+              << "loading widgets took " << totalLoadTime.asMicroseconds() / 1000.f << " ms, "
+              << "total time was " << totalClock.getElapsedTime().asMicroseconds() / 1000.f << " ms\n";
+
+    return (failedForms > 0) ? 1 : 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -268,6 +268,26 @@ void Form::updateSelectionSquarePositions()
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void Form::requestSelectionSquareUpdate()
+{
+    // Moving a widget with the mouse can change its position many times per frame, so the squares are only moved once
+    m_selectionSquaresUpdatePending = true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Form::applyPendingSelectionSquareUpdate()
+{
+    if (!m_selectionSquaresUpdatePending)
+        return;
+
+    m_selectionSquaresUpdatePending = false;
+    if (m_selectedWidget)
+        updateSelectionSquarePositions();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void Form::selectWidgetById(const std::string& id)
 {
     selectWidget(m_widgets[id]);
@@ -351,8 +371,8 @@ void Form::arrowKeyPressed(const sf::Event::KeyEvent& keyEvent)
             selectedWidget->setPosition({selectedWidget->getPositionLayout().x, selectedWidget->getPosition().y + MOVE_STEP});
 
         setChanged(true);
-        updateSelectionSquarePositions();
-        m_guiBuilder->reloadProperties();
+        requestSelectionSquareUpdate();
+        m_guiBuilder->requestPropertiesReload();
     }
     else if (keyEvent.shift)
     {
@@ -366,8 +386,8 @@ void Form::arrowKeyPressed(const sf::Event::KeyEvent& keyEvent)
             selectedWidget->setSize({selectedWidget->getSizeLayout().x, selectedWidget->getSize().y + 1});
 
         setChanged(true);
-        updateSelectionSquarePositions();
-        m_guiBuilder->reloadProperties();
+        requestSelectionSquareUpdate();
+        m_guiBuilder->requestPropertiesReload();
     }
     else if (keyEvent.control)
     {
@@ -381,8 +401,8 @@ void Form::arrowKeyPressed(const sf::Event::KeyEvent& keyEvent)
             selectedWidget->setPosition({selectedWidget->getPositionLayout().x, selectedWidget->getPosition().y + 1});
 
         setChanged(true);
-        updateSelectionSquarePositions();
-        m_guiBuilder->reloadProperties();
+        requestSelectionSquareUpdate();
+        m_guiBuilder->requestPropertiesReload();
     }
     else
     {
@@ -847,8 +867,8 @@ void Form::onDrag(sf::Vector2i mousePos)
     if (updated)
     {
         setChanged(true);
-        updateSelectionSquarePositions();
-        m_guiBuilder->reloadProperties();
+        requestSelectionSquareUpdate();
+        m_guiBuilder->requestPropertiesReload();
     }
 }
 
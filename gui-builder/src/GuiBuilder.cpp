@@ -47,6 +47,7 @@
 #include "WidgetProperties/TreeViewProperties.hpp"
 #include "GuiBuilder.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <cassert>
 #include <memory>
@@ -227,6 +228,15 @@ namespace
         const std::string y = tgui::trim(str.substr(commaPos + 1));
         return {tgui::strToFloat(x), tgui::strToFloat(y)};
     }
+
+    // Checks whether both lists contain the same properties with the same types, in which case their rows can be reused
+    bool haveSamePropertyRows(const PropertyValueMap& oldPropertyValuePairs, const PropertyValueMap& newPropertyValuePairs)
+    {
+        return std::equal(oldPropertyValuePairs.begin(), oldPropertyValuePairs.end(), newPropertyValuePairs.begin(), newPropertyValuePairs.end(),
+            [](const PropertyValueMap::value_type& left, const PropertyValueMap::value_type& right){
+                return (left.first == right.first) && (left.second.first == right.second.first);
+            });
+    }
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -411,6 +421,8 @@ void GuiBuilder::mainLoop()
             m_gui.handleEvent(event);
         }
 
+        applyPendingUpdates();
+
         m_window.clear({200, 200, 200});
         m_gui.draw();
 
@@ -535,8 +547,10 @@ void GuiBuilder::formSaved(const sf::String& filename)
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void GuiBuilder::reloadProperties()
+void GuiBuilder::reloadProperties(const std::string& changedProperty)
 {
+    m_propertiesReloadPending = false;
+
     auto selectedWidget = m_selectedForm->getSelectedWidget();
     float topPosition = 0;
 
@@ -548,10 +562,30 @@ void GuiBuilder::reloadProperties()
                     changeWidgetName(value);
             });
 
-        topPosition += 10;
+        // All rows have the same height, so rows that don't need to be updated can be skipped
+        const auto nameEditBox = m_propertiesContainer->get<tgui::EditBox>("PropertyName");
+        const float rowHeight = EDIT_BOX_HEIGHT - nameEditBox->getRenderer()->getBorders().getBottom();
+
+        // Only the values that changed have to be updated when the same rows are still being shown. The changed property is always
+        // updated, because the edit box may contain a different string than the value that was stored in the widget.
+        const PropertyValueMapPair oldPropertyValuePairs = std::move(m_propertyValuePairs);
         m_propertyValuePairs = m_widgetProperties.at(selectedWidget->ptr->getWidgetType())->initProperties(selectedWidget->ptr);
+        const bool reuseRows = haveSamePropertyRows(oldPropertyValuePairs.first, m_propertyValuePairs.first)
+                            && haveSamePropertyRows(oldPropertyValuePairs.second, m_propertyValuePairs.second);
+
+        auto isRowUpToDate = [&](const PropertyValueMap& oldPairs, const PropertyValuePair& property){
+            return reuseRows && (property.first != changedProperty) && (oldPairs.at(property.first).second == property.second.second);
+        };
+
+        topPosition += 10;
         for (const auto& property : m_propertyValuePairs.first)
         {
+            if (isRowUpToDate(oldPropertyValuePairs.first, property))
+            {
+                topPosition += rowHeight;
+                continue;
+            }
+
             addPropertyValueWidgets(topPosition, property,
                 [=](const sf::String& value){
                     if (updateWidgetProperty(property.first, value))
@@ -568,6 +602,12 @@ void GuiBuilder::reloadProperties()
             topPosition += rendererComboBox->getSize().y + 10;
             for (const auto& property : m_propertyValuePairs.second)
             {
+                if (isRowUpToDate(oldPropertyValuePairs.second, property))
+                {
+                    topPosition += rowHeight;
+                    continue;
+                }
+
                 addPropertyValueWidgets(topPosition, property,
                     [=](const sf::String& value){
                         if (updateWidgetProperty(property.first, value))
@@ -623,6 +663,14 @@ void GuiBuilder::reloadProperties()
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void GuiBuilder::requestPropertiesReload()
+{
+    // Dragging a widget changes its properties many times per frame, the property rows only need to be updated once
+    m_propertiesReloadPending = true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void GuiBuilder::widgetSelected(tgui::Widget::Ptr widget)
 {
     initProperties();
@@ -632,7 +680,7 @@ void GuiBuilder::widgetSelected(tgui::Widget::Ptr widget)
     else
         m_selectedWidgetComboBox->setSelectedItemById("form");
 
-    updateSelectedWidgetHierarchy();
+    m_selectedWidgetHierarchyUpdatePending = true;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -953,6 +1001,10 @@ void GuiBuilder::createNewWidget(tgui::Widget::Ptr widget, tgui::Container* pare
 
 bool GuiBuilder::updateWidgetProperty(const std::string& property, const sf::String& value)
 {
+    // The stored values have to be up-to-date in order to compare them with the new value
+    if (m_propertiesReloadPending)
+        reloadProperties();
+
     sf::String oldValue;
     if (m_propertyValuePairs.first.find(property) != m_propertyValuePairs.first.end())
         oldValue = m_propertyValuePairs.first[property].second;
@@ -979,8 +1031,8 @@ bool GuiBuilder::updateWidgetProperty(const std::string& property, const sf::Str
         valueChanged = false;
     }
 
-    reloadProperties(); // reload all properties in case something else changed
-    m_selectedForm->updateSelectionSquarePositions(); // update the position of the selection squares in case the position or size of the widget changed
+    reloadProperties(property); // reload all properties in case something else changed
+    m_selectedForm->requestSelectionSquareUpdate(); // update the position of the selection squares in case the position or size of the widget changed
     return valueChanged;
 }
 
@@ -989,6 +1041,7 @@ bool GuiBuilder::updateWidgetProperty(const std::string& property, const sf::Str
 void GuiBuilder::initProperties()
 {
     m_propertiesContainer->removeAllWidgets();
+    m_propertyValuePairs = {}; // The rows were removed, so none of them can be reused
 
     auto selectedWidget = m_selectedForm->getSelectedWidget();
 
@@ -2227,8 +2280,45 @@ void GuiBuilder::fillWidgetHierarchyTreeRecursively(std::vector<sf::String>& hie
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void GuiBuilder::applyPendingUpdates()
+{
+    if (m_selectedForm)
+    {
+        m_selectedForm->applyPendingSelectionSquareUpdate();
+
+        if (m_propertiesReloadPending)
+            reloadProperties();
+    }
+
+    if (m_widgetHierarchyRebuildPending)
+    {
+        m_widgetHierarchyRebuildPending = false;
+        m_selectedWidgetHierarchyUpdatePending = false;
+        rebuildWidgetHierarchy();
+    }
+    else if (m_selectedWidgetHierarchyUpdatePending)
+    {
+        m_selectedWidgetHierarchyUpdatePending = false;
+        if (m_selectedForm)
+            updateSelectedWidgetHierarchy();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void GuiBuilder::widgetHierarchyChanged()
 {
+    // Loading or pasting many widgets would otherwise rebuild the entire tree for every widget
+    m_widgetHierarchyRebuildPending = true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void GuiBuilder::rebuildWidgetHierarchy()
+{
+    if (!m_widgetHierarchyTree)
+        return;
+
     m_widgetHierarchyTree->removeAllItems();
 
     if (m_selectedForm == nullptr)
@@ -23,9 +23,13 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "GuiBuilder.hpp"
+#include "BatchMode.hpp"
 
-int main()
+int main(int argc, char* argv[])
 {
+    if ((argc > 1) && (std::string(argv[1]) == "--batch"))
+        return runBatchMode({argv + 2, argv + argc});
+
     GuiBuilder builder;
     builder.mainLoop();
 }
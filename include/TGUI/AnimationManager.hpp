@@ -0,0 +1,283 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_ANIMATION_MANAGER_HPP
+#define TGUI_ANIMATION_MANAGER_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/Color.hpp>
+#include <TGUI/Vector2f.hpp>
+#include <SFML/System/Time.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <array>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Widget;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Curve that maps the elapsed fraction of an animation to the fraction of the distance that has been travelled
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class Easing : std::uint8_t
+    {
+        Linear,     ///< Constant speed
+        EaseIn,     ///< Starts slow and accelerates (cubic)
+        EaseOut,    ///< Starts fast and decelerates (cubic)
+        EaseInOut,  ///< Accelerates during the first half and decelerates during the second half (cubic)
+        EaseOutBack ///< Decelerates and overshoots the end value slightly before settling on it
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Plays many animations (tweens) on widget properties and applies them once per frame
+    ///
+    /// Every gui owns an animation manager, which is updated by Gui::updateTime before the widgets are updated.
+    /// All active animations are stored in contiguous arrays, so starting an animation doesn't allocate memory once the
+    /// arrays are large enough (see reserve), except when it is the first animation of a widget. The values of all animations that belong to the same widget are applied
+    /// together and the widget is only invalidated once per frame, no matter how many of its properties are animated.
+    ///
+    /// A widget only has a single animation per property: starting an animation on a property that is already being
+    /// animated replaces the old animation and continues from the current value.
+    ///
+    /// @code
+    /// gui.getAnimationManager().animatePosition(button, {200, 50}, sf::milliseconds(300), tgui::Easing::EaseOut);
+    /// gui.getAnimationManager().animateColor(button, "BackgroundColor", sf::Color::Red, sf::milliseconds(300));
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API AnimationManager
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Moves the widget from its current position to a new position
+        ///
+        /// @param widget       Widget to animate
+        /// @param endPosition  Position of the widget when the animation has finished
+        /// @param duration     Duration of the animation
+        /// @param easing       Curve that is used to calculate the intermediate positions
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void animatePosition(const std::shared_ptr<Widget>& widget, Vector2f endPosition, sf::Time duration, Easing easing = Easing::Linear);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resizes the widget from its current size to a new size
+        ///
+        /// @param widget   Widget to animate
+        /// @param endSize  Size of the widget when the animation has finished
+        /// @param duration Duration of the animation
+        /// @param easing   Curve that is used to calculate the intermediate sizes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void animateSize(const std::shared_ptr<Widget>& widget, Vector2f endSize, sf::Time duration, Easing easing = Easing::Linear);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the inherited opacity of the widget from its current value to a new value
+        ///
+        /// @param widget      Widget to animate
+        /// @param endOpacity  Opacity of the widget when the animation has finished, between 0 and 1
+        /// @param duration    Duration of the animation
+        /// @param easing      Curve that is used to calculate the intermediate opacities
+        ///
+        /// This animates the same value as the Fade animation of showWithEffect, which is multiplied with the opacity from
+        /// the renderer.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void animateOpacity(const std::shared_ptr<Widget>& widget, float endOpacity, sf::Time duration, Easing easing = Easing::Linear);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes a color property in the renderer of the widget from its current value to a new color
+        ///
+        /// @param widget    Widget to animate
+        /// @param property  Name of the renderer property (e.g. "BackgroundColor")
+        /// @param endColor  Color when the animation has finished
+        /// @param duration  Duration of the animation
+        /// @param easing    Curve that is used to calculate the intermediate colors
+        ///
+        /// If the property doesn't have a color yet then the animation starts from the end color with an alpha value of 0.
+        /// The renderer of the widget will no longer be shared with other widgets once the animation starts.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void animateColor(const std::shared_ptr<Widget>& widget, const std::string& property, Color endColor, sf::Time duration, Easing easing = Easing::Linear);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops all animations of a widget, leaving its properties at their current values
+        ///
+        /// @param widget  Widget of which the animations should be stopped
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void stop(const std::shared_ptr<Widget>& widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Ends all animations of a widget immediately, giving its properties their end values
+        ///
+        /// @param widget  Widget of which the animations should be finished
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void finish(const std::shared_ptr<Widget>& widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops all animations, leaving the animated properties at their current values
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void stopAll();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether one of the properties of the widget is being animated
+        ///
+        /// @param widget  Widget to check
+        ///
+        /// @return Does the widget have an active animation?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isAnimating(const std::shared_ptr<Widget>& widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of animations that are currently playing
+        ///
+        /// @return Number of active animations
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getAnimationCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reserves memory so that the given amount of animations can play simultaneously without allocating memory
+        ///
+        /// @param count  Amount of animations
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void reserve(std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the fraction of the distance that has been travelled after a fraction of the duration has elapsed
+        ///
+        /// @param easing    Easing curve
+        /// @param progress  Elapsed fraction of the duration, between 0 and 1
+        ///
+        /// @return Interpolation factor, 0 at the start and 1 at the end (may temporarily go past 1 for EaseOutBack)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static float ease(Easing easing, float progress);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Advances all animations and applies the new values to the widgets. This is called by Gui::updateTime.
+        ///
+        /// @return Are there still animations playing that require another update?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool update(sf::Time elapsedTime);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        enum class Property : std::uint8_t
+        {
+            Position,
+            Size,
+            Opacity,
+            Color
+        };
+
+        // Adds an animation or replaces the existing animation of the same widget property
+        void addAnimation(const std::shared_ptr<Widget>& widget, Property property, unsigned int colorPropertyId,
+                          const std::array<float, 4>& startValue, const std::array<float, 4>& endValue, sf::Time duration, Easing easing);
+
+        // Applies the values of all animations of the widget, starting with the animation at the given index
+        void applyAnimations(std::shared_ptr<Widget> widget, std::size_t firstIndex);
+
+        // Removes all animations for which m_progress reached 1 or that were marked as stopped, and relinks the remaining ones
+        void removeFinishedAnimations();
+
+        // Removes a single animation from the chain of the widget stored at the given slot in m_animatedWidgets
+        void unlinkAnimation(std::size_t slot, std::size_t index);
+
+        // Returns the slot of the widget in m_animatedWidgets, or the maximum value of std::size_t when it isn't animated
+        std::size_t findAnimatedWidget(const Widget* widget) const;
+
+        // Adds a widget of which the first animation is stored at the given index to m_animatedWidgets
+        void insertAnimatedWidget(const Widget* widget, std::size_t index);
+
+        // Removes the widget at the given slot from m_animatedWidgets, moving back the entries that were placed behind it
+        void eraseAnimatedWidget(std::size_t slot);
+
+        // Changes the amount of slots in m_animatedWidgets, which has to be a power of 2
+        void rehashAnimatedWidgets(std::size_t slotCount);
+
+        // Returns the index in m_colorPropertyNames of the lowercase renderer property, adding it to the list if needed
+        unsigned int getColorPropertyId(const std::string& property);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // The active animations are stored as a structure of arrays, the same index in every array belongs to the same
+        // animation. Animations are appended to the arrays and stopped animations are marked by a nullptr in m_widgets,
+        // the arrays are only compacted at the end of update.
+        std::vector<std::shared_ptr<Widget>> m_widgets;
+        std::vector<Property> m_properties;
+        std::vector<unsigned int> m_colorPropertyIds;
+        std::vector<Easing> m_easings;
+        std::vector<float> m_elapsedSeconds;
+        std::vector<float> m_durationSeconds;
+        std::vector<float> m_progress;
+        std::vector<std::array<float, 4>> m_startValues;
+        std::vector<std::array<float, 4>> m_endValues;
+
+        // The animations of the same widget are chained together in increasing order by storing the index of the
+        // previous and next animation, the maximum value of std::size_t marks the end of the chain.
+        std::vector<std::size_t> m_previousIndices;
+        std::vector<std::size_t> m_nextIndices;
+        std::size_t m_animationCount = 0;
+
+        // Open addressing table with linear probing that stores the first and last animation of each animated widget.
+        // Empty slots have a nullptr as widget. The table only allocates when it has to grow.
+        struct AnimatedWidget
+        {
+            const Widget* widget = nullptr;
+            std::size_t firstIndex = 0;
+            std::size_t lastIndex = 0;
+        };
+        std::vector<AnimatedWidget> m_animatedWidgets;
+        std::size_t m_animatedWidgetCount = 0;
+
+        // New index of each animation while the arrays are being compacted, kept to reuse its memory
+        std::vector<std::size_t> m_newIndices;
+
+        // Renderer properties of color animations are stored only once, the animations refer to them by index
+        std::vector<std::string> m_colorPropertyNames;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_ANIMATION_MANAGER_HPP
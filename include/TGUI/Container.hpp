@@ -28,6 +28,7 @@
 
 
 #include <list>
+#include <limits>
 
 #include <TGUI/Widget.hpp>
 
@@ -52,6 +53,49 @@ namespace tgui
         typedef std::shared_ptr<const Container> ConstPtr; ///< Shared constant widget pointer
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Counters that show how many widgets were drawn and how many could be skipped
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct DrawStatistics
+        {
+            std::size_t widgetsDrawn = 0;  ///< Amount of times a visible child widget was drawn
+            std::size_t widgetsCulled = 0; ///< Amount of times a visible child widget was skipped because it was outside the visible area
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calls beginBatchUpdate on a container when constructed and endBatchUpdate when it goes out of scope
+        ///
+        /// @code
+        /// {
+        ///     tgui::Container::BatchUpdate batch{grid};
+        ///     for (std::size_t row = 0; row < 100; ++row)
+        ///         grid->addWidget(tgui::Button::create(), row, 0);
+        /// } // The layout of the grid is updated here
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class BatchUpdate
+        {
+        public:
+            explicit BatchUpdate(std::shared_ptr<Container> container) :
+                m_container{std::move(container)}
+            {
+                m_container->beginBatchUpdate();
+            }
+
+            ~BatchUpdate()
+            {
+                m_container->endBatchUpdate();
+            }
+
+            BatchUpdate(const BatchUpdate&) = delete;
+            BatchUpdate& operator=(const BatchUpdate&) = delete;
+
+        private:
+            std::shared_ptr<Container> m_container;
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Default constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -296,6 +340,31 @@ namespace tgui
         void saveWidgetsToStream(std::stringstream& stream) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the child widgets from a tree of nodes
+        ///
+        /// @param rootNode         Root node of the widget file, as returned by DataIO::parse
+        /// @param replaceExisting  Remove existing widgets first if there are any
+        ///
+        /// Parsing the widget file with DataIO::parse doesn't access any widgets, so it can be done on a different thread.
+        /// Only this function has to be called from the thread that uses the gui. The nodes are modified while loading.
+        ///
+        /// @throw Exception when the nodes contain an unknown widget type or an invalid property
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadWidgetsFromNodeTree(const std::unique_ptr<DataIO::Node>& rootNode, bool replaceExisting = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a snapshot of the child widgets that can be written to a widget file later
+        ///
+        /// @return Root node of the tree that describes the widgets, which can be passed to DataIO::emit
+        ///
+        /// The returned tree no longer refers to the widgets. Only this function has to be called from the thread that
+        /// uses the gui, the tree can then be written to a file or stream on a background thread.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::unique_ptr<DataIO::Node> saveWidgetsToNodeTree() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Places a widget before all other widgets
         ///
@@ -314,6 +383,41 @@ namespace tgui
         void moveWidgetToBack(const Widget::Ptr& widget);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Delays repositioning the child widgets until endBatchUpdate is called
+        ///
+        /// Layout containers like Grid, HorizontalWrap and VerticalLayout recalculate the positions of all their widgets when
+        /// a widget is added, removed or resized. When the container is part of a gui, this only happens right before the gui
+        /// is drawn or handles an event, or when the position or size of a widget is requested. A container that isn't part
+        /// of a gui updates its layout immediately after every change, unless this function is called first. The layout is
+        /// then only calculated once, when endBatchUpdate is called.
+        ///
+        /// @code
+        /// grid->beginBatchUpdate();
+        /// for (std::size_t row = 0; row < 100; ++row)
+        /// {
+        ///     for (std::size_t col = 0; col < 10; ++col)
+        ///         grid->addWidget(tgui::Button::create(), row, col);
+        /// }
+        /// grid->endBatchUpdate();
+        /// @endcode
+        ///
+        /// Calls can be nested, the layout will be updated when the outermost batch ends. Until then the positions and sizes
+        /// of the child widgets may be outdated, even when they are requested.
+        ///
+        /// @see endBatchUpdate, BatchUpdate
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginBatchUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Ends a batch that was started with beginBatchUpdate and updates the layout if anything changed in the meantime
+        ///
+        /// @see beginBatchUpdate
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void endBatchUpdate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Focuses the next widget in this container
         /// @return Whether a new widget was focused
@@ -328,6 +432,21 @@ namespace tgui
         bool focusPreviousWidget();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many child widgets were drawn and how many were skipped because they lied outside the visible area
+        ///
+        /// The counters are shared by all containers. A container that is skipped counts as one culled widget, its children
+        /// aren't counted.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static DrawStatistics getDrawStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resets the counters that are returned by getDrawStatistics
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void resetDrawStatistics();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Focus or unfocus the widget
         /// @param focused  Is the widget focused?
@@ -459,6 +578,7 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function will call the draw function from all the widgets.
+        // Widgets that lie completely outside the view of the target are skipped.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states = sf::RenderStates::Default) const;
 
@@ -475,6 +595,26 @@ namespace tgui
         bool tryFocusWidget(const tgui::Widget::Ptr &widget, bool reverseWidgetOrder);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Repositions and resizes the child widgets. Only layout containers override this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void updateWidgets();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns true when the layout update was deferred, in which case updateWidgets will be called again later: either
+        // when the batch update ends or, when the container is part of a gui, when the gui updates its queued layouts.
+        // Layout containers call this function before recalculating the positions of their widgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool deferLayoutUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calls updateWidgets if the layout update was deferred and no batch update is in progress
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateDeferredLayout();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -491,8 +631,20 @@ namespace tgui
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        // How many times beginBatchUpdate was called without a matching endBatchUpdate
+        unsigned int m_batchUpdateDepth = 0;
+
+        // Did the layout change while a batch update was in progress or since the gui last updated the queued layouts?
+        bool m_layoutUpdatePending = false;
+
+        // Is updateWidgets being called to update a deferred layout?
+        bool m_layoutUpdateInProgress = false;
+
+        static DrawStatistics m_drawStatistics;
+
 
         friend class SubwidgetContainer; // Needs access to save and load functions
+        friend class GuiContainer; // Updates the deferred layouts of the containers inside the gui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -548,6 +700,39 @@ namespace tgui
         bool mouseOnWidget(Vector2f pos) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks the gui as needing to be redrawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Remembers the earliest time at which one of the widgets wants to be updated again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void requestWakeup(sf::Time delay) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Remembers that the layout of the container has to be updated before the widgets are drawn or queried
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool queueLayoutUpdate(const std::shared_ptr<Container>& container) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Updates the layouts of all containers in the gui that were changed since the last time this function was called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateQueuedLayouts() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~GuiContainer();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -570,6 +755,16 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // Has anything changed since the gui was last drawn?
+        bool m_redrawRequested = true;
+
+        // Time after the last update at which a widget wants to be updated again
+        sf::Time m_nextWakeupTime = sf::microseconds(std::numeric_limits<sf::Int64>::max());
+
+        // Containers of which the layout has to be updated before drawing, the vector keeps its capacity between frames
+        std::vector<std::weak_ptr<Container>> m_queuedLayoutUpdates;
+        bool m_updatingQueuedLayouts = false;
+
         friend class Gui; // Required to let Gui access protected members from container and Widget
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
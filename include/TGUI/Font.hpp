@@ -28,10 +28,12 @@
 
 #include <TGUI/Config.hpp>
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/System/String.hpp>
 #include <cstdint>
 #include <string>
 #include <cstddef>
 #include <memory>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -43,6 +45,16 @@ namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Information about the textures in which the font stores its rasterized glyphs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct GlyphStatistics
+        {
+            std::size_t pages = 0;         ///< Amount of glyph pages, the font has one texture per character size
+            std::size_t textureMemory = 0; ///< Amount of bytes used by the textures of the glyph pages
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Default constructor which will set the font to nullptr
         ///
@@ -199,6 +211,38 @@ namespace tgui
         const sf::Glyph& getGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Rasterizes glyphs in advance so that the first frame that shows them doesn't have to do it
+        ///
+        /// @param characters        Characters to rasterize
+        /// @param characterSizes    Text sizes for which the characters should be rasterized
+        /// @param bold              Rasterize the bold version or the regular one?
+        /// @param outlineThickness  Thickness of outline, or 0 when the text won't have an outline
+        ///
+        /// The glyphs are rendered and uploaded to the texture of the font, so this function has to be called from the thread
+        /// that draws the gui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void prewarm(const sf::String& characters, const std::vector<unsigned int>& characterSizes, bool bold = false, float outlineThickness = 0) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Rasterizes all printable ASCII characters in advance for the given text sizes
+        ///
+        /// @param characterSizes  Text sizes for which the characters should be rasterized
+        /// @param bold            Rasterize the bold version or the regular one?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void prewarm(const std::vector<unsigned int>& characterSizes, bool bold = false) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many glyph pages exist and how much memory their textures use
+        ///
+        /// @return Statistics of the character sizes for which glyphs were requested, either by prewarm or while drawing
+        ///         (for this font or any copy of it), or zeros when the font is a nullptr
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        GlyphStatistics getGlyphStatistics() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the kerning offset of two glyphs
         ///
@@ -234,6 +278,7 @@ namespace tgui
 
         std::shared_ptr<sf::Font> m_font;
         std::string m_id;
+        mutable unsigned int m_lastCharacterSize = 0; // Character size of the last requested glyph, which was already recorded
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
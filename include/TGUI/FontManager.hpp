@@ -0,0 +1,148 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_FONT_MANAGER_HPP
+#define TGUI_FONT_MANAGER_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/Config.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/System/String.hpp>
+#include <memory>
+#include <map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Keeps track of the fonts that were loaded from files, so that every font file is only loaded once
+    ///
+    /// Fonts are only kept in memory as long as they are being used, the manager itself only holds weak references to them.
+    /// All fonts that are loaded by filename (e.g. via the Font constructor, from themes or from widget files) pass through
+    /// this class.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API FontManager
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Counters that show how effective the cache is
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Statistics
+        {
+            std::size_t loads = 0;     ///< Amount of times a font file was loaded from disk
+            std::size_t cacheHits = 0; ///< Amount of times an already loaded font was reused
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a font
+        ///
+        /// @param filename  Filename of the font to load. The resource path is prepended when the filename is relative.
+        ///
+        /// As long as the font is still in use, calling this function again with the same filename returns the same font.
+        ///
+        /// @return The font when loaded successfully, nullptr otherwise
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<sf::Font> getFont(const sf::String& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a font in advance, so that it doesn't have to be loaded when the first widget needs it
+        ///
+        /// @param filename  Filename of the font to load. The resource path is prepended when the filename is relative.
+        ///
+        /// The font stays in memory for as long as the returned pointer is kept alive, even when no widget uses it.
+        ///
+        /// @return The font when loaded successfully (or already loaded), nullptr otherwise
+        ///
+        /// @see evictFont
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<sf::Font> preloadFont(const sf::String& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Forgets about a font, so that it is loaded from disk again the next time it is requested
+        ///
+        /// @param filename  Filename of the font
+        ///
+        /// The font is only destroyed once it is no longer used by any widget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void evictFont(const sf::String& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Forgets about all fonts, so that they are loaded from disk again the next time they are requested
+        ///
+        /// Fonts are only destroyed once they are no longer used by any widget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void evictAllFonts();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether a font is currently in memory and will be reused when it is requested
+        ///
+        /// @param filename  Filename of the font
+        ///
+        /// @return Is the font loaded?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isFontLoaded(const sf::String& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times fonts were loaded from disk and how many times a loaded font could be reused
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static Statistics getStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resets the counters that are returned by getStatistics
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void resetStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Returns the filename with the resource path in front of it unless the filename is an absolute path
+        static sf::String getResolvedFilename(const sf::String& filename);
+
+        // Removes the fonts that are no longer used by anyone
+        static void removeExpiredFonts();
+
+        // Only weak references are stored, a static owner would destroy its fonts after SFML was already cleaned up
+        static std::map<sf::String, std::weak_ptr<sf::Font>> m_fonts;
+        static Statistics m_statistics;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_FONT_MANAGER_HPP
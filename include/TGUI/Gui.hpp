@@ -28,6 +28,7 @@
 
 
 #include <TGUI/Container.hpp>
+#include <TGUI/AnimationManager.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <queue>
 
@@ -145,6 +146,36 @@ namespace tgui
         bool handleEvent(sf::Event event);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds an event to the queue that is processed by handleQueuedEvents
+        ///
+        /// @param event  The event that was polled from the window
+        ///
+        /// Instead of calling handleEvent for every event, all pending events can be queued and handled at once:
+        /// @code
+        /// sf::Event event;
+        /// while (window.pollEvent(event))
+        ///     gui.queueEvent(event);
+        ///
+        /// gui.handleQueuedEvents();
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void queueEvent(const sf::Event& event);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Passes all queued events to the widgets, after merging events that follow each other and have the same effect
+        ///
+        /// @return Has any of the events been consumed?
+        ///
+        /// Consecutive MouseMoved events and consecutive TouchMoved events of the same finger are replaced by the last one.
+        /// Consecutive MouseWheelScrolled events for the same wheel at the same position are replaced by a single event that
+        /// scrolls the sum of their deltas. All other events are passed on unchanged and in the order they were queued, so
+        /// a mouse move is never merged across a button press or release.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool handleQueuedEvents();
+
+
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief While tab key usage is enabled (default), pressing tab will focus another widget
@@ -177,6 +208,59 @@ namespace tgui
         void draw();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Rasterizes the glyphs for the fonts and text sizes of all widgets in the gui (including their tool tips)
+        ///
+        /// Calling this function after creating the widgets moves the cost of rasterizing the printable ASCII characters to
+        /// the moment it is called, instead of the first frame in which a text with a new size is shown.
+        ///
+        /// @see Font::prewarm
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void prewarmFonts();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether something changed since the last time the gui was drawn
+        ///
+        /// @return Does the gui have to be drawn again?
+        ///
+        /// This allows an event-driven main loop that only redraws the screen when needed instead of every frame:
+        /// @code
+        /// while (window.isOpen())
+        /// {
+        ///     sf::Event event;
+        ///     while (window.pollEvent(event))
+        ///         gui.handleEvent(event);
+        ///
+        ///     if (gui.updateTime())
+        ///     {
+        ///         window.clear();
+        ///         gui.draw();
+        ///         window.display();
+        ///     }
+        ///     else // Sleep until the next timer (e.g. a blinking caret) expires, but keep polling for events
+        ///         sf::sleep(std::min(gui.getNextWakeupTime(), sf::milliseconds(10)));
+        /// }
+        /// @endcode
+        ///
+        /// Handled events, animations, blinking carets, adding or removing widgets and changing the position, size, visibility
+        /// or renderer of a widget all cause a redraw. Changing the contents of a widget (e.g. its text, value, items or
+        /// selection) causes a redraw for Button, ChatBox, CheckBox, ComboBox, EditBox, Label, ListBox, ListView, ProgressBar,
+        /// RadioButton, Scrollbar, Slider, Tabs and TextBox. After changing other widgets from code, or something that the gui
+        /// can't know about (e.g. inside a Canvas), call Widget::invalidate yourself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool needsRedraw() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how long it takes before updateTime has to be called again
+        ///
+        /// @return Time until the next animation step, caret blink or tool tip. When nothing is scheduled, the returned time is
+        ///         the largest value that sf::Time can hold. While an animation is playing this function returns 0.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getNextWakeupTime() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the internal container of the Gui
         ///
@@ -191,6 +275,16 @@ namespace tgui
         GuiContainer::Ptr getContainer() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the animation manager that animates properties of widgets in this gui
+        ///
+        /// The animations are advanced in updateTime, which is called by the draw function.
+        ///
+        /// @return Reference to the animation manager of the gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        AnimationManager& getAnimationManager();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the global font
         ///
@@ -440,6 +534,31 @@ namespace tgui
         void saveWidgetsToStream(std::stringstream& stream) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the widgets from a tree of nodes
+        ///
+        /// @param rootNode         Root node of the widget file, as returned by DataIO::parse
+        /// @param replaceExisting  Remove existing widgets first if there are any
+        ///
+        /// Parsing the widget file with DataIO::parse doesn't access any widgets, so it can be done on a different thread.
+        /// Only this function has to be called from the thread that uses the gui. The nodes are modified while loading.
+        ///
+        /// @throw Exception when the nodes contain an unknown widget type or an invalid property
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadWidgetsFromNodeTree(const std::unique_ptr<DataIO::Node>& rootNode, bool replaceExisting = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a snapshot of the widgets that can be written to a widget file later
+        ///
+        /// @return Root node of the tree that describes the widgets, which can be passed to DataIO::emit
+        ///
+        /// The returned tree no longer refers to the widgets. Only this function has to be called from the thread that
+        /// uses the gui, the tree can then be written to a file or stream on a background thread.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::unique_ptr<DataIO::Node> saveWidgetsToNodeTree() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         // Updates the internal clock to make animation possible. This function is called automatically by the draw function.
@@ -448,6 +567,17 @@ namespace tgui
         void updateTime(const sf::Time& elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Updates the internal clock to make animations and timers (e.g. blinking carets) possible
+        ///
+        /// @return Does the gui have to be drawn again? This is the same value that needsRedraw would return.
+        ///
+        /// This function is called automatically by the draw function. You only need to call it yourself when you don't draw
+        /// the gui every frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateTime();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       private:
 
@@ -475,6 +605,9 @@ namespace tgui
         // Internal container to store all widgets
         GuiContainer::Ptr m_container = std::make_shared<GuiContainer>();
 
+        // Plays the animations that were started with getAnimationManager()
+        AnimationManager m_animationManager;
+
         Widget::Ptr m_visibleToolTip = nullptr;
         sf::Time m_tooltipTime;
         bool m_tooltipPossible = false;
@@ -484,6 +617,9 @@ namespace tgui
 
         bool m_TabKeyUsageEnabled = true;
 
+        // Events that were passed to queueEvent and which will be handled when handleQueuedEvents is called
+        std::vector<sf::Event> m_eventQueue;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
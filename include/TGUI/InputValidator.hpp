@@ -0,0 +1,164 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_INPUT_VALIDATOR_HPP
+#define TGUI_INPUT_VALIDATOR_HPP
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/String.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Regular expression that is used to validate the input of an edit box
+    ///
+    /// The expression is compiled into a state machine once, after which checking a string no longer allocates memory and
+    /// takes a single table lookup per character. The supported syntax is the subset of the ECMAScript grammar that doesn't
+    /// require backtracking: literals, character classes, escapes like \\d and \\w, groups, alternatives and the quantifiers
+    /// *, +, ?, {n}, {n,} and {n,m}. Expressions that use other features (e.g. back-references or lookaheads) still work
+    /// but are internally matched with std::regex, just like before this class existed.
+    ///
+    /// The whole string has to match the expression, there is no need to put ^ and $ around it.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API InputValidator
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a validator that accepts any input
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        InputValidator();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Compiles a regular expression
+        ///
+        /// @param pattern  Regular expression to which the input has to match
+        ///
+        /// @throw Exception when the pattern isn't a valid regular expression
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        InputValidator(const std::string& pattern);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the regular expression that was passed to the constructor
+        ///
+        /// @return Regular expression to which the input has to match
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::string& getPattern() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the validator accepts any input, in which case there is no need to check the text
+        ///
+        /// @return Is the pattern ".*"?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool acceptsAnyInput() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether a text matches the regular expression
+        ///
+        /// @param text  Text to validate
+        ///
+        /// @return Does the entire text match the pattern?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool matches(const sf::String& text) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether a text would still match the regular expression after a character is typed in it
+        ///
+        /// @param text          Text before the edit
+        /// @param pos           Position where the character is inserted
+        /// @param removedChars  Amount of characters starting at pos that are replaced by the new character (selected text)
+        /// @param insertedChar  The typed character
+        ///
+        /// @return Does the edited text match the pattern?
+        ///
+        /// The edited string is never created, the characters are fed directly to the state machine. When every change to the
+        /// text is reported with textEdited, only the characters around the edit are checked.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool matchesAfterEdit(const sf::String& text, std::size_t pos, std::size_t removedChars, std::uint32_t insertedChar) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Updates the remembered states of the state machine after the text was changed
+        ///
+        /// @param text           Text after the edit
+        /// @param pos            Position where characters were removed and inserted
+        /// @param removedChars   Amount of characters that were removed at pos
+        /// @param insertedChars  Amount of characters that were inserted at pos
+        ///
+        /// The validator remembers in which state the state machine is after every character of the text, so that
+        /// matchesAfterEdit only has to check the characters from the edit position until the state machine ends up in a
+        /// state that it was already in for the unedited text. Once this function has been called, it has to be called for
+        /// every change to the text. When the text is replaced, pass 0 as position together with the old and new lengths.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void textEdited(const sf::String& text, std::size_t pos, std::size_t removedChars, std::size_t insertedChars) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the state in which the state machine ends up when receiving the character, or -1 if the input is rejected
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int nextState(int state, std::uint32_t character) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct FallbackRegex;
+
+        std::string m_pattern = ".*";
+        bool m_acceptsAnyInput = true;
+
+        // Characters are grouped in classes that are treated identically by the expression. The vector contains the first
+        // character of each class, the transition table contains one row per state with one column per character class.
+        std::vector<std::uint32_t> m_characterClasses;
+        std::vector<int> m_transitions;
+        std::vector<bool> m_acceptingStates;
+
+        // State after every prefix of the text that was passed to textEdited, empty when no text was passed yet
+        mutable std::vector<int> m_cachedStates;
+
+        // Expressions that can't be compiled to a state machine are matched with std::regex instead
+        std::shared_ptr<const FallbackRegex> m_fallbackRegex;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_INPUT_VALIDATOR_HPP
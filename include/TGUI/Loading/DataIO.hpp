@@ -89,11 +89,13 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Emits the widget file
         ///
-        /// @param rootNode Root node of the tree of nodes that is to be converted to a string stream
-        /// @param stream   Stream to which the widget file will be added
+        /// @param rootNode Root node of the tree of nodes that is to be converted to text
+        /// @param stream   Stream to which the widget file will be added, e.g. a string stream or a file stream
         ///
+        /// The nodes are written directly to the stream. Since the tree doesn't refer to any widgets, it can be emitted from
+        /// a different thread than the one that created the nodes.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static void emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream);
+        static void emit(const std::unique_ptr<Node>& rootNode, std::ostream& stream);
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -53,6 +53,7 @@ namespace tgui
         /// @brief Destructor
         ///
         /// When a pointer to this theme was passed to setDefault, the default theme will be reset.
+        /// The theme loader is told that the theme no longer uses its file, so that cached resources can be released.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ~Theme();
 
@@ -28,6 +28,7 @@
 
 
 #include <TGUI/Config.hpp>
+#include <TGUI/ObjectConverter.hpp>
 #include <SFML/System/String.hpp>
 #include <memory>
 #include <string>
@@ -85,6 +86,30 @@ namespace tgui
         virtual bool canLoad(const std::string& primary, const std::string& secondary) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the property-value pairs from the theme, with values that can be passed directly to a renderer
+        ///
+        /// @param primary    Primary parameter of the loader
+        /// @param secondary  Secondary parameter of the loader
+        ///
+        /// The default implementation just wraps the strings returned by the load function, so that they get deserialized
+        /// when a widget uses them. Loaders can override this function to return values that are already deserialized.
+        ///
+        /// @return Map of property-value pairs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::map<std::string, ObjectConverter> loadDeserialized(const std::string& primary, const std::string& secondary);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the loader that a theme which was using the primary parameter is destroyed or loads something else
+        ///
+        /// @param primary    Primary parameter of the loader (filename of the theme file in DefaultThemeLoader)
+        ///
+        /// Loaders that keep resources alive for their themes can release them here. The default implementation does nothing.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void release(const std::string& primary);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -136,11 +161,43 @@ namespace tgui
         bool canLoad(const std::string& filename, const std::string& section) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the property-value pairs from the theme file, with values that are already deserialized
+        ///
+        /// @param filename   Filename of the theme file
+        /// @param section    Name of the section inside the theme file
+        ///
+        /// The first time a section is loaded, the colors, textures, fonts, text styles, borders and nested sections in it
+        /// are deserialized and cached. All themes and widgets that use the section afterwards share these values instead
+        /// of parsing the strings again. Properties of which the type can't be derived from the name are left as strings.
+        ///
+        /// @return Map of property-value pairs
+        ///
+        /// @exception Exception when finding syntax errors in the file
+        /// @exception Exception when file did not contain requested class name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::map<std::string, ObjectConverter> loadDeserialized(const std::string& filename, const std::string& section) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes the deserialized values of a theme file from the cache
+        ///
+        /// @param filename  Filename of the theme file that is no longer used by a theme
+        ///
+        /// This is called when a theme is destroyed or loads another file, so that the cached textures and fonts don't outlive
+        /// the themes and widgets that use them. The property strings remain cached until flushCache is called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void release(const std::string& filename) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Empties the caches and force files to be reloaded.
         ///
         /// @param filename  File to remove from cache.
         ///                  If no filename is given, the entire cache is cleared.
+        ///
+        /// The cache keeps the textures and fonts of the sections that were loaded alive until the themes that loaded them are
+        /// destroyed. Flushing the cache releases them earlier, once they are no longer used by any widget.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void flushCache(const std::string& filename = "");
 
@@ -161,8 +218,9 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
         static std::map<std::string, std::map<std::string, std::map<sf::String, sf::String>>> m_propertiesCache;
+        static std::map<std::string, std::map<std::string, std::map<std::string, ObjectConverter>>> m_deserializedCache;
 
-        friend struct DefaultThemeLoaderTest; // Used for testing m_propertiesCache
+        friend struct DefaultThemeLoaderTest; // Used for testing m_propertiesCache and m_deserializedCache
     };
 
 
@@ -34,7 +34,8 @@
 #define TGUI_RENDERER_PROPERTY_OUTLINE(CLASS, NAME) \
     Outline CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
+        static const std::string property = toLower(#NAME); \
+        const auto it = m_data->propertyValuePairs.find(property); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getOutline(); \
         else \
@@ -50,7 +51,8 @@
 #define TGUI_RENDERER_PROPERTY_COLOR(CLASS, NAME, DEFAULT) \
     Color CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
+        static const std::string property = toLower(#NAME); \
+        const auto it = m_data->propertyValuePairs.find(property); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getColor(); \
         else \
@@ -66,7 +68,8 @@
 #define TGUI_RENDERER_PROPERTY_TEXT_STYLE(CLASS, NAME, DEFAULT) \
     TextStyle CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
+        static const std::string property = toLower(#NAME); \
+        const auto it = m_data->propertyValuePairs.find(property); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getTextStyle(); \
         else \
@@ -82,7 +85,8 @@
 #define TGUI_RENDERER_PROPERTY_GET_NUMBER(CLASS, NAME, DEFAULT) \
     float CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
+        static const std::string property = toLower(#NAME); \
+        const auto it = m_data->propertyValuePairs.find(property); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getNumber(); \
         else \
@@ -101,7 +105,8 @@
 #define TGUI_RENDERER_PROPERTY_GET_BOOL(CLASS, NAME, DEFAULT) \
     bool CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
+        static const std::string property = toLower(#NAME); \
+        const auto it = m_data->propertyValuePairs.find(property); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getBool(); \
         else \
@@ -121,13 +126,15 @@
 #define TGUI_RENDERER_PROPERTY_TEXTURE(CLASS, NAME) \
     Texture& CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
+        detachData(); \
+        static const std::string property = toLower(#NAME); \
+        const auto it = m_data->propertyValuePairs.find(property); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getTexture(); \
         else \
         { \
-            m_data->propertyValuePairs[toLower(#NAME)] = {Texture{}}; \
-            return m_data->propertyValuePairs[toLower(#NAME)].getTexture(); \
+            m_data->propertyValuePairs[property] = {Texture{}}; \
+            return m_data->propertyValuePairs[property].getTexture(); \
         } \
     } \
     void CLASS::set##NAME(const Texture& texture) \
@@ -140,13 +147,15 @@
 #define TGUI_RENDERER_PROPERTY_RENDERER(CLASS, NAME, RENDERER) \
     std::shared_ptr<RendererData> CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
+        static const std::string property = toLower(#NAME); \
+        const auto it = m_data->propertyValuePairs.find(property); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getRenderer(); \
         else \
         { \
             const auto& renderer = Theme::getDefault()->getRendererNoThrow(RENDERER); \
-            m_data->propertyValuePairs[toLower(#NAME)] = {renderer ? renderer : RendererData::create()}; \
+            detachData(); \
+            m_data->propertyValuePairs[property] = {renderer ? renderer : RendererData::create()}; \
             return renderer; \
         } \
     } \
@@ -30,6 +30,9 @@
 #include <TGUI/Config.hpp>
 #include <TGUI/ObjectConverter.hpp>
 #include <TGUI/Loading/DataIO.hpp>
+#include <functional>
+#include <unordered_map>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -68,8 +71,30 @@ namespace tgui
             return rendererData;
         };
 
+        /// @internal
+        /// Calls the callback functions of all widgets that are using this data
+        void notifyObservers(const std::string& property) const
+        {
+            // A callback may subscribe or unsubscribe other widgets, so the ids are copied first and each callback is looked up
+            // again before calling it. Widgets that were unsubscribed in the mean time are skipped, all others are still called.
+            std::vector<const void*> ids;
+            ids.reserve(observers.size());
+            for (const auto& observer : observers)
+                ids.push_back(observer.first);
+
+            for (const void* id : ids)
+            {
+                const auto it = observers.find(id);
+                if (it == observers.end())
+                    continue;
+
+                const auto callback = it->second;
+                callback(property);
+            }
+        }
+
         std::map<std::string, ObjectConverter> propertyValuePairs;
-        std::map<const void*, std::function<void(const std::string& property)>> observers;
+        std::unordered_map<const void*, std::function<void(const std::string& property)>> observers;
         bool shared = true;
     };
 
@@ -252,12 +277,24 @@ namespace tgui
         ///
         /// @return Data that is shared between the renderers
         ///
+        /// When the renderer was returned by Widget::getRenderer, the data is copied first if the widget was still using the
+        /// data of its theme. Only the renderer returned by Widget::getSharedRenderer gives access to the shared data.
+        ///
         /// @warning You should not make changed to this data directly. Instead, use the function from the renderer classes
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         std::shared_ptr<RendererData> getData() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the renderer data without giving the renderer its own copy of it first
+        ///
+        /// Unlike getData, this doesn't stop a widget that only reads its renderer from sharing the data of its theme.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::shared_ptr<RendererData>& getSharedData() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets a clone of the renderer data
         ///
@@ -267,10 +304,33 @@ namespace tgui
         std::shared_ptr<RendererData> clone() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Postpones copying the shared data until a property of the renderer is changed
+        ///
+        /// @param id  Identifier of the subscribed callback function that has to be moved to the copied data,
+        ///            or a nullptr to no longer copy the data when changing a property
+        ///
+        /// Widget::getRenderer uses this so that widgets of which the renderer is only read keep sharing the data.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void copyOnWrite(const void* id);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Gives the renderer its own copy of the data if it was still waiting for the first change to copy it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void detachData() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        std::shared_ptr<RendererData> m_data = RendererData::create();
+        // The data is mutable because getters that return a reference to the data have to copy it first
+        mutable std::shared_ptr<RendererData> m_data = RendererData::create();
+        mutable const void* m_copyOnWriteId = nullptr;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -365,6 +365,19 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether emitting the signal would call at least one signal handler
+        ///
+        /// @return Is the signal enabled and are there handlers connected to it?
+        ///
+        /// Widgets use this to avoid calculating the parameters of a signal that nobody is listening to.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isConnected() const
+        {
+            return m_enabled && !m_handlers.empty();
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Checks whether the unbound parameters match with this signal
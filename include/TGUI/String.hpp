@@ -80,6 +80,29 @@ namespace tgui
     TGUI_API float strToFloat(const std::string& str, float defaultValue = 0);
 
 
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Parses a number at the start of a range of characters. This doesn't allocate memory and doesn't depend on the
+        // global locale. The same strings are accepted as by the std::from_chars (C++17) or std::stoi and std::stof (C++14)
+        // that strToInt and strToFloat used before, parsing stops at the first character that can't be part of the number.
+        // Returns a pointer to the character after the number, or nullptr when there was no number or when it didn't fit
+        // in the type.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_API const char* parseInt(const char* begin, const char* end, int& value);
+        TGUI_API const char* parseUInt(const char* begin, const char* end, unsigned int& value);
+        TGUI_API const char* parseFloat(const char* begin, const char* end, float& value);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Returns a pointer to the first character that isn't whitespace, for callers that used to trim the string before
+        // parsing a number from it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_API const char* skipWhitespace(const char* begin, const char* end);
+    }
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Converts a string to lowercase
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -29,10 +29,14 @@
 
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/Animation.hpp>
+#include <TGUI/AnimationManager.hpp>
 #include <TGUI/Widget.hpp>
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/Gui.hpp>
+#include <TGUI/TextBuffer.hpp>
+#include <TGUI/TextLineList.hpp>
+#include <TGUI/WidgetPool.hpp>
 
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/Serializer.hpp>
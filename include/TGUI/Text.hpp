@@ -31,7 +31,9 @@
 #include <TGUI/Vector2f.hpp>
 #include <TGUI/TextStyle.hpp>
 #include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 #include <SFML/Graphics/Transformable.hpp>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -129,6 +131,26 @@ namespace tgui
         static sf::String wordWrap(float maxWidth, const sf::String& text, Font font, unsigned int textSize, bool bold, bool dropLeadingSpace = true);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// Takes a string and inserts newlines into it so that the width does not exceed maxWidth.
+        ///
+        /// @param maxWidth         Maximum width of the text
+        /// @param text             The text to wrap
+        /// @param font             Font of the text
+        /// @param textSize         The text size
+        /// @param bold             Should the text be bold?
+        /// @param dropLeadingSpace Should a single space at the beginning of a line be removed?
+        /// @param minimumWidth     Is set to the smallest maximum width that would give the same result
+        /// @param maximumWidth     Is set to the value above which the maximum width would give a different result
+        ///
+        /// The returned string is identical for every maximum width in the range [minimumWidth, maximumWidth), which allows
+        /// callers to reuse the result when the available width changes. When maxWidth is 0, both values are set to 0.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static sf::String wordWrap(float maxWidth, const sf::String& text, Font font, unsigned int textSize, bool bold, bool dropLeadingSpace,
+                                   float& minimumWidth, float& maximumWidth);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -347,15 +369,43 @@ namespace tgui
         void recalculateSize();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the color of the existing vertices after the color or opacity changed, without recreating them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVertexColors();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recreates the vertices of the glyphs if the string, font or style changed since the last time they were created.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateGeometry() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
-        sf::Text     m_text;
+        sf::String   m_string;
+        unsigned int m_characterSize = 30;
+        TextStyle    m_style = sf::Text::Regular;
+        float        m_outlineThickness = 0;
         Vector2f     m_size;
         Font         m_font;
         Color        m_color;
         Color        m_outlineColor;
         float        m_opacity = 1;
+
+        sf::Color m_fillColorCached = sf::Color::White;
+        sf::Color m_outlineColorCached = sf::Color::Black;
+
+        // The vertices are only recreated when needed and reuse their memory, color changes modify them in place
+        mutable std::vector<sf::Vertex> m_vertices;
+        mutable std::vector<sf::Vertex> m_outlineVertices;
+        mutable bool m_geometryNeedUpdate = false;
+
+        // Font texture for which the vertices were created. The glyphs may be placed elsewhere in the texture when the font
+        // gets reloaded, so the vertices are recreated when the texture no longer matches.
+        mutable const sf::Texture* m_fontTexture = nullptr;
+        mutable unsigned int m_fontTextureHandle = 0;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,266 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_TEXT_BUFFER_HPP
+#define TGUI_TEXT_BUFFER_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/String.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Editable text that is stored as a piece table
+    ///
+    /// The text that was set with setText is kept in an original buffer and all inserted text is appended to a second buffer.
+    /// The contents of the text is described by a sequence of pieces that each refer to a part of one of these buffers.
+    /// The pieces are stored in a balanced tree that knows the amount of characters and line breaks in every subtree, so
+    /// inserting and erasing characters and looking up where a line starts takes O(log n) time, no matter how long the text is.
+    ///
+    /// The text never needs to exist in one piece in memory, getText and getSubstring only build the requested part of it.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TextBuffer
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor that creates an empty text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextBuffer() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor that initializes the buffer with a text
+        ///
+        /// @param text  Initial contents of the buffer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit TextBuffer(const sf::String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the entire contents of the buffer
+        ///
+        /// @param text  New contents of the buffer
+        ///
+        /// All memory that was used for earlier edits is released.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setText(const sf::String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the entire contents of the buffer
+        ///
+        /// @return Copy of the text, which is built from all pieces each time this function is called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String getText() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a part of the text
+        ///
+        /// @param pos    Index of the first character
+        /// @param count  Maximum amount of characters to return
+        ///
+        /// @return Characters in the range [pos, pos + count), or less when the text ends before that
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String getSubstring(std::size_t pos, std::size_t count = sf::String::InvalidPos) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a single character
+        ///
+        /// @param pos  Index of the character, which must be smaller than getSize()
+        ///
+        /// @return Character at the given index
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::uint32_t getCharacter(std::size_t pos) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of characters in the text
+        ///
+        /// @return Length of the text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the text is empty
+        ///
+        /// @return Does the buffer contain no characters?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isEmpty() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Inserts characters in the text
+        ///
+        /// @param pos   Index of the character in front of which the text should be inserted, or getSize() to append it
+        /// @param text  Characters to insert
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insert(std::size_t pos, const sf::String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes characters from the text
+        ///
+        /// @param pos    Index of the first character to remove
+        /// @param count  Maximum amount of characters to remove
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void erase(std::size_t pos, std::size_t count = 1);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of lines in the text
+        ///
+        /// @return One more than the amount of newline characters in the text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getLineCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the index of the first character of a line
+        ///
+        /// @param line  Index of the line, which must be smaller than getLineCount()
+        ///
+        /// @return Index of the character that follows the newline in front of the line, or 0 for the first line
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getLineStart(std::size_t line) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of characters on a line
+        ///
+        /// @param line  Index of the line, which must be smaller than getLineCount()
+        ///
+        /// @return Length of the line, not counting the newline character at the end of it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getLineLength(std::size_t line) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the line on which a character is located
+        ///
+        /// @param pos  Index of the character, getSize() is allowed as well
+        ///
+        /// @return Amount of newline characters in front of the given index
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getLineOfPosition(std::size_t pos) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of pieces that the text currently consists of
+        ///
+        /// @return Number of pieces
+        ///
+        /// Characters that are typed one after another are added to the same piece, so this number only grows when editing
+        /// at different locations in the text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getPieceCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an estimate of the amount of memory used by the buffer
+        ///
+        /// @return Amount of bytes that are allocated for the characters, the line break indices and the pieces
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getMemoryUsage() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        static constexpr std::size_t NoNode = static_cast<std::size_t>(-1);
+
+        struct Piece
+        {
+            std::size_t start = 0;      // Index of the first character in the buffer
+            std::size_t length = 0;     // Amount of characters in the piece
+            std::size_t lineBreaks = 0; // Amount of newline characters in the piece
+            std::size_t subtreeLength = 0;
+            std::size_t subtreeLineBreaks = 0;
+            std::size_t left = NoNode;
+            std::size_t right = NoNode;
+            std::uint32_t priority = 0;
+            bool added = false;         // Does the piece refer to m_addedBuffer instead of m_originalBuffer?
+        };
+
+        // Creates a new node for a piece that refers to the given part of one of the buffers
+        std::size_t createPiece(bool added, std::size_t start, std::size_t length);
+
+        // Returns the node and all nodes in its subtree to the list of unused nodes
+        void releasePieces(std::size_t node);
+
+        // Recalculates the subtree values of the node after one of its children changed
+        void updatePiece(std::size_t node);
+
+        // Splits the tree so that the first pos characters end up in the left tree and the remaining ones in the right tree
+        void split(std::size_t node, std::size_t pos, std::size_t& left, std::size_t& right);
+
+        // Joins two trees, the characters of the left tree are placed in front of the ones from the right tree
+        std::size_t merge(std::size_t left, std::size_t right);
+
+        // Makes the piece that ends at the given position longer when it ends at the back of the added buffer
+        bool extendPieceEndingAt(std::size_t node, std::size_t pos, std::size_t length, std::size_t lineBreaks, std::size_t addedStart);
+
+        // Appends the characters in the range [pos, pos + count) of the subtree to the string
+        void appendCharacters(std::size_t node, std::size_t pos, std::size_t count, std::basic_string<std::uint32_t>& str) const;
+
+        // Counts the newline characters in a part of one of the buffers
+        std::size_t countLineBreaks(bool added, std::size_t start, std::size_t length) const;
+
+        // Returns a pseudo-random priority for a new node
+        std::uint32_t generatePriority();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::basic_string<std::uint32_t> m_originalBuffer;
+        std::basic_string<std::uint32_t> m_addedBuffer;
+
+        // Positions of all newline characters inside both buffers, these lists are always sorted
+        std::vector<std::size_t> m_originalLineBreaks;
+        std::vector<std::size_t> m_addedLineBreaks;
+
+        std::vector<Piece> m_pieces;
+        std::vector<std::size_t> m_unusedPieces;
+        std::size_t m_root = NoNode;
+        std::uint32_t m_randomState = 0x2545F491;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TEXT_BUFFER_HPP
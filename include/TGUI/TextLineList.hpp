@@ -0,0 +1,224 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_TEXT_LINE_LIST_HPP
+#define TGUI_TEXT_LINE_LIST_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/Config.hpp>
+#include <cstdint>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief List of the lines that are displayed for a text, where a line of the text may be split over several lines
+    ///
+    /// The lines are stored in a balanced tree. A line doesn't store the index of the line in the text to which it belongs,
+    /// it only remembers whether it is the first displayed line of it. The index is derived from the amount of such lines in
+    /// front of it, which every subtree keeps track of. Replacing the lines of a part of the text thus doesn't require the
+    /// lines behind it to be renumbered, and accessing, finding and replacing lines takes O(log n) time.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TextLineList
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Part of a line in the text that is displayed on its own line
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Line
+        {
+            std::size_t textLine; ///< Index of the line in the text to which this line belongs
+            std::size_t offset;   ///< Index of the first character, relative to the start of the line in the text
+            std::size_t length;   ///< Amount of characters on the line
+            float width;          ///< Width of the line, or 0 when the width isn't needed
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces all lines
+        ///
+        /// @param lines  New lines, the first one has to belong to line 0 of the text and the index of the line in the text
+        ///               may only increase by one between consecutive lines
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void assign(const std::vector<Line>& lines);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all lines
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of displayed lines
+        ///
+        /// @return Number of lines in the list
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t size() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the list contains no lines
+        ///
+        /// @return Is the list empty?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool empty() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a line
+        ///
+        /// @param index  Index of the line, which must be smaller than size()
+        ///
+        /// @return Copy of the line, including the index of the line in the text to which it belongs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Line operator[](std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the first displayed line of a line in the text
+        ///
+        /// @param textLine  Index of the line in the text
+        ///
+        /// @return Index of the first line that belongs to the line in the text, or size() when there are less lines in the text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findFirstLine(std::size_t textLine) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the first displayed line of a line in the text that doesn't end before the given offset in that line
+        ///
+        /// @param textLine  Index of the line in the text
+        /// @param offset    Index of the character, relative to the start of the line in the text
+        ///
+        /// @return Index of the line. When all lines of the text line end in front of the offset, the index of the line behind
+        ///         them is returned, which may be size().
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findLine(std::size_t textLine, std::size_t offset) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the lines in the range [first, last) with other lines
+        ///
+        /// @param first  Index of the first line to replace
+        /// @param last   Index behind the last line to replace
+        /// @param lines  New lines, their index of the line in the text has to match the position where they are inserted
+        ///
+        /// The replaced range has to consist of all displayed lines of one or more lines in the text. The lines behind the
+        /// range automatically get a different index of their line in the text when the new lines belong to more or less
+        /// lines in the text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void replace(std::size_t first, std::size_t last, const std::vector<Line>& lines);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the largest width of all lines
+        ///
+        /// @return Width of the widest line, or 0 when the list is empty
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getMaxWidth() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the largest amount of characters on a line
+        ///
+        /// @return Length of the longest line, or 0 when the list is empty
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getMaxLength() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the line with the most characters
+        ///
+        /// @return Index of the first line of which the length equals getMaxLength(), or 0 when the list is empty
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findLongestLine() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        static constexpr std::size_t NoNode = static_cast<std::size_t>(-1);
+
+        struct Node
+        {
+            std::size_t offset = 0;
+            std::size_t length = 0;
+            float width = 0;
+            bool startsTextLine = false; // Is this the first displayed line of a line in the text?
+            std::uint32_t priority = 0;
+            std::size_t left = NoNode;
+            std::size_t right = NoNode;
+            std::size_t subtreeSize = 0;
+            std::size_t subtreeTextLines = 0; // Amount of nodes in the subtree for which startsTextLine is true
+            std::size_t subtreeMaxLength = 0;
+            float subtreeMaxWidth = 0;
+        };
+
+        // Creates a new node for a line, the index of the line in the text isn't stored
+        std::size_t createNode(const Line& line, bool startsTextLine);
+
+        // Returns the node and all nodes in its subtree to the list of unused nodes
+        void releaseNodes(std::size_t node);
+
+        // Recalculates the subtree values of the node after one of its children changed
+        void updateNode(std::size_t node);
+
+        // Recalculates the subtree values of all nodes in the subtree, children are updated before their parent
+        void updateSubtree(std::size_t node);
+
+        // Splits the tree so that the first count lines end up in the left tree and the remaining ones in the right tree
+        void split(std::size_t node, std::size_t count, std::size_t& left, std::size_t& right);
+
+        // Joins two trees, the lines of the left tree are placed in front of the ones from the right tree
+        std::size_t merge(std::size_t left, std::size_t right);
+
+        // Builds a tree from the lines in linear time and returns its root
+        std::size_t buildTree(const std::vector<Line>& lines, bool firstStartsTextLine);
+
+        // Returns a pseudo-random priority for a new node
+        std::uint32_t generatePriority();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::vector<Node> m_nodes;
+        std::vector<std::size_t> m_unusedNodes;
+        std::vector<std::size_t> m_buildStack;
+        std::size_t m_root = NoNode;
+        std::uint32_t m_randomState = 0x2545F491;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TEXT_LINE_LIST_HPP
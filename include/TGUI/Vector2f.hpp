@@ -102,8 +102,12 @@ namespace tgui
                 return;
             }
 
-            x = strToFloat(trim(str.substr(0, commaPos)));
-            y = strToFloat(trim(str.substr(commaPos + 1)));
+            // Parse the numbers directly from the string, without creating a new string per number
+            const char* const commaIt = str.data() + commaPos;
+            if (!priv::parseFloat(priv::skipWhitespace(str.data(), commaIt), commaIt, x))
+                x = 0;
+            if (!priv::parseFloat(priv::skipWhitespace(commaIt + 1, str.data() + str.length()), str.data() + str.length(), y))
+                y = 0;
         }
 
 
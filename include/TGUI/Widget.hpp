@@ -47,6 +47,8 @@
 #include <SFML/Graphics/RenderTarget.hpp>
 
 #include <unordered_set>
+#include <memory>
+#include <atomic>
 
 #if TGUI_COMPILED_WITH_CPP_VER >= 17
     #include <any>
@@ -64,6 +66,27 @@ namespace tgui
     namespace priv
     {
         class Animation;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Name of a widget type. The string itself is stored only once and shared by all widgets of the same type.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API WidgetTypeName
+        {
+        public:
+            WidgetTypeName() = default;
+            WidgetTypeName(const char* type);
+            WidgetTypeName(const std::string& type);
+
+            const std::string& get() const;
+
+            operator const std::string&() const
+            {
+                return get();
+            }
+
+        private:
+            const std::string* m_type = nullptr;
+        };
     }
 
 
@@ -186,6 +209,9 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Vector2f getPosition() const
         {
+            if (m_queuedLayoutUpdateCount > 0)
+                updateQueuedLayoutsOfGui();
+
             return m_position.getValue();
         }
 
@@ -231,6 +257,9 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Vector2f getSize() const
         {
+            if (m_queuedLayoutUpdateCount > 0)
+                updateQueuedLayoutsOfGui();
+
             return m_size.getValue();
         }
 
@@ -438,7 +467,7 @@ namespace tgui
         void setUserData(tgui::Any userData)
 #endif
         {
-            m_userData = std::move(userData);
+            getRareData().userData = std::move(userData);
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -450,9 +479,15 @@ namespace tgui
         T getUserData() const
         {
 #if TGUI_COMPILED_WITH_CPP_VER >= 17
-            return std::any_cast<T>(m_userData);
+            if (!m_rareData)
+                throw std::bad_any_cast();
+
+            return std::any_cast<T>(m_rareData->userData);
 #else
-            return m_userData.as<T>();
+            if (!m_rareData)
+                throw std::bad_cast();
+
+            return m_rareData->userData.template as<T>();
 #endif
         }
 
@@ -590,6 +625,38 @@ namespace tgui
         virtual void update(sf::Time elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the gui that the widget changed and that the screen should be redrawn
+        ///
+        /// Changes made via the functions of the widget already call this function. You only have to call it yourself when
+        /// changing something in a custom widget that the gui can't know about (see Gui::needsRedraw).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Informs the gui that the widget wants its update function to be called again after the given time (e.g. to blink
+        /// a caret). This should be called from inside the update function, as pending requests are cleared before each update.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void requestWakeup(sf::Time delay);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Asks the gui to update the layout of the container before the widgets are drawn or before the position or size of
+        /// any widget is requested. Returns false when the widget isn't part of a gui, in which case nothing was queued.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool queueLayoutUpdate(const std::shared_ptr<Container>& container);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Updates the layouts that were queued in the gui to which the widget belongs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void updateQueuedLayouts();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         /// @return Is the mouse on top of the widget?
@@ -819,6 +886,39 @@ namespace tgui
         virtual void mouseLeftWidget();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether everything that the widget draws lies inside the rectangle given by getWidgetOffset and getFullSize.
+        // The parent skips drawing the widget when that rectangle lies outside the visible area.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isDrawnInsideBounds() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the layouts of other widgets that depend on the position or size of this widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recalculateBoundPositionLayouts();
+        void recalculateBoundSizeLayouts();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the layouts of other widgets that depend on the position or size of this widget to no longer refer to it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unbindLayouts();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the rarely used members, allocating them when this is the first time they are needed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct RareData;
+        RareData& getRareData();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the queued layouts before the position or size of the widget is returned, as they may change them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateQueuedLayoutsOfGui() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draw a rectangle shape with the right opacity
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -847,6 +947,12 @@ namespace tgui
         void rendererChangedCallback(const std::string& property);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Subscribes to changes of the renderer so that rendererChangedCallback gets called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void subscribeToRenderer();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -862,7 +968,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        std::string m_type;
+        priv::WidgetTypeName m_type;
         sf::String m_name;
 
         Layout2d m_position;
@@ -874,10 +980,6 @@ namespace tgui
         Vector2f m_prevPosition;
         Vector2f m_prevSize;
 
-        // Layouts that need to recalculate their value when the position or size of this widget changes
-        std::unordered_set<Layout*> m_boundPositionLayouts;
-        std::unordered_set<Layout*> m_boundSizeLayouts;
-
         // When a widget is disabled, it will no longer receive events
         bool m_enabled = true;
 
@@ -897,6 +999,12 @@ namespace tgui
         // Can the widget be focused?
         bool m_focusable = true;
 
+        // Set while the animation manager changes several properties, the widget is invalidated only once afterwards
+        bool m_invalidationDeferred = false;
+
+        // Amount of layout updates that are queued in all guis, the getters only have to look for them when this isn't 0
+        static std::atomic<unsigned int> m_queuedLayoutUpdateCount;
+
         // Keep track of the elapsed time.
         sf::Time m_animationTimeElapsed;
 
@@ -906,15 +1014,9 @@ namespace tgui
         // This is set to true for widgets that store other widgets inside them
         bool m_containerWidget = false;
 
-        // The tool tip connected to the widget
-        Widget::Ptr m_toolTip = nullptr;
-
         // Renderer of the widget
         aurora::CopiedPtr<WidgetRenderer> m_renderer = aurora::makeCopied<WidgetRenderer>();
 
-        // Show animations
-        std::vector<std::shared_ptr<priv::Animation>> m_showAnimations;
-
         // Renderer properties that can be passed from containers to their children
         Font m_inheritedFont;
         float m_inheritedOpacity = 1;
@@ -924,18 +1026,33 @@ namespace tgui
         float m_opacityCached = 1;
         bool m_transparentTextureCached = false;
 
+        // Members that most widgets never use. They are only allocated when one of them is needed, to keep widgets small.
+        struct RareData
+        {
+            // Layouts that need to recalculate their value when the position or size of this widget changes
+            std::unordered_set<Layout*> boundPositionLayouts;
+            std::unordered_set<Layout*> boundSizeLayouts;
+
+            // Show animations
+            std::vector<std::shared_ptr<priv::Animation>> showAnimations;
+
+            // The tool tip connected to the widget
+            Widget::Ptr toolTip;
+
 #if TGUI_COMPILED_WITH_CPP_VER >= 17
-        std::any m_userData;
+            std::any userData;
 #else
-        tgui::Any m_userData;
+            tgui::Any userData;
 #endif
-
-        std::function<void(const std::string& property)> m_rendererChangedCallback = [this](const std::string& property){ rendererChangedCallback(property); };
+        };
+        std::unique_ptr<RareData> m_rareData;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         friend class Container; // Container accesses m_mouseDown, m_draggableWidget, save and load
+        template <typename WidgetType> friend class WidgetPool; // WidgetPool clears the user data of recycled widgets
+        friend class AnimationManager; // AnimationManager defers the invalidation while applying animated values
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
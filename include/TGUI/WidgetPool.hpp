@@ -0,0 +1,226 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_WIDGET_POOL_HPP
+#define TGUI_WIDGET_POOL_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/Widget.hpp>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Recycles widgets of a single type for interfaces that create and destroy many widgets
+    ///
+    /// When the last pointer to a widget that was created by the pool is released, the widget isn't destroyed but is reset
+    /// to the state of the prototype widget and kept in the pool. Creating a widget afterwards reuses it, so the widget
+    /// keeps its allocated memory (e.g. the text buffers) and doesn't have to be constructed and themed again.
+    ///
+    /// Resetting a widget uses the copy assignment of the widget: connected signal handlers are removed, the renderer is
+    /// shared with the prototype again and the user data is cleared.
+    ///
+    /// @code
+    /// tgui::WidgetPool<tgui::Label> pool;
+    /// auto label = pool.create();
+    /// label->setText("Price");
+    /// gui.add(label);
+    /// ...
+    /// gui.remove(label);
+    /// label = nullptr; // The label is returned to the pool
+    /// @endcode
+    ///
+    /// The pool may be destroyed before the widgets that it created, those widgets are then destroyed normally.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename WidgetType>
+    class WidgetPool
+    {
+    public:
+
+        typedef std::shared_ptr<WidgetType> Ptr; ///< Shared widget pointer
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs a pool that resets its widgets to a newly created widget
+        ///
+        /// @param maximumPooledWidgets  Maximum amount of unused widgets that are kept in the pool
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit WidgetPool(std::size_t maximumPooledWidgets = 256) :
+            WidgetPool{*WidgetType::create(), maximumPooledWidgets}
+        {
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs a pool that resets its widgets to a copy of the given widget
+        ///
+        /// @param prototype             Widget of which every created widget will be a copy
+        /// @param maximumPooledWidgets  Maximum amount of unused widgets that are kept in the pool
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit WidgetPool(const WidgetType& prototype, std::size_t maximumPooledWidgets = 256) :
+            m_pool{std::make_shared<Pool>(prototype, maximumPooledWidgets)}
+        {
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a widget, or reuses one that was returned to the pool
+        ///
+        /// @return Widget that is equal to the prototype
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Ptr create()
+        {
+            std::unique_ptr<WidgetType> widget;
+            if (!m_pool->widgets.empty())
+            {
+                widget = std::move(m_pool->widgets.back());
+                m_pool->widgets.pop_back();
+            }
+            else
+                widget = std::make_unique<WidgetType>(m_pool->prototype);
+
+            return Ptr{widget.release(), Recycler{m_pool}};
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Fills the pool so that the given amount of widgets can be created without constructing new widgets
+        ///
+        /// @param count  Amount of unused widgets that should be available in the pool (limited by the maximum pool size)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void reserve(std::size_t count)
+        {
+            count = std::min(count, m_pool->maximumPooledWidgets);
+            m_pool->widgets.reserve(count);
+            while (m_pool->widgets.size() < count)
+                m_pool->widgets.push_back(std::make_unique<WidgetType>(m_pool->prototype));
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of unused widgets that are currently kept in the pool
+        ///
+        /// @return Number of widgets that can be created without constructing a new widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getPooledWidgetCount() const
+        {
+            return m_pool->widgets.size();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum amount of unused widgets that are kept in the pool
+        ///
+        /// @param maximumPooledWidgets  Maximum pool size, widgets that are released while the pool is full are destroyed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMaximumPooledWidgets(std::size_t maximumPooledWidgets)
+        {
+            m_pool->maximumPooledWidgets = maximumPooledWidgets;
+            if (m_pool->widgets.size() > maximumPooledWidgets)
+                m_pool->widgets.resize(maximumPooledWidgets);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of unused widgets that are kept in the pool
+        ///
+        /// @return Maximum pool size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getMaximumPooledWidgets() const
+        {
+            return m_pool->maximumPooledWidgets;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destroys all unused widgets that are kept in the pool
+        ///
+        /// Widgets that are still in use will return to the pool when they are released.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear()
+        {
+            m_pool->widgets.clear();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct Pool
+        {
+            Pool(const WidgetType& widget, std::size_t maximumSize) :
+                prototype           {widget},
+                maximumPooledWidgets{maximumSize}
+            {
+            }
+
+            WidgetType prototype;
+            std::size_t maximumPooledWidgets;
+            std::vector<std::unique_ptr<WidgetType>> widgets;
+        };
+
+        // Deleter of the shared pointers that are returned by create, it puts the widget back in the pool
+        struct Recycler
+        {
+            void operator()(WidgetType* widget) const
+            {
+                std::unique_ptr<WidgetType> widgetPtr{widget};
+
+                const auto pool = weakPool.lock();
+                if (!pool || (pool->widgets.size() >= pool->maximumPooledWidgets))
+                    return;
+
+                *widgetPtr = pool->prototype;
+
+                // The copy assignment keeps the user data, but a recycled widget shouldn't remember its previous use
+                if (widgetPtr->m_rareData)
+                {
+#if TGUI_COMPILED_WITH_CPP_VER >= 17
+                    widgetPtr->m_rareData->userData.reset();
+#else
+                    widgetPtr->m_rareData->userData = tgui::Any{};
+#endif
+                }
+
+                pool->widgets.push_back(std::move(widgetPtr));
+            }
+
+            std::weak_ptr<Pool> weakPool;
+        };
+
+        std::shared_ptr<Pool> m_pool;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_WIDGET_POOL_HPP
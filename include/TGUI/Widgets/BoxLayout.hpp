@@ -149,7 +149,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // @brief Repositions and resize the widgets
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual void updateWidgets() = 0;
+        void updateWidgets() override = 0;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,14 @@
 #include <TGUI/Widgets/ClickableWidget.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+    #include <SFML/Graphics/VertexBuffer.hpp>
+#endif
+
+#include <vector>
+#include <memory>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -209,6 +217,145 @@ namespace tgui
         void display();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a layer with its own texture on top of the existing layers
+        ///
+        /// @return Index of the new layer
+        ///
+        /// The contents of the canvas that are drawn with the functions without a layer parameter form layer 0.
+        /// Layers are drawn on top of each other when the canvas is drawn, so a layer only has to be redrawn when its own
+        /// contents change. A new layer is fully transparent.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t addLayer();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a layer with static geometry on top of the existing layers
+        ///
+        /// @param vertices     Pointer to the vertices
+        /// @param vertexCount  Number of vertices in the array
+        /// @param type         Type of primitives to draw
+        /// @param texture      Texture that is used by the vertices, or a nullptr when the vertices aren't textured
+        ///
+        /// @return Index of the new layer
+        ///
+        /// The vertices are uploaded to a vertex buffer once (when vertex buffers are supported), instead of being drawn on
+        /// a texture. The positions of the vertices are relative to the top left corner of the canvas and the view of the
+        /// canvas isn't used. The opacity of the canvas is also not applied to geometry layers.
+        ///
+        /// @warning When a texture is passed, it has to remain alive as long as the layer exists.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t addGeometryLayer(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::Texture* texture = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces a part of the vertices in a geometry layer
+        ///
+        /// @param layer        Index of the geometry layer
+        /// @param vertices     Pointer to the new vertices
+        /// @param vertexCount  Number of vertices to replace
+        /// @param offset       Index of the first vertex to replace
+        ///
+        /// When offset is 0, the layer is resized to contain vertexCount vertices. Otherwise the vertices have to lie within the
+        /// layer. Only the given vertices are uploaded, the other vertices in the layer remain unchanged.
+        ///
+        /// @return True when the vertices were updated, false when the layer wasn't a geometry layer or the range was invalid
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateGeometry(std::size_t layer, const sf::Vertex* vertices, std::size_t vertexCount, std::size_t offset = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes a layer
+        ///
+        /// @param layer  Index of the layer to remove, the layers above it move down by one index
+        ///
+        /// @return True when the layer was removed, false when the index was invalid or was 0
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool removeLayer(std::size_t layer);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of layers in the canvas, including layer 0
+        ///
+        /// @return Number of layers
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getLayerCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether a layer is drawn
+        ///
+        /// @param layer    Index of the layer
+        /// @param visible  Should the layer be drawn?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setLayerVisible(std::size_t layer, bool visible);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a layer is drawn
+        ///
+        /// @param layer  Index of the layer
+        ///
+        /// @return Is the layer visible? False is returned when the index was invalid.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isLayerVisible(std::size_t layer) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Clears a layer
+        ///
+        /// @param layer  Index of a layer that was created with addLayer, or 0 for the main contents of the canvas
+        /// @param color  Fill color to use to clear the layer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear(std::size_t layer, Color color = Color::Transparent);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Clears a part of a layer and limits drawing on the layer to that part until display is called for the layer
+        ///
+        /// @param layer  Index of a layer that was created with addLayer, or 0 for the main contents of the canvas
+        /// @param rect   Part of the layer that is going to be redrawn, in pixels relative to the top left of the canvas
+        /// @param color  Fill color to use to clear the part of the layer
+        ///
+        /// This allows redrawing only the part of a layer that changed. The rest of the layer keeps its contents.
+        /// Limiting the drawing isn't possible while the view of the layer is rotated, only the clearing happens then.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear(std::size_t layer, const sf::FloatRect& rect, Color color = Color::Transparent);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws drawable objects to a layer
+        ///
+        /// @param layer     Index of a layer that was created with addLayer, or 0 for the main contents of the canvas
+        /// @param drawable  Object to draw
+        /// @param states    Render states to use for drawing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void draw(std::size_t layer, const sf::Drawable& drawable, const sf::RenderStates& states = sf::RenderStates::Default);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws primitives defined by an array of vertices to a layer
+        ///
+        /// @param layer        Index of a layer that was created with addLayer, or 0 for the main contents of the canvas
+        /// @param vertices     Pointer to the vertices
+        /// @param vertexCount  Number of vertices in the array
+        /// @param type         Type of primitives to draw
+        /// @param states       Render states to use for drawing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void draw(std::size_t layer, const sf::Vertex* vertices, std::size_t vertexCount,
+                  sf::PrimitiveType type, const sf::RenderStates& states = sf::RenderStates::Default);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Updates the contents of a layer
+        ///
+        /// @param layer  Index of a layer that was created with addLayer, or 0 for the main contents of the canvas
+        ///
+        /// Just like the display function without parameter, this has to be called after drawing on the layer.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void display(std::size_t layer);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
         ///
@@ -262,11 +409,55 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // The first layer uses m_renderTexture and m_sprite, the other layers have their own texture or vertices
+        struct Layer
+        {
+            bool geometry = false;
+            std::unique_ptr<sf::RenderTexture> renderTexture; // Only for layers created with addLayer
+            sf::Sprite sprite;
+
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+            sf::VertexBuffer vertexBuffer;
+#endif
+            std::vector<sf::Vertex> vertices; // Only filled when vertex buffers aren't supported
+            std::size_t vertexCount = 0;
+            sf::PrimitiveType primitiveType = sf::PrimitiveType::Points;
+            const sf::Texture* texture = nullptr;
+
+            bool visible = true;
+            bool clipped = false; // Is the view temporarily replaced to only draw in part of the layer?
+            sf::View unclippedView;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the render texture of a layer, or a nullptr when the index is invalid or belongs to a geometry layer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::RenderTexture* getLayerRenderTexture(std::size_t layer);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure the render texture of a layer is large enough for the canvas and clears it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resizeLayer(Layer& layer, Vector2f size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the layers of another canvas. The contents of texture layers aren't copied, just like for layer 0.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void copyLayers(const Canvas& other);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         sf::RenderTexture m_renderTexture;
         sf::Sprite        m_sprite;
+
+        std::vector<std::unique_ptr<Layer>> m_layers;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -30,7 +30,7 @@
 #include <TGUI/Renderers/EditBoxRenderer.hpp>
 #include <TGUI/FloatRect.hpp>
 #include <TGUI/Text.hpp>
-#include <regex>
+#include <TGUI/InputValidator.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -76,11 +76,13 @@ namespace tgui
             static inline const std::string Int   = "[+-]?[0-9]*";           ///< Accept negative and positive integers
             static inline const std::string UInt  = "[0-9]*";                ///< Accept only positive integers
             static inline const std::string Float = "[+-]?[0-9]*\\.?[0-9]*"; ///< Accept decimal numbers
+            static inline const std::string Hex   = "[0-9a-fA-F]*";          ///< Accept hexadecimal numbers
 #else
             static TGUI_API const std::string All;   ///< Accept any input
             static TGUI_API const std::string Int;   ///< Accept negative and positive integers
             static TGUI_API const std::string UInt;  ///< Accept only positive integers
             static TGUI_API const std::string Float; ///< Accept decimal numbers
+            static TGUI_API const std::string Hex;   ///< Accept hexadecimal numbers
 #endif
         };
 
@@ -366,13 +368,15 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Defines how the text input should look like
         ///
-        /// @param regex  Valid regular expression for std::regex to match on text changes
+        /// @param regex  Valid ECMAScript regular expression to match on text changes
         ///
-        /// @return True when validator was changed, false when std::regex_error was thrown internally.
+        /// @return True when validator was changed, false when the regular expression was invalid.
         ///
         /// When the regex does not match when calling the setText function then the edit box contents will be cleared.
         /// When it does not match when the user types a character in the edit box, then the input character is rejected.
         ///
+        /// The regular expression is compiled once into a state machine, see the InputValidator class for the supported syntax.
+        ///
         /// Examples:
         /// @code
         /// edit1->setInputValidator(EditBox::Validator::Int);
@@ -581,8 +585,7 @@ namespace tgui
         // The text inside the edit box
         sf::String    m_text;
 
-        std::string   m_regexString = ".*";
-        std::regex    m_regex = std::regex{m_regexString};
+        InputValidator m_inputValidator;
 
         // The text alignment
         Alignment     m_textAlignment = Alignment::Left;
@@ -345,6 +345,12 @@ namespace tgui
         Vector2f getMinimumSize() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns false because the child widgets aren't clipped and may lie outside the grid
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDrawnInsideBounds() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Reposition all the widgets.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -354,7 +360,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the position and size of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateWidgets();
+        void updateWidgets() override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -391,6 +391,38 @@ namespace tgui
         void rearrangeText();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rearranges the text immediately when auto-sizing, otherwise the text is only rearranged once before it is needed.
+        // This happens in update, which the gui calls right before drawing, or when the label receives a mouse event.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void requestRearrangeText();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the text with newlines inserted for the given width, results are reused while the width stays in a range
+        // for which the word-wrap would give the same result.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::String& getWrappedText(float maxWidth);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the Text objects for the lines that lie inside the visible part of the label
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleLines(bool forceRebuild = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the Text objects for the lines in the range [firstLine, lastLine) of the wrapped text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void createLines(std::size_t firstLine, std::size_t lastLine);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sets the position of the Text objects based on the alignment
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void positionLines();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -412,6 +444,27 @@ namespace tgui
         sf::String m_string;
         std::vector<Text> m_lines;
 
+        // The text after word-wrapping and the index in it where each line starts. Text objects are only created for the lines
+        // that are visible, m_lines contains the lines starting from m_firstVisibleLine.
+        sf::String m_wrappedString;
+        std::vector<std::size_t> m_lineStarts;
+        std::size_t m_firstVisibleLine = 0;
+        Vector2f m_linesPosition;
+
+        // Word-wrapped versions of the text, each valid for all widths in the range [minimumWidth, maximumWidth)
+        struct WrapCacheEntry
+        {
+            float minimumWidth;
+            float maximumWidth;
+            sf::String wrappedString;
+        };
+        std::vector<WrapCacheEntry> m_wrapCache;
+        Font m_wrapCacheFont;
+        unsigned int m_wrapCacheTextSize = 0;
+        bool m_wrapCacheBold = false;
+
+        bool m_rearrangeTextPending = false;
+
         HorizontalAlignment m_horizontalAlignment = HorizontalAlignment::Left;
         VerticalAlignment m_verticalAlignment = VerticalAlignment::Top;
 
@@ -457,6 +457,20 @@ namespace tgui
         bool containsId(const sf::String& id) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the index of the first item that starts with the given text, ignoring the case of the characters
+        ///
+        /// @param prefix  The text that the item should start with
+        ///
+        /// @return Lowest index of the items that start with the text, or -1 when no item starts with it
+        ///
+        /// The first search after the items were changed sorts an index of the items, after which every search only takes a
+        /// binary search. When the prefix extends the text of the previous search, only the matches of the previous search
+        /// are searched again. Typing while the list box is focused selects the item that is found with this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int findItemByPrefix(const sf::String& prefix) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the thumb position of the scrollbar
         ///
@@ -511,6 +525,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void leftMouseButtonNoLongerDown() override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void textEntered(std::uint32_t key) override;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
@@ -565,15 +584,27 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Update the colors and text style of the selected and hovered items
+        // Makes sure that the texts of the visible items are recreated the next time the list box is drawn
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateSelectedAndHoveringItemColorsAndStyle();
+        void updateItemColorsAndStyle();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Update the color and text style of all the items
+        // Creates the text objects for the items in the range [firstItem, lastItem), which are the items that are visible
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateItemColorsAndStyle();
+        void updateVisibleItemTexts(std::size_t firstItem, std::size_t lastItem) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the color of the text of an item, depending on whether it is selected and whether the mouse is on top of it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Color getItemTextColor(std::size_t item) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the items as changed, so that the visible texts and the index used by findItemByPrefix are rebuilt
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void itemsChanged();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -616,9 +647,26 @@ namespace tgui
     protected:
 
         // This contains the different items in the list box
-        std::vector<Text>       m_items;
+        std::vector<sf::String> m_items;
         std::vector<sf::String> m_itemIds;
 
+        // Only the visible items have a text object, they are (re)created when the list box is drawn
+        mutable std::vector<Text> m_visibleItemTexts;
+        mutable std::size_t m_firstVisibleItemText = 0;
+        mutable bool m_visibleItemTextsOutdated = true;
+
+        // Indices of the items sorted on their lowercase text, which is used by findItemByPrefix.
+        // The range of matches from the previous search is kept so that an extended prefix only has to search that range.
+        mutable std::vector<std::size_t> m_prefixIndex;
+        mutable bool m_prefixIndexOutdated = true;
+        mutable sf::String m_prefixSearchText;
+        mutable std::size_t m_prefixSearchBegin = 0;
+        mutable std::size_t m_prefixSearchEnd = 0;
+
+        // Characters that were typed while the list box was focused, they are forgotten when no key is typed for a second
+        sf::String m_typedSearchText;
+        sf::Time m_typedSearchTimeElapsed;
+
         // What is the index of the selected item?
         // This is also used by combo box, so it can't just be changed to a pointer!
         int m_selectedItem = -1;
@@ -41,6 +41,9 @@ namespace tgui
     /// @brief List view widget
     ///
     /// When no columns are added, the list view acts like a ListBox with a few extra functionalities.
+    ///
+    /// The rows can be sorted on a column and hidden with a filter. This only changes the order in which the items are
+    /// displayed: item indices passed to and returned by the list view always refer to the order in which the items were added.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API ListView : public Widget
     {
@@ -59,6 +62,16 @@ namespace tgui
             Right   ///< Place the text on the right side (e.g. for numbers)
         };
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief The way the texts in a column are compared when sorting on that column
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class ColumnSortType
+        {
+            String,  ///< Compare the texts character by character (default)
+            Numeric, ///< Compare the numbers in the texts, texts that don't start with a number are placed behind the numbers
+            Custom   ///< Compare the texts with the comparator passed to setColumnSortComparator
+        };
+
         struct Item
         {
             std::vector<Text> texts;
@@ -71,6 +84,8 @@ namespace tgui
             float designWidth = 0;
             Text text;
             ColumnAlignment alignment = ColumnAlignment::Left;
+            ColumnSortType sortType = ColumnSortType::String;
+            std::function<bool(const sf::String&, const sf::String&)> sortComparator;
         };
 
 
@@ -312,6 +327,36 @@ namespace tgui
         void removeAllItems();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Delays updating the scrollbar, the sorted order and the icon space until endBatchUpdate is called
+        ///
+        /// Every call to addItem, changeItem, changeSubItem or removeItem normally recalculates the scrollbar, scrolls down
+        /// when auto-scrolling is enabled and moves the item to its sorted position. When many items change at once (e.g. in a
+        /// table that is updated every frame), you can call this function first so that this only happens once.
+        ///
+        /// @code
+        /// listView->beginBatchUpdate();
+        /// for (const auto& change : changes)
+        ///     listView->changeSubItem(change.row, change.column, change.text);
+        /// listView->endBatchUpdate();
+        /// @endcode
+        ///
+        /// Calls can be nested, the list view is updated when the outermost batch ends. Until then the order in which the items
+        /// are displayed may be outdated, the list view shouldn't be drawn or receive events before the batch has ended.
+        ///
+        /// @see endBatchUpdate
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginBatchUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Ends a batch that was started with beginBatchUpdate and applies the postponed updates
+        ///
+        /// @see beginBatchUpdate
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void endBatchUpdate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Selects an item in the list view
         ///
@@ -457,6 +502,123 @@ namespace tgui
         void sort(std::size_t index, const std::function<bool(const sf::String&, const sf::String&)>& cmp);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how the texts in a column are compared when sorting on the column
+        ///
+        /// @param column  Index of the column
+        /// @param type    Whether the texts are compared as strings or as numbers
+        ///
+        /// To sort with your own comparison function, call setColumnSortComparator instead.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setColumnSortType(std::size_t column, ColumnSortType type);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how the texts in a column are compared when sorting on the column
+        ///
+        /// @param column  Index of the column
+        ///
+        /// @return Sort type of the column, or ColumnSortType::String when the column doesn't exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ColumnSortType getColumnSortType(std::size_t column) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets a function that compares the texts of two items when sorting on a column
+        ///
+        /// @param column      Index of the column
+        /// @param comparator  Function that returns true when the first text should be displayed before the second one
+        ///
+        /// This changes the sort type of the column to ColumnSortType::Custom.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setColumnSortComparator(std::size_t column, const std::function<bool(const sf::String&, const sf::String&)>& comparator);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Displays the items sorted on the texts in a column
+        ///
+        /// @param column     Index of the column to sort on (0 when the list view has no columns)
+        /// @param ascending  Should the smallest value be displayed on top?
+        ///
+        /// The sort is stable: items with equal texts remain in the order in which they were added. Only the order in which the
+        /// items are displayed changes, the items themselves aren't moved and keep their index. Items that are added or changed
+        /// later are inserted at their sorted position.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void sortByColumn(std::size_t column, bool ascending = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Displays the items in the order in which they were added again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clearSorting();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the column on which the items are sorted
+        ///
+        /// @return Index of the sort column or -1 when the items aren't sorted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getSortColumn() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the items are sorted in ascending order
+        ///
+        /// @return Is the smallest value displayed on top?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getSortAscending() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether clicking on a column header sorts the items on that column
+        ///
+        /// @param sortOnHeaderClick  Should clicking the header sort the items?
+        ///
+        /// Clicking the header of the column on which the items are already sorted reverses the order.
+        /// This is disabled by default, the onHeaderClick signal is emitted in both cases.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSortOnHeaderClick(bool sortOnHeaderClick);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether clicking on a column header sorts the items on that column
+        ///
+        /// @return Does clicking the header sort the items?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getSortOnHeaderClick() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Only displays the items for which a function returns true
+        ///
+        /// @param filter  Function that receives the index of an item and returns whether it should be displayed,
+        ///                or nullptr to display all items
+        ///
+        /// The filter is called for every item when it is set and for items that are added or changed afterwards.
+        /// Call this function again when the filter depends on something that changed. Items that are hidden by the filter
+        /// are deselected.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFilter(const std::function<bool(std::size_t)>& filter);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of items that are displayed
+        ///
+        /// @return Number of items that pass the filter, which equals getItemCount() when there is no filter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getDisplayedItemCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the index of the item that is displayed in a row
+        ///
+        /// @param row  Row in the list view, 0 being the top row
+        ///
+        /// @return Index of the item, or -1 when the row doesn't exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getDisplayedItemIndex(std::size_t row) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the height of the items in the list view
         ///
@@ -861,6 +1023,66 @@ namespace tgui
         int getColumnIndexBelowMouse(float mouseLeft);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the amount of rows, which differs from the amount of items when a filter is set
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getRowCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the item that is displayed in the given row
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getItemAtRow(std::size_t row) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the row in which the item is displayed, or -1 when the item is hidden by the filter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getRowOfItem(std::size_t item) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the items that are displayed between the rows of two items (including those items themselves)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::set<std::size_t> getItemsBetween(int firstItem, int lastItem) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the item should be displayed before the other item, according to the current sort column and order
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isItemSortedBefore(std::size_t item, std::size_t otherItem) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Applies the filter and the sorting to all items again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateRowOrder();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Places a new or changed item at its sorted position in m_rowOrder, or removes it when the filter hides it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateRowOfItem(std::size_t item, bool newItem = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores the rows in the range [firstRow, lastRow) in m_rowOfItem, after the items in m_rowOrder were moved
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateRowsOfItems(std::size_t firstRow, std::size_t lastRow);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the scrollbar after items were added and scrolls down when auto-scrolling is enabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateAfterAddingItems();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates m_maxIconWidth after an icon was removed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateMaxIconWidth();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Recalculate the size and viewport size of the scrollbars
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -920,6 +1142,23 @@ namespace tgui
         std::vector<Item>   m_items;
         std::set<std::size_t> m_selectedItems;
 
+        // Indices of the items in the order in which they are displayed. This is only used while the items are sorted or
+        // filtered (m_rowOrderUsed is true), otherwise row i simply displays item i.
+        std::vector<std::size_t> m_rowOrder;
+        std::vector<int> m_rowOfItem; // Inverse of m_rowOrder, contains -1 for items that are hidden by the filter
+        bool m_rowOrderUsed = false;
+        int m_sortColumn = -1;
+        bool m_sortAscending = true;
+        bool m_sortOnHeaderClick = false;
+        std::function<bool(std::size_t)> m_filter;
+
+        // How many times beginBatchUpdate was called without a matching endBatchUpdate, and the work that was postponed
+        unsigned int m_batchUpdateDepth = 0;
+        bool m_itemsAddedDuringBatch = false;
+        bool m_scrollbarUpdatePending = false;
+        bool m_iconWidthUpdatePending = false;
+        bool m_rowOrderUpdatePending = false;
+
         int m_hoveredItem = -1;
         int m_lastMouseDownItem = -1;
 
@@ -30,6 +30,7 @@
 #include <TGUI/Widget.hpp>
 #include <TGUI/Renderers/MenuBarRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -67,10 +68,19 @@ namespace tgui
         /// @internal
         struct Menu
         {
-            Text text;
+            sf::String text;
+            std::size_t textHash = 0;
             bool enabled = true;
             int selectedMenuItem = -1;
             std::vector<Menu> menuItems;
+
+            // The Text object is only created when the menu item is shown for the first time (see MenuBar::getMenuText)
+            mutable aurora::CopiedPtr<Text> textCache;
+
+            // Maps the hash of a text to the index of the first menu item with that text. Only used for large menus and built
+            // lazily: the first menuItemIndexSize items are in the index, items that were added afterwards are not yet.
+            mutable std::unordered_map<std::size_t, std::size_t> menuItemIndex;
+            mutable std::size_t menuItemIndexSize = 0;
         };
 
 
@@ -257,6 +267,43 @@ namespace tgui
         bool addMenuItem(const std::vector<sf::String>& hierarchy, bool createParents = true);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple menu items to a menu (or sub menu) at once
+        ///
+        /// @param hierarchy     Hierarchy of the menu items, starting with the menu and ending with the menu or submenu to which
+        ///                      the items will be added
+        /// @param menuItems     Texts of the menu items to add
+        /// @param createParents Should the hierarchy be created if it did not exist yet?
+        ///
+        /// @return True when the items were added, false when createParents was false and the hierarchy does not exist
+        ///         or if hierarchy is empty.
+        ///
+        /// This is faster than calling addMenuItem for every item, as the menu is only searched once.
+        ///
+        /// @code
+        /// menuBar->addMenuItems({"File", "Recent files"}, {"a.txt", "b.txt", "c.txt"});
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool addMenuItems(const std::vector<sf::String>& hierarchy, const std::vector<sf::String>& menuItems, bool createParents = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces all menu items of a menu (or sub menu) at once
+        ///
+        /// @param hierarchy     Hierarchy of the menu items, starting with the menu and ending with the menu or submenu of which
+        ///                      the items will be replaced
+        /// @param menuItems     Texts of the new menu items
+        /// @param createParents Should the hierarchy be created if it did not exist yet?
+        ///
+        /// @return True when the items were replaced, false when createParents was false and the hierarchy does not exist
+        ///         or if hierarchy is empty.
+        ///
+        /// This is intended for menus that are rebuilt often (e.g. a list of recent files or open windows). Any submenus of
+        /// the old menu items are removed as well.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setMenuItems(const std::vector<sf::String>& hierarchy, const std::vector<sf::String>& menuItems, bool createParents = true);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Removes all menus
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -548,6 +595,12 @@ namespace tgui
         void load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns false while a menu is open, because the open menu is drawn below the bar
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDrawnInsideBounds() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -561,14 +614,13 @@ namespace tgui
         void createMenu(std::vector<Menu>& menus, const sf::String& text);
 
         /// @internal
-        /// Recursively search for the menu containing the menu item specified in the hierarchy, creating the hierarchy if requested.
-        /// The initial call to this function must pass "parentIndex = 0" and "menus = m_menus".
-        Menu* findMenu(const std::vector<sf::String>& hierarchy, unsigned int parentIndex, std::vector<Menu>& menus, bool createParents);
+        /// Search for the menu that is specified by the first menuDepth elements of the hierarchy, creating the hierarchy if requested.
+        /// Passing "menuDepth = hierarchy.size() - 1" returns the menu that contains the menu item specified in the hierarchy.
+        Menu* findMenu(const std::vector<sf::String>& hierarchy, std::size_t menuDepth, bool createParents);
 
         /// @internal
-        /// Recursively search for the menu containing the menu item specified in the hierarchy.
-        /// The initial call to this function must pass "parentIndex = 0" and "menus = m_menus".
-        const Menu* findMenu(const std::vector<sf::String>& hierarchy, unsigned int parentIndex, const std::vector<Menu>& menus) const;
+        /// Search for the menu that is specified by the first menuDepth elements of the hierarchy.
+        const Menu* findMenu(const std::vector<sf::String>& hierarchy, std::size_t menuDepth) const;
 
         /// @internal
         /// Search for the menu item specified in the hierarchy.
@@ -585,6 +637,10 @@ namespace tgui
         /// @internal
         void deselectBottomItem();
 
+        /// @internal
+        /// Returns the text of the menu, the Text object is created when this function is called for the first time
+        const Text& getMenuText(const Menu& menu) const;
+
         /// @internal
         void updateMenuTextColor(Menu& menu, bool selected);
 
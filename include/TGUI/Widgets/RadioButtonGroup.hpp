@@ -84,6 +84,12 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns false because the child widgets aren't clipped and may lie outside the group
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDrawnInsideBounds() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
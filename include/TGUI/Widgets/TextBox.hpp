@@ -30,7 +30,10 @@
 #include <TGUI/CopiedSharedPtr.hpp>
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/TextBoxRenderer.hpp>
+#include <TGUI/TextBuffer.hpp>
+#include <TGUI/TextLineList.hpp>
 #include <TGUI/Text.hpp>
+#include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -42,6 +45,9 @@ namespace tgui
     /// A text box is a multi-line input box which supports word-wrap and a vertical scrollbar.
     /// If you are looking for a single line input field (with options like setting a password character or displaying a
     /// default text when it is empty) then check out the EditBox class.
+    ///
+    /// The text is stored in a TextBuffer, so editing a large text only rearranges the lines that were changed, and only the
+    /// lines that lie inside the visible area are drawn.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API TextBox : public Widget
     {
@@ -128,6 +134,8 @@ namespace tgui
         ///
         /// @return  The text that is currently inside the text box
         ///
+        /// The text box doesn't store its text as a single string, it is only created when this function is called after the
+        /// text was changed. The returned reference remains valid until the text is changed again.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         const sf::String& getText() const;
 
@@ -474,6 +482,20 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // A line that is displayed in the text box. Lines that were ended by a newline are followed by it in the text, while
+        // lines that were split by word-wrap are immediately followed by the next line. The position of the line is stored
+        // relative to the line in the text, so that editing a line doesn't affect the lines behind it. The width of the line
+        // is only calculated when the text isn't word-wrapped.
+        using Line = TextLineList::Line;
+
+        // Text object of a visible line. The text of a line is stored at index (line % m_visibleLineTexts.size()), so that
+        // lines which remain visible while scrolling keep their text object.
+        struct VisibleLineText
+        {
+            Text text;
+            std::size_t line = std::numeric_limits<std::size_t>::max(); // Index of the line that is stored in the text
+        };
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function will search after which character the caret should be placed. It will not change the caret position.
@@ -487,6 +509,32 @@ namespace tgui
         std::size_t getIndexOfSelectionPos(sf::Vector2<std::size_t> selectionPos) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Converts an index in the text to a position on a line. When the index is located where a line was split by word-wrap,
+        // the position at the end of the first line is returned.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Vector2<std::size_t> getSelectionPosOfIndex(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the characters that are displayed on a line
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String getLineText(std::size_t lineIndex) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index in the text of the first character that is displayed on a line
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getLineStart(const Line& line) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the horizontal distance between the start of the line and the given position on it. The characters are read
+        // from the text buffer, so the line doesn't have to be copied.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float findCharacterPos(sf::Vector2<std::size_t> selectionPos) const;
+
+
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Converts the two dimensional selection positions into one dimensional positions in the text.
@@ -509,20 +557,67 @@ namespace tgui
         void deleteSelectedCharacters();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes count characters at the given position and inserts the text there. Only the lines that contained the changed
+        // characters are rearranged. The caret is placed behind the inserted text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void replaceText(std::size_t pos, std::size_t count, const sf::String& text);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Rearrange the text inside the text box (by using word wrap).
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void rearrangeText(bool keepSelection);
 
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Splits a line from the text into the lines that are displayed and adds them to the list. The line is only word-wrapped
+        // when maxLineWidth is larger than 0.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void arrangeLine(std::size_t textLine, std::size_t start, std::size_t length, float maxLineWidth, std::vector<Line>& lines) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the width that is available to a line when the text is word-wrapped
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getAvailableLineWidth() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Looks up the width of the longest line when the horizontal scrollbar is used
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateMaxLineWidth();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the scrollbars and the selection after the lines were rearranged
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateAfterRearrangingText();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the physical size of the scrollbars, as well as the viewport size.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateScrollbars();
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function will split the text into five pieces so that the text can be easily drawn.
+        // Moves the caret to the end of the selection and scrolls to it. The selection itself is drawn as rectangles behind the
+        // visible lines, so nothing has to be rebuilt when it changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateSelection();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure that the lines in the range [firstLine, lastLine) have a text object. Only lines that weren't visible
+        // before or that were invalidated get their text recreated, unless m_visibleLineTextsOutdated was set.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateSelectionTexts();
+        void updateVisibleLineTexts(std::size_t firstLine, std::size_t lastLine) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Forces the text objects of the lines in the range [firstLine, lastLine) to be recreated when they are drawn again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateVisibleLineTexts(std::size_t firstLine, std::size_t lastLine);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -614,13 +709,21 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        sf::String   m_text;
+        TextBuffer m_textBuffer;
+
+        // Copy of the text that is only made when getText is called
+        mutable sf::String m_text;
+        mutable bool m_textOutdated = false;
+
         unsigned int m_lineHeight = 24;
 
-        // The width of the largest line
+        // The width of the largest line, and its length when the monospaced font optimization is enabled
         float m_maxLineWidth;
+        std::size_t m_maxLineLength = 0;
 
-        std::vector<sf::String> m_lines;
+        // The lines only know which line in the text they belong to by counting the lines in front of them, so inserting
+        // or removing a line in the text doesn't require the lines behind it to be changed
+        TextLineList m_lines;
 
         // The maximum characters (0 by default, which means no limit)
         std::size_t m_maxChars = 0;
@@ -638,14 +741,11 @@ namespace tgui
         Vector2f m_caretPosition;
         bool m_caretVisible = true;
 
-        Text m_textBeforeSelection;
-        Text m_textSelection1;
-        Text m_textSelection2;
-        Text m_textAfterSelection1;
-        Text m_textAfterSelection2;
         Text m_defaultText;
 
-        std::vector<FloatRect> m_selectionRects;
+        // Only the visible lines have a text object, they are created when the text box is drawn
+        mutable std::vector<VisibleLineText> m_visibleLineTexts;
+        mutable bool m_visibleLineTextsOutdated = true;
 
         // The scrollbars
         CopiedSharedPtr<ScrollbarChildWidget> m_verticalScrollbar;
@@ -669,6 +769,8 @@ namespace tgui
         Color   m_backgroundColorCached;
         Color   m_caretColorCached;
         Color   m_selectedTextBackgroundColorCached;
+        Color   m_textColorCached;
+        Color   m_selectedTextColorCached;
         float   m_caretWidthCached = 1;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,8 @@
 #define TGUI_TO_STRING_HPP
 
 
+#include <TGUI/Config.hpp>
+#include <type_traits>
 #include <sstream>
 #include <locale>
 
@@ -37,8 +39,51 @@
 
 namespace tgui
 {
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Formats numbers the same way as a stream with the classic locale would, but without constructing a stream.
+        // The decimal point is always a dot, regardless of the global locale.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_API std::string formatSignedInteger(long long value);
+        TGUI_API std::string formatUnsignedInteger(unsigned long long value);
+        TGUI_API std::string formatFloat(double value);
+
+        // Characters and booleans are printed differently by a stream, so they aren't considered to be numbers here
+        template <typename T>
+        struct IsFormattedAsInteger : std::integral_constant<bool, std::is_integral<T>::value
+            && !std::is_same<T, bool>::value && !std::is_same<T, char>::value && !std::is_same<T, signed char>::value
+            && !std::is_same<T, unsigned char>::value && !std::is_same<T, wchar_t>::value
+            && !std::is_same<T, char16_t>::value && !std::is_same<T, char32_t>::value>
+        {
+        };
+    }
+
+    template <typename T>
+    typename std::enable_if<priv::IsFormattedAsInteger<T>::value && std::is_signed<T>::value, std::string>::type
+    to_string(T value)
+    {
+        return priv::formatSignedInteger(static_cast<long long>(value));
+    }
+
+    template <typename T>
+    typename std::enable_if<priv::IsFormattedAsInteger<T>::value && std::is_unsigned<T>::value, std::string>::type
+    to_string(T value)
+    {
+        return priv::formatUnsignedInteger(static_cast<unsigned long long>(value));
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_same<T, float>::value || std::is_same<T, double>::value, std::string>::type
+    to_string(T value)
+    {
+        return priv::formatFloat(static_cast<double>(value));
+    }
+
     template <typename T>
-    std::string to_string(T value)
+    typename std::enable_if<!priv::IsFormattedAsInteger<T>::value && !std::is_same<T, float>::value && !std::is_same<T, double>::value, std::string>::type
+    to_string(T value)
     {
         std::ostringstream oss;
         oss.imbue(std::locale::classic());
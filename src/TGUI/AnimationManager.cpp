@@ -0,0 +1,598 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/AnimationManager.hpp>
+#include <TGUI/Widget.hpp>
+#include <algorithm>
+#include <limits>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Marks the end of a chain of animations and is returned when a widget isn't animated
+        const std::size_t noIndex = std::numeric_limits<std::size_t>::max();
+
+        // Minimum amount of slots in the table of animated widgets, it always has a power of 2 slots
+        const std::size_t minAnimatedWidgetSlots = 16;
+
+        std::uint8_t clampColorComponent(float value)
+        {
+            return static_cast<std::uint8_t>(std::max(0.f, std::min(255.f, value + 0.5f)));
+        }
+
+        // Widgets are aligned in memory, so the lower bits of the address are mixed with the higher ones
+        std::size_t hashWidget(const Widget* widget)
+        {
+            const std::size_t address = static_cast<std::size_t>(reinterpret_cast<std::uintptr_t>(widget));
+            return address ^ (address >> 4) ^ (address >> 12) ^ (address >> 20);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationManager::animatePosition(const std::shared_ptr<Widget>& widget, Vector2f endPosition, sf::Time duration, Easing easing)
+    {
+        const Vector2f startPosition = widget->getPosition();
+        addAnimation(widget, Property::Position, 0, {{startPosition.x, startPosition.y, 0, 0}}, {{endPosition.x, endPosition.y, 0, 0}}, duration, easing);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationManager::animateSize(const std::shared_ptr<Widget>& widget, Vector2f endSize, sf::Time duration, Easing easing)
+    {
+        const Vector2f startSize = widget->getSize();
+        addAnimation(widget, Property::Size, 0, {{startSize.x, startSize.y, 0, 0}}, {{endSize.x, endSize.y, 0, 0}}, duration, easing);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationManager::animateOpacity(const std::shared_ptr<Widget>& widget, float endOpacity, sf::Time duration, Easing easing)
+    {
+        endOpacity = std::max(0.f, std::min(1.f, endOpacity));
+        addAnimation(widget, Property::Opacity, 0, {{widget->getInheritedOpacity(), 0, 0, 0}}, {{endOpacity, 0, 0, 0}}, duration, easing);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationManager::animateColor(const std::shared_ptr<Widget>& widget, const std::string& property, Color endColor, sf::Time duration, Easing easing)
+    {
+        const unsigned int colorPropertyId = getColorPropertyId(property);
+
+        Color startColor = {endColor.getRed(), endColor.getGreen(), endColor.getBlue(), 0};
+        ObjectConverter currentValue = widget->getSharedRenderer()->getProperty(m_colorPropertyNames[colorPropertyId]);
+        if (currentValue.getType() == ObjectConverter::Type::Color)
+        {
+            if (currentValue.getColor().isSet())
+                startColor = currentValue.getColor();
+        }
+
+        addAnimation(widget, Property::Color, colorPropertyId,
+                     {{static_cast<float>(startColor.getRed()), static_cast<float>(startColor.getGreen()),
+                       static_cast<float>(startColor.getBlue()), static_cast<float>(startColor.getAlpha())}},
+                     {{static_cast<float>(endColor.getRed()), static_cast<float>(endColor.getGreen()),
+                       static_cast<float>(endColor.getBlue()), static_cast<float>(endColor.getAlpha())}},
+                     duration, easing);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationManager::stop(const std::shared_ptr<Widget>& widget)
+    {
+        const std::size_t slot = findAnimatedWidget(widget.get());
+        if (slot == noIndex)
+            return;
+
+        // The animations are only marked as stopped, without applying their end value. They are removed from the arrays
+        // during the next update, so that stopping animations from a signal handler doesn't shift the indices.
+        for (std::size_t i = m_animatedWidgets[slot].firstIndex; i != noIndex; i = m_nextIndices[i])
+        {
+            m_widgets[i] = nullptr;
+            --m_animationCount;
+        }
+
+        eraseAnimatedWidget(slot);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationManager::finish(const std::shared_ptr<Widget>& widget)
+    {
+        std::size_t slot = findAnimatedWidget(widget.get());
+        if (slot == noIndex)
+            return;
+
+        for (std::size_t i = m_animatedWidgets[slot].firstIndex; i != noIndex; i = m_nextIndices[i])
+            m_progress[i] = 1;
+
+        applyAnimations(widget, m_animatedWidgets[slot].firstIndex);
+
+        // A signal handler could have stopped the animations or started new ones, only those that are still finished are removed
+        slot = findAnimatedWidget(widget.get());
+        if (slot == noIndex)
+            return;
+
+        std::size_t i = m_animatedWidgets[slot].firstIndex;
+        while (i != noIndex)
+        {
+            const std::size_t next = m_nextIndices[i];
+            if (m_progress[i] >= 1)
+                unlinkAnimation(slot, i);
+
+            i = next;
+        }
+
+        if (m_animatedWidgets[slot].firstIndex == noIndex)
+            eraseAnimatedWidget(slot);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationManager::stopAll()
+    {
+        // The arrays aren't cleared here because this function could be called from a signal handler during update
+        for (auto& widget : m_widgets)
+            widget = nullptr;
+
+        std::fill(m_animatedWidgets.begin(), m_animatedWidgets.end(), AnimatedWidget{});
+        m_animatedWidgetCount = 0;
+        m_animationCount = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool AnimationManager::isAnimating(const std::shared_ptr<Widget>& widget) const
+    {
+        return findAnimatedWidget(widget.get()) != noIndex;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t AnimationManager::getAnimationCount() const
+    {
+        return m_animationCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationManager::reserve(std::size_t count)
+    {
+        m_widgets.reserve(count);
+        m_properties.reserve(count);
+        m_colorPropertyIds.reserve(count);
+        m_easings.reserve(count);
+        m_elapsedSeconds.reserve(count);
+        m_durationSeconds.reserve(count);
+        m_progress.reserve(count);
+        m_startValues.reserve(count);
+        m_endValues.reserve(count);
+        m_previousIndices.reserve(count);
+        m_nextIndices.reserve(count);
+        m_newIndices.reserve(count);
+
+        // Every animation could belong to a different widget
+        std::size_t slotCount = std::max<std::size_t>(minAnimatedWidgetSlots, m_animatedWidgets.size());
+        while (slotCount * 3 < count * 4)
+            slotCount *= 2;
+
+        if (slotCount != m_animatedWidgets.size())
+            rehashAnimatedWidgets(slotCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float AnimationManager::ease(Easing easing, float progress)
+    {
+        const float t = std::max(0.f, std::min(1.f, progress));
+        switch (easing)
+        {
+        case Easing::Linear:
+            return t;
+        case Easing::EaseIn:
+            return t * t * t;
+        case Easing::EaseOut:
+        {
+            const float inverse = 1 - t;
+            return 1 - (inverse * inverse * inverse);
+        }
+        case Easing::EaseInOut:
+        {
+            if (t < 0.5f)
+                return 4 * t * t * t;
+
+            const float inverse = 2 - (2 * t);
+            return 1 - (inverse * inverse * inverse / 2);
+        }
+        case Easing::EaseOutBack:
+        {
+            const float overshoot = 1.70158f;
+            const float shifted = t - 1;
+            return 1 + (shifted * shifted * (((overshoot + 1) * shifted) + overshoot));
+        }
+        }
+
+        return t;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool AnimationManager::update(sf::Time elapsedTime)
+    {
+        if (m_animationCount == 0)
+        {
+            // Remove the animations that were stopped since the last update
+            if (!m_widgets.empty())
+                removeFinishedAnimations();
+
+            return false;
+        }
+
+        // Advance all animations in a single pass over the contiguous arrays
+        const float elapsedSeconds = elapsedTime.asSeconds();
+        for (std::size_t i = 0; i < m_elapsedSeconds.size(); ++i)
+        {
+            m_elapsedSeconds[i] += elapsedSeconds;
+            if (m_durationSeconds[i] > 0)
+                m_progress[i] = std::min(1.f, m_elapsedSeconds[i] / m_durationSeconds[i]);
+            else
+                m_progress[i] = 1;
+        }
+
+        // Apply the new values per widget, when reaching the first animation of the widget. A signal handler that is triggered
+        // by changing a property could start or stop animations, but new animations are appended and stopped animations are
+        // only marked, so the indices don't change until the arrays are compacted after the loop.
+        const std::size_t count = m_widgets.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (m_widgets[i] && (m_previousIndices[i] == noIndex))
+                applyAnimations(m_widgets[i], i);
+        }
+
+        removeFinishedAnimations();
+        return m_animationCount > 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationManager::addAnimation(const std::shared_ptr<Widget>& widget, Property property, unsigned int colorPropertyId,
+                                        const std::array<float, 4>& startValue, const std::array<float, 4>& endValue, sf::Time duration, Easing easing)
+    {
+        // If the property is already being animated then the existing animation is replaced
+        const std::size_t slot = findAnimatedWidget(widget.get());
+        if (slot != noIndex)
+        {
+            for (std::size_t i = m_animatedWidgets[slot].firstIndex; i != noIndex; i = m_nextIndices[i])
+            {
+                if ((m_properties[i] == property) && (m_colorPropertyIds[i] == colorPropertyId))
+                {
+                    m_easings[i] = easing;
+                    m_elapsedSeconds[i] = 0;
+                    m_durationSeconds[i] = duration.asSeconds();
+                    m_progress[i] = 0;
+                    m_startValues[i] = startValue;
+                    m_endValues[i] = endValue;
+                    return;
+                }
+            }
+        }
+
+        // New animations are always added at the back, so that the indices of the other animations remain valid
+        const std::size_t index = m_widgets.size();
+        if (slot != noIndex)
+        {
+            AnimatedWidget& animatedWidget = m_animatedWidgets[slot];
+            m_nextIndices[animatedWidget.lastIndex] = index;
+            m_previousIndices.push_back(animatedWidget.lastIndex);
+            animatedWidget.lastIndex = index;
+        }
+        else
+        {
+            insertAnimatedWidget(widget.get(), index);
+            m_previousIndices.push_back(noIndex);
+        }
+
+        m_nextIndices.push_back(noIndex);
+        ++m_animationCount;
+
+        m_widgets.push_back(widget);
+        m_properties.push_back(property);
+        m_colorPropertyIds.push_back(colorPropertyId);
+        m_easings.push_back(easing);
+        m_elapsedSeconds.push_back(0);
+        m_durationSeconds.push_back(duration.asSeconds());
+        m_progress.push_back(0);
+        m_startValues.push_back(startValue);
+        m_endValues.push_back(endValue);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationManager::applyAnimations(std::shared_ptr<Widget> widget, std::size_t firstIndex)
+    {
+        // The widget is passed by value to keep it alive while changing it, in case a signal handler stops its animations.
+        // Every setter would invalidate the widget, the invalidation is only done once after all values have been set.
+        const bool wasInvalidationDeferred = widget->m_invalidationDeferred;
+        widget->m_invalidationDeferred = true;
+
+        // A signal handler could start or stop animations. New animations of the widget are linked at the end of the chain
+        // and the links of stopped animations are left intact, so the chain can still be followed until a stopped one.
+        for (std::size_t i = firstIndex; (i != noIndex) && (m_widgets[i] == widget); i = m_nextIndices[i])
+        {
+            const float factor = ease(m_easings[i], m_progress[i]);
+            const std::array<float, 4>& start = m_startValues[i];
+            const std::array<float, 4>& end = m_endValues[i];
+            const std::array<float, 4> value = {{start[0] + (factor * (end[0] - start[0])),
+                                                 start[1] + (factor * (end[1] - start[1])),
+                                                 start[2] + (factor * (end[2] - start[2])),
+                                                 start[3] + (factor * (end[3] - start[3]))}};
+
+            switch (m_properties[i])
+            {
+            case Property::Position:
+                widget->setPosition(Vector2f{value[0], value[1]});
+                break;
+            case Property::Size:
+                widget->setSize(Vector2f{std::max(0.f, value[0]), std::max(0.f, value[1])});
+                break;
+            case Property::Opacity:
+                widget->setInheritedOpacity(std::max(0.f, std::min(1.f, value[0])));
+                break;
+            case Property::Color:
+                widget->getRenderer()->setProperty(m_colorPropertyNames[m_colorPropertyIds[i]],
+                    Color{clampColorComponent(value[0]), clampColorComponent(value[1]), clampColorComponent(value[2]), clampColorComponent(value[3])});
+                break;
+            }
+        }
+
+        widget->m_invalidationDeferred = wasInvalidationDeferred;
+        widget->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationManager::removeFinishedAnimations()
+    {
+        const std::size_t size = m_widgets.size();
+        m_newIndices.resize(size);
+
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            if (!m_widgets[i] || (m_progress[i] >= 1))
+                m_newIndices[i] = noIndex;
+            else
+                m_newIndices[i] = kept++;
+        }
+
+        m_animationCount = kept;
+        if (kept == size)
+            return;
+
+        // Link the remaining animations past the removed ones. Only the links of the remaining animations are changed here,
+        // the removed animations still point to their old neighbours so that the chains can be followed through them.
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            if (m_newIndices[i] == noIndex)
+                continue;
+
+            std::size_t next = m_nextIndices[i];
+            while ((next != noIndex) && (m_newIndices[next] == noIndex))
+                next = m_nextIndices[next];
+
+            std::size_t previous = m_previousIndices[i];
+            while ((previous != noIndex) && (m_newIndices[previous] == noIndex))
+                previous = m_previousIndices[previous];
+
+            m_nextIndices[i] = (next != noIndex) ? m_newIndices[next] : noIndex;
+            m_previousIndices[i] = (previous != noIndex) ? m_newIndices[previous] : noIndex;
+        }
+
+        for (auto& animatedWidget : m_animatedWidgets)
+        {
+            if (!animatedWidget.widget)
+                continue;
+
+            std::size_t first = animatedWidget.firstIndex;
+            while ((first != noIndex) && (m_newIndices[first] == noIndex))
+                first = m_nextIndices[first];
+
+            if (first == noIndex)
+            {
+                // All animations of the widget finished, the entry is removed below
+                animatedWidget.firstIndex = noIndex;
+                continue;
+            }
+
+            std::size_t last = animatedWidget.lastIndex;
+            while (m_newIndices[last] == noIndex)
+                last = m_previousIndices[last];
+
+            animatedWidget.firstIndex = m_newIndices[first];
+            animatedWidget.lastIndex = m_newIndices[last];
+        }
+
+        // Erasing an entry moves later entries into its slot, so the same slot is checked again after erasing
+        for (std::size_t slot = 0; slot < m_animatedWidgets.size();)
+        {
+            if (m_animatedWidgets[slot].widget && (m_animatedWidgets[slot].firstIndex == noIndex))
+                eraseAnimatedWidget(slot);
+            else
+                ++slot;
+        }
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            const std::size_t newIndex = m_newIndices[i];
+            if ((newIndex == noIndex) || (newIndex == i))
+                continue;
+
+            m_widgets[newIndex] = std::move(m_widgets[i]);
+            m_properties[newIndex] = m_properties[i];
+            m_colorPropertyIds[newIndex] = m_colorPropertyIds[i];
+            m_easings[newIndex] = m_easings[i];
+            m_elapsedSeconds[newIndex] = m_elapsedSeconds[i];
+            m_durationSeconds[newIndex] = m_durationSeconds[i];
+            m_progress[newIndex] = m_progress[i];
+            m_startValues[newIndex] = m_startValues[i];
+            m_endValues[newIndex] = m_endValues[i];
+            m_previousIndices[newIndex] = m_previousIndices[i];
+            m_nextIndices[newIndex] = m_nextIndices[i];
+        }
+
+        m_widgets.resize(kept);
+        m_properties.resize(kept);
+        m_colorPropertyIds.resize(kept);
+        m_easings.resize(kept);
+        m_elapsedSeconds.resize(kept);
+        m_durationSeconds.resize(kept);
+        m_progress.resize(kept);
+        m_startValues.resize(kept);
+        m_endValues.resize(kept);
+        m_previousIndices.resize(kept);
+        m_nextIndices.resize(kept);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationManager::unlinkAnimation(std::size_t slot, std::size_t index)
+    {
+        AnimatedWidget& animatedWidget = m_animatedWidgets[slot];
+        const std::size_t previous = m_previousIndices[index];
+        const std::size_t next = m_nextIndices[index];
+
+        if (previous != noIndex)
+            m_nextIndices[previous] = next;
+        else
+            animatedWidget.firstIndex = next;
+
+        if (next != noIndex)
+            m_previousIndices[next] = previous;
+        else
+            animatedWidget.lastIndex = previous;
+
+        m_widgets[index] = nullptr;
+        --m_animationCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t AnimationManager::findAnimatedWidget(const Widget* widget) const
+    {
+        if (m_animatedWidgets.empty())
+            return noIndex;
+
+        const std::size_t mask = m_animatedWidgets.size() - 1;
+        for (std::size_t slot = hashWidget(widget) & mask; m_animatedWidgets[slot].widget; slot = (slot + 1) & mask)
+        {
+            if (m_animatedWidgets[slot].widget == widget)
+                return slot;
+        }
+
+        return noIndex;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationManager::insertAnimatedWidget(const Widget* widget, std::size_t index)
+    {
+        // The table is kept at most three quarters full so that the probe sequences remain short
+        if ((m_animatedWidgetCount + 1) * 4 > m_animatedWidgets.size() * 3)
+            rehashAnimatedWidgets(std::max<std::size_t>(minAnimatedWidgetSlots, m_animatedWidgets.size() * 2));
+
+        const std::size_t mask = m_animatedWidgets.size() - 1;
+        std::size_t slot = hashWidget(widget) & mask;
+        while (m_animatedWidgets[slot].widget)
+            slot = (slot + 1) & mask;
+
+        m_animatedWidgets[slot].widget = widget;
+        m_animatedWidgets[slot].firstIndex = index;
+        m_animatedWidgets[slot].lastIndex = index;
+        ++m_animatedWidgetCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationManager::eraseAnimatedWidget(std::size_t slot)
+    {
+        // Instead of leaving a marker in the slot, the entries behind it are moved back when the slot is part of their probe
+        // sequence. This keeps lookups correct without ever having to rebuild the table.
+        const std::size_t mask = m_animatedWidgets.size() - 1;
+        std::size_t hole = slot;
+        for (std::size_t i = (slot + 1) & mask; m_animatedWidgets[i].widget; i = (i + 1) & mask)
+        {
+            const std::size_t idealSlot = hashWidget(m_animatedWidgets[i].widget) & mask;
+            if (((i - idealSlot) & mask) >= ((i - hole) & mask))
+            {
+                m_animatedWidgets[hole] = m_animatedWidgets[i];
+                hole = i;
+            }
+        }
+
+        m_animatedWidgets[hole] = AnimatedWidget{};
+        --m_animatedWidgetCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationManager::rehashAnimatedWidgets(std::size_t slotCount)
+    {
+        std::vector<AnimatedWidget> oldAnimatedWidgets(slotCount);
+        oldAnimatedWidgets.swap(m_animatedWidgets);
+
+        const std::size_t mask = slotCount - 1;
+        for (const auto& animatedWidget : oldAnimatedWidgets)
+        {
+            if (!animatedWidget.widget)
+                continue;
+
+            std::size_t slot = hashWidget(animatedWidget.widget) & mask;
+            while (m_animatedWidgets[slot].widget)
+                slot = (slot + 1) & mask;
+
+            m_animatedWidgets[slot] = animatedWidget;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int AnimationManager::getColorPropertyId(const std::string& property)
+    {
+        const std::string lowercaseProperty = toLower(property);
+        for (unsigned int i = 0; i < m_colorPropertyNames.size(); ++i)
+        {
+            if (m_colorPropertyNames[i] == lowercaseProperty)
+                return i;
+        }
+
+        m_colorPropertyNames.push_back(lowercaseProperty);
+        return static_cast<unsigned int>(m_colorPropertyNames.size() - 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -45,10 +45,10 @@ namespace tgui
         {
             for (const auto& child : container->getWidgets())
             {
-                renderers[child->getSharedRenderer()->getData().get()].push_back(child.get());
+                renderers[child->getSharedRenderer()->getSharedData().get()].push_back(child.get());
 
                 if (child->getToolTip())
-                    renderers[child->getToolTip()->getSharedRenderer()->getData().get()].push_back(child->getToolTip().get());
+                    renderers[child->getToolTip()->getSharedRenderer()->getSharedData().get()].push_back(child->getToolTip().get());
 
                 Container* childContainer = dynamic_cast<Container*>(child.get());
                 if (childContainer)
@@ -100,6 +100,10 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Container::DrawStatistics Container::m_drawStatistics;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Container::Container()
     {
         m_containerWidget = true;
@@ -204,8 +208,7 @@ namespace tgui
             if (getInnerSize() != m_prevInnerSize)
             {
                 m_prevInnerSize = getInnerSize();
-                for (auto& layout : m_boundSizeLayouts)
-                    layout->recalculateValue();
+                recalculateBoundSizeLayouts();
             }
         }
     }
@@ -379,22 +382,26 @@ namespace tgui
 
     void Container::saveWidgetsToFile(const std::string& filename)
     {
-        std::stringstream stream;
-        saveWidgetsToStream(stream);
+        const auto rootNode = saveWidgetsToNodeTree();
 
         std::ofstream out{filename};
         if (!out.is_open())
             throw Exception{"Failed to open '" + filename + "' for saving the widgets to it."};
 
-        out << stream.rdbuf();
+        DataIO::emit(rootNode, out);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::loadWidgetsFromStream(std::stringstream& stream, bool replaceExisting)
     {
-        auto rootNode = DataIO::parse(stream);
+        loadWidgetsFromNodeTree(DataIO::parse(stream), replaceExisting);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::loadWidgetsFromNodeTree(const std::unique_ptr<DataIO::Node>& rootNode, bool replaceExisting)
+    {
         // Replace the existing widgets by the ones that will be loaded if requested
         if (replaceExisting)
             removeAllWidgets();
@@ -442,6 +449,13 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::saveWidgetsToStream(std::stringstream& stream) const
+    {
+        DataIO::emit(saveWidgetsToNodeTree(), stream);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> Container::saveWidgetsToNodeTree() const
     {
         auto node = std::make_unique<DataIO::Node>();
 
@@ -470,7 +484,7 @@ namespace tgui
         for (const auto& child : getWidgets())
             node->children.emplace_back(child->save(renderersMap));
 
-        DataIO::emit(node, stream);
+        return node;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -488,6 +502,7 @@ namespace tgui
 
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i);
+            invalidate();
             break;
         }
     }
@@ -508,12 +523,32 @@ namespace tgui
 
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i + 1);
+            invalidate();
             break;
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::beginBatchUpdate()
+    {
+        ++m_batchUpdateDepth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::endBatchUpdate()
+    {
+        assert(m_batchUpdateDepth > 0);
+        if (m_batchUpdateDepth == 0)
+            return;
+
+        --m_batchUpdateDepth;
+        updateDeferredLayout();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::focusNextWidget()
     {
         // If the focused widget is a container then try to focus the next widget inside it
@@ -598,6 +633,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Container::DrawStatistics Container::getDrawStatistics()
+    {
+        return m_drawStatistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::resetDrawStatistics()
+    {
+        m_drawStatistics = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::setFocused(bool focused)
     {
         if (!focused && m_focused && m_focusedWidget)
@@ -788,8 +837,7 @@ namespace tgui
                     return toolTip;
             }
 
-            if (m_toolTip)
-                return getToolTip();
+            return getToolTip();
         }
 
         return nullptr;
@@ -1087,11 +1135,30 @@ namespace tgui
 
     void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const
     {
+        // The view of the target contains the clipping area of the parents, which is all that can become visible.
+        // The bounding box of a rotated view is larger than what is shown, so no widgets are skipped in that case.
+        const sf::View& view = target->getView();
+        const bool cullWidgets = (view.getRotation() == 0);
+        const sf::FloatRect visibleArea{view.getCenter() - (view.getSize() / 2.f), view.getSize()};
+
         // Draw all widgets when they are visible
         for (const auto& widget : m_widgets)
         {
-            if (widget->isVisible())
-                widget->draw(*target, states);
+            if (!widget->isVisible())
+                continue;
+
+            if (cullWidgets && widget->isDrawnInsideBounds())
+            {
+                const sf::FloatRect bounds = states.transform.transformRect({widget->getPosition() + widget->getWidgetOffset(), widget->getFullSize()});
+                if (!bounds.intersects(visibleArea))
+                {
+                    ++m_drawStatistics.widgetsCulled;
+                    continue;
+                }
+            }
+
+            ++m_drawStatistics.widgetsDrawn;
+            widget->draw(*target, states);
         }
     }
 
@@ -1147,6 +1214,50 @@ namespace tgui
         return true;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateWidgets()
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::deferLayoutUpdate()
+    {
+        if (m_layoutUpdateInProgress)
+            return false;
+
+        if (m_batchUpdateDepth > 0)
+        {
+            m_layoutUpdatePending = true;
+            return true;
+        }
+
+        // Outside a batch, the layout is only deferred when there is a gui that will update it before it is needed
+        if (m_layoutUpdatePending)
+            return true;
+
+        if (!m_parent || !m_parent->queueLayoutUpdate(std::static_pointer_cast<Container>(shared_from_this())))
+            return false;
+
+        m_layoutUpdatePending = true;
+        invalidate();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateDeferredLayout()
+    {
+        if (!m_layoutUpdatePending || (m_batchUpdateDepth > 0))
+            return;
+
+        m_layoutUpdatePending = false;
+        m_layoutUpdateInProgress = true;
+        updateWidgets();
+        m_layoutUpdateInProgress = false;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -1180,6 +1291,78 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void GuiContainer::invalidate()
+    {
+        m_redrawRequested = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::requestWakeup(sf::Time delay)
+    {
+        if (delay < m_nextWakeupTime)
+            m_nextWakeupTime = delay;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool GuiContainer::queueLayoutUpdate(const std::shared_ptr<Container>& container)
+    {
+        m_queuedLayoutUpdates.push_back(container);
+        ++m_queuedLayoutUpdateCount;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::updateQueuedLayouts()
+    {
+        // Updating a layout requests the positions and sizes of the widgets, which mustn't start updating the layouts again
+        if (m_updatingQueuedLayouts || m_queuedLayoutUpdates.empty())
+            return;
+
+        m_updatingQueuedLayouts = true;
+
+        // Updating a layout may resize the container, which can queue the layout of its parent. The vector can thus grow while
+        // looping over it, so an index is used instead of iterators.
+        for (std::size_t i = 0; i < m_queuedLayoutUpdates.size(); ++i)
+        {
+            if (const auto container = m_queuedLayoutUpdates[i].lock())
+                container->updateDeferredLayout();
+        }
+
+        m_queuedLayoutUpdateCount -= static_cast<unsigned int>(m_queuedLayoutUpdates.size());
+        m_queuedLayoutUpdates.clear();
+        m_updatingQueuedLayouts = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    GuiContainer::~GuiContainer()
+    {
+        // Containers that were removed from the gui after their layout was queued still need to be updated. The layouts of
+        // containers that are still inside the gui are only reset, they would only be updated right before being destroyed.
+        for (const auto& weakContainer : m_queuedLayoutUpdates)
+        {
+            const auto container = weakContainer.lock();
+            if (!container)
+                continue;
+
+            const Container* root = container.get();
+            while (root->getParent())
+                root = root->getParent();
+
+            if (root != this)
+                container->updateDeferredLayout();
+            else
+                container->m_layoutUpdatePending = false;
+        }
+
+        m_queuedLayoutUpdateCount -= static_cast<unsigned int>(m_queuedLayoutUpdates.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void GuiContainer::draw(sf::RenderTarget&, sf::RenderStates) const
     {
     }
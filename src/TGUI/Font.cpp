@@ -26,12 +26,65 @@
 #include <TGUI/Font.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <map>
+#include <mutex>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // sf::Font has no way to find out for which character sizes it has a glyph page, so the sizes for which glyphs are
+        // requested are stored here. The map is shared by all fonts, which may be used by guis that are drawn on different
+        // threads, so it is protected by a mutex.
+        struct FontCharacterSizes
+        {
+            std::weak_ptr<sf::Font> font;
+            std::vector<unsigned int> characterSizes;
+        };
+
+        std::mutex usedFontCharacterSizesMutex;
+        std::map<const sf::Font*, FontCharacterSizes> usedFontCharacterSizes;
+
+        // The mutex has to be locked while calling this function
+        std::vector<unsigned int>& getCharacterSizesOfFont(const std::shared_ptr<sf::Font>& font)
+        {
+            auto it = usedFontCharacterSizes.find(font.get());
+            if (it == usedFontCharacterSizes.end())
+            {
+                // Forget about fonts that no longer exist before adding a new one
+                for (auto oldIt = usedFontCharacterSizes.begin(); oldIt != usedFontCharacterSizes.end();)
+                {
+                    if (oldIt->second.font.expired())
+                        oldIt = usedFontCharacterSizes.erase(oldIt);
+                    else
+                        ++oldIt;
+                }
+
+                it = usedFontCharacterSizes.insert({font.get(), FontCharacterSizes{font, {}}}).first;
+            }
+            else if (it->second.font.expired())
+            {
+                // A new font was created at the address of a font that was destroyed
+                it->second.font = font;
+                it->second.characterSizes.clear();
+            }
+
+            return it->second.characterSizes;
+        }
+
+        void recordCharacterSize(const std::shared_ptr<sf::Font>& font, unsigned int characterSize)
+        {
+            const std::lock_guard<std::mutex> lock{usedFontCharacterSizesMutex};
+            auto& usedCharacterSizes = getCharacterSizesOfFont(font);
+            if (std::find(usedCharacterSizes.begin(), usedCharacterSizes.end(), characterSize) == usedCharacterSizes.end())
+                usedCharacterSizes.push_back(characterSize);
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(std::nullptr_t)
@@ -79,7 +132,8 @@ namespace tgui
 
     Font::Font(const Font& other) :
         m_font{other.m_font},
-        m_id{other.m_id}
+        m_id{other.m_id},
+        m_lastCharacterSize{other.m_lastCharacterSize}
     {
     }
 
@@ -87,7 +141,8 @@ namespace tgui
 
     Font::Font(Font&& other) :
         m_font{std::move(other.m_font)},
-        m_id{std::move(other.m_id)}
+        m_id{std::move(other.m_id)},
+        m_lastCharacterSize{other.m_lastCharacterSize}
     {
         other.m_font = nullptr;
     }
@@ -104,6 +159,7 @@ namespace tgui
 
             m_font = other.m_font;
             m_id = other.m_id;
+            m_lastCharacterSize = other.m_lastCharacterSize;
         }
 
         return *this;
@@ -121,6 +177,7 @@ namespace tgui
 
             m_font = std::move(other.m_font);
             m_id = std::move(other.m_id);
+            m_lastCharacterSize = other.m_lastCharacterSize;
 
             other.m_font = nullptr;
         }
@@ -199,6 +256,13 @@ namespace tgui
     {
         assert(m_font != nullptr);
 
+        // Consecutive glyphs are usually requested with the same size, which then only has to be recorded once
+        if (characterSize != m_lastCharacterSize)
+        {
+            recordCharacterSize(m_font, characterSize);
+            m_lastCharacterSize = characterSize;
+        }
+
     #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
         return m_font->getGlyph(codePoint, characterSize, bold, outlineThickness);
     #else
@@ -209,6 +273,55 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Font::prewarm(const sf::String& characters, const std::vector<unsigned int>& characterSizes, bool bold, float outlineThickness) const
+    {
+        if (!m_font)
+            return;
+
+        for (const unsigned int characterSize : characterSizes)
+        {
+            for (const sf::Uint32 character : characters)
+                getGlyph(character, characterSize, bold, outlineThickness);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::prewarm(const std::vector<unsigned int>& characterSizes, bool bold) const
+    {
+        sf::String characters;
+        for (sf::Uint32 character = 0x20; character < 0x7F; ++character)
+            characters += character;
+
+        prewarm(characters, characterSizes, bold);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Font::GlyphStatistics Font::getGlyphStatistics() const
+    {
+        GlyphStatistics statistics;
+        if (!m_font)
+            return statistics;
+
+        std::vector<unsigned int> characterSizes;
+        {
+            const std::lock_guard<std::mutex> lock{usedFontCharacterSizesMutex};
+            characterSizes = getCharacterSizesOfFont(m_font);
+        }
+
+        for (const unsigned int characterSize : characterSizes)
+        {
+            const sf::Vector2u textureSize = m_font->getTexture(characterSize).getSize();
+            ++statistics.pages;
+            statistics.textureMemory += static_cast<std::size_t>(textureSize.x) * textureSize.y * 4;
+        }
+
+        return statistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     float Font::getKerning(std::uint32_t first, std::uint32_t second, unsigned int characterSize) const
     {
         if (m_font)
@@ -0,0 +1,155 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/FontManager.hpp>
+#include <TGUI/Global.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    std::map<sf::String, std::weak_ptr<sf::Font>> FontManager::m_fonts;
+    FontManager::Statistics FontManager::m_statistics;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<sf::Font> FontManager::getFont(const sf::String& filename)
+    {
+        if (filename.isEmpty())
+            return nullptr;
+
+        const sf::String resolvedFilename = getResolvedFilename(filename);
+
+        // Reuse the font if it is still loaded
+        auto it = m_fonts.find(resolvedFilename);
+        if (it != m_fonts.end())
+        {
+            if (auto font = it->second.lock())
+            {
+                ++m_statistics.cacheHits;
+                return font;
+            }
+
+            m_fonts.erase(it);
+        }
+
+        // Loading from disk is rare enough to also get rid of the entries of other fonts that are no longer used
+        removeExpiredFonts();
+
+        ++m_statistics.loads;
+        auto font = std::make_shared<sf::Font>();
+        if (!font->loadFromFile(resolvedFilename))
+            return nullptr;
+
+        m_fonts[resolvedFilename] = font;
+        return font;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<sf::Font> FontManager::preloadFont(const sf::String& filename)
+    {
+        return getFont(filename);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FontManager::evictFont(const sf::String& filename)
+    {
+        auto it = m_fonts.find(getResolvedFilename(filename));
+        if (it != m_fonts.end())
+            m_fonts.erase(it);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FontManager::evictAllFonts()
+    {
+        m_fonts.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FontManager::isFontLoaded(const sf::String& filename)
+    {
+        auto it = m_fonts.find(getResolvedFilename(filename));
+        if (it == m_fonts.end())
+            return false;
+
+        if (!it->second.expired())
+            return true;
+
+        m_fonts.erase(it);
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FontManager::Statistics FontManager::getStatistics()
+    {
+        return m_statistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FontManager::resetStatistics()
+    {
+        m_statistics = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FontManager::removeExpiredFonts()
+    {
+        for (auto it = m_fonts.begin(); it != m_fonts.end();)
+        {
+            if (it->second.expired())
+                it = m_fonts.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String FontManager::getResolvedFilename(const sf::String& filename)
+    {
+        if (filename.isEmpty())
+            return filename;
+
+#ifdef SFML_SYSTEM_WINDOWS
+        if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.getSize() <= 1) || (filename[1] != ':')))
+#else
+        if (filename[0] != '/')
+#endif
+            return getResourcePath() + filename;
+        else
+            return filename;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,10 +25,9 @@
 
 #include <TGUI/Global.hpp>
 #include <TGUI/Clipboard.hpp>
+#include <TGUI/String.hpp>
 #include <TGUI/DefaultFont.hpp>
 #include <functional>
-#include <sstream>
-#include <locale>
 #include <cctype> // isspace
 #include <cmath> // abs
 
@@ -131,32 +130,14 @@ namespace tgui
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     int stoi(const std::string& value)
     {
-        int result = 0;
-
-        std::istringstream iss(value);
-        iss.imbue(std::locale::classic());
-        iss >> result;
-
-        if (iss.fail())
-            result = 0;
-
-        return result;
+        return strToInt(value);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     float stof(const std::string& value)
     {
-        float result = 0;
-
-        std::istringstream iss(value);
-        iss.imbue(std::locale::classic());
-        iss >> result;
-
-        if (iss.fail())
-            result = 0;
-
-        return result;
+        return strToFloat(value);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
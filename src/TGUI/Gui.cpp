@@ -29,6 +29,7 @@
 
 #include <SFML/Graphics/RenderTexture.hpp>
 
+#include <algorithm>
 #include <cassert>
 
 #ifdef SFML_SYSTEM_WINDOWS
@@ -45,6 +46,70 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // Returns true when handling the second event directly after the first one makes the first event redundant.
+        // For wheel events the deltas have to be added together, which is left to the caller.
+        bool canMergeEvents(const sf::Event& first, const sf::Event& second)
+        {
+            if (first.type != second.type)
+                return false;
+
+            switch (first.type)
+            {
+                case sf::Event::MouseMoved:
+                    return true;
+
+                case sf::Event::TouchMoved:
+                    return (first.touch.finger == second.touch.finger);
+
+                case sf::Event::MouseWheelScrolled:
+                    return (first.mouseWheelScroll.wheel == second.mouseWheelScroll.wheel)
+                        && (first.mouseWheelScroll.x == second.mouseWheelScroll.x)
+                        && (first.mouseWheelScroll.y == second.mouseWheelScroll.y);
+
+                default:
+                    return false;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void addFontCharacterSize(std::vector<std::pair<Font, std::vector<unsigned int>>>& fonts, const Font& font, unsigned int characterSize)
+        {
+            // Widgets whose text size is 0 calculate it themselves, the size is then only known while drawing
+            if (!font || (characterSize == 0))
+                return;
+
+            auto it = std::find_if(fonts.begin(), fonts.end(), [&](const std::pair<Font, std::vector<unsigned int>>& pair){ return pair.first == font; });
+            if (it == fonts.end())
+            {
+                fonts.push_back({font, {}});
+                it = fonts.end() - 1;
+            }
+
+            if (std::find(it->second.begin(), it->second.end(), characterSize) == it->second.end())
+                it->second.push_back(characterSize);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void collectFontCharacterSizes(std::vector<std::pair<Font, std::vector<unsigned int>>>& fonts, const std::vector<Widget::Ptr>& widgets)
+        {
+            for (const auto& widget : widgets)
+            {
+                addFontCharacterSize(fonts, widget->getInheritedFont(), widget->getTextSize());
+
+                const auto toolTip = widget->getToolTip();
+                if (toolTip)
+                    addFontCharacterSize(fonts, toolTip->getInheritedFont(), toolTip->getTextSize());
+
+                if (widget->isContainer())
+                    collectFontCharacterSizes(fonts, std::static_pointer_cast<Container>(widget)->getWidgets());
+            }
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Gui::Gui() :
@@ -129,12 +194,12 @@ namespace tgui
         if ((m_view.getCenter() != view.getCenter()) || (m_view.getSize() != view.getSize()))
         {
             m_view = view;
+            m_container->invalidate();
 
             m_container->m_size = view.getSize();
             m_container->onSizeChange.emit(m_container.get(), m_container->getSize());
 
-            for (auto& layout : m_container->m_boundSizeLayouts)
-                layout->recalculateValue();
+            m_container->recalculateBoundSizeLayouts();
         }
         else // Set it anyway in case something changed that we didn't care to check
             m_view = view;
@@ -153,6 +218,9 @@ namespace tgui
     {
         assert(m_target != nullptr);
 
+        // The widgets have to be at their correct positions before finding out which one is below the mouse
+        m_container->updateQueuedLayouts();
+
         // Check if the event has something to do with the mouse
         if ((event.type == sf::Event::MouseMoved) || (event.type == sf::Event::TouchMoved)
          || (event.type == sf::Event::MouseButtonPressed) || (event.type == sf::Event::TouchBegan)
@@ -246,7 +314,59 @@ namespace tgui
         #endif
         }
 
-        return m_container->handleEvent(event);
+        if (!m_container->handleEvent(event))
+            return false;
+
+        // The widget that consumed the event has most likely changed its state
+        m_container->invalidate();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::queueEvent(const sf::Event& event)
+    {
+        m_eventQueue.push_back(event);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::handleQueuedEvents()
+    {
+        // Events that are queued while handling these events (e.g. from a signal handler) will be handled in the next call
+        std::vector<sf::Event> events;
+        events.swap(m_eventQueue);
+
+        // Merge the events in place
+        std::size_t count = 0;
+        for (const auto& event : events)
+        {
+            if ((count > 0) && canMergeEvents(events[count-1], event))
+            {
+                if (event.type == sf::Event::MouseWheelScrolled)
+                    events[count-1].mouseWheelScroll.delta += event.mouseWheelScroll.delta;
+                else
+                    events[count-1] = event;
+            }
+            else
+                events[count++] = event;
+        }
+
+        bool eventHandled = false;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (handleEvent(events[i]))
+                eventHandled = true;
+        }
+
+        // Reuse the memory for the next batch of events, unless new events were already queued
+        if (m_eventQueue.empty())
+        {
+            events.clear();
+            m_eventQueue.swap(events);
+        }
+
+        return eventHandled;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -284,10 +404,13 @@ namespace tgui
         assert(m_target != nullptr);
 
         // Update the time
-        if (m_windowFocused)
-            updateTime(m_clock.restart());
-        else
-            m_clock.restart();
+        updateTime();
+
+        // Layout containers that changed since the last frame only reposition their widgets now
+        m_container->updateQueuedLayouts();
+
+        // Anything that changes from here on will have to be shown in the next frame
+        m_container->m_redrawRequested = false;
 
         // Change the view
         const sf::View oldView = m_target->getView();
@@ -303,6 +426,40 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::prewarmFonts()
+    {
+        std::vector<std::pair<Font, std::vector<unsigned int>>> fonts;
+        collectFontCharacterSizes(fonts, m_container->getWidgets());
+
+        for (const auto& pair : fonts)
+            pair.first.prewarm(pair.second);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::needsRedraw() const
+    {
+        return m_container->m_redrawRequested;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Gui::getNextWakeupTime() const
+    {
+        sf::Time wakeupTime = m_container->m_nextWakeupTime;
+        if (m_tooltipPossible)
+            wakeupTime = std::min(wakeupTime, ToolTip::getInitialDelay() - m_tooltipTime);
+
+        // The requested times are relative to the last update
+        const sf::Time timeSinceUpdate = m_clock.getElapsedTime();
+        if (wakeupTime <= timeSinceUpdate)
+            return {};
+        else
+            return wakeupTime - timeSinceUpdate;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     GuiContainer::Ptr Gui::getContainer() const
     {
         return m_container;
@@ -310,6 +467,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    AnimationManager& Gui::getAnimationManager()
+    {
+        return m_animationManager;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::setFont(const Font& font)
     {
         m_container->setInheritedFont(font);
@@ -506,8 +670,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::loadWidgetsFromNodeTree(const std::unique_ptr<DataIO::Node>& rootNode, bool replaceExisting)
+    {
+        m_container->loadWidgetsFromNodeTree(rootNode, replaceExisting);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> Gui::saveWidgetsToNodeTree() const
+    {
+        return m_container->saveWidgetsToNodeTree();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::updateTime(const sf::Time& elapsedTime)
     {
+        // Widgets that still need to be updated later will request it again while being updated
+        m_container->m_nextWakeupTime = sf::microseconds(std::numeric_limits<sf::Int64>::max());
+
+        // All animations are applied in a single pass before the widgets are updated
+        if (m_animationManager.update(elapsedTime))
+            m_container->requestWakeup({});
+
         m_container->m_animationTimeElapsed = elapsedTime;
         m_container->update(elapsedTime);
 
@@ -524,6 +709,10 @@ namespace tgui
 
                     // Change the relative tool tip position in an absolute one
                     tooltip->setPosition(m_lastMousePos + ToolTip::getDistanceToMouse() + tooltip->getPosition());
+
+                    // The widgets were already updated before the tool tip was added, so its pending changes (e.g. the
+                    // rearranged text of a label) have to be processed here or the tool tip would be drawn outdated
+                    tooltip->update(sf::Time::Zero);
                 }
 
                 m_tooltipPossible = false;
@@ -533,6 +722,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Gui::updateTime()
+    {
+        // Time doesn't pass while the window isn't focused, but widgets still get updated to process their pending changes
+        if (m_windowFocused)
+            updateTime(m_clock.restart());
+        else
+        {
+            m_clock.restart();
+            updateTime(sf::Time::Zero);
+        }
+
+        return needsRedraw();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::init()
     {
     #ifdef SFML_SYSTEM_WINDOWS
@@ -0,0 +1,839 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/InputValidator.hpp>
+#include <TGUI/Exception.hpp>
+
+#include <algorithm>
+#include <map>
+#include <regex>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace
+    {
+        using CharRange = std::pair<std::uint32_t, std::uint32_t>;
+
+        const std::uint32_t maxCodePoint = 0xFFFFFFFF;
+
+        // Limits to prevent patterns like "(a{100}){100}" from taking a huge amount of memory, std::regex is used instead
+        const std::size_t maxNfaStates = 2000;
+        const std::size_t maxDfaStates = 500;
+        const unsigned int maxRepetitions = 1000;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Thrown when the pattern uses a feature that isn't supported (or is invalid), the pattern is then passed to std::regex
+        struct UnsupportedPattern {};
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        struct RegexNode
+        {
+            enum class Type
+            {
+                Empty,
+                Characters,
+                Concatenation,
+                Alternation,
+                Repetition
+            };
+
+            Type type = Type::Empty;
+            std::vector<CharRange> ranges;
+            std::vector<RegexNode> children;
+            unsigned int minRepeat = 0;
+            unsigned int maxRepeat = 0; // 0 means unlimited when type is Repetition
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::vector<CharRange> invertRanges(std::vector<CharRange> ranges)
+        {
+            std::sort(ranges.begin(), ranges.end());
+
+            std::vector<CharRange> inverted;
+            std::uint64_t next = 0;
+            for (const auto& range : ranges)
+            {
+                if (range.first > next)
+                    inverted.emplace_back(static_cast<std::uint32_t>(next), range.first - 1);
+
+                next = std::max<std::uint64_t>(next, static_cast<std::uint64_t>(range.second) + 1);
+            }
+
+            if (next <= maxCodePoint)
+                inverted.emplace_back(static_cast<std::uint32_t>(next), maxCodePoint);
+
+            return inverted;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Parses the ECMAScript regex syntax, as far as it can be matched without backtracking
+        class RegexParser
+        {
+        public:
+            explicit RegexParser(const std::string& pattern) :
+                m_pattern{pattern}
+            {
+            }
+
+            RegexNode parse()
+            {
+                // The entire string is always matched, so anchors at the beginning and end of the pattern have no effect
+                if (peek('^'))
+                    ++m_pos;
+
+                RegexNode node = parseAlternation();
+
+                if (peek('$') && (m_pos + 1 == m_pattern.size()))
+                    ++m_pos;
+
+                if (m_pos != m_pattern.size())
+                    throw UnsupportedPattern{};
+
+                return node;
+            }
+
+        private:
+            bool peek(char c) const
+            {
+                return (m_pos < m_pattern.size()) && (m_pattern[m_pos] == c);
+            }
+
+            char next()
+            {
+                if (m_pos >= m_pattern.size())
+                    throw UnsupportedPattern{};
+
+                return m_pattern[m_pos++];
+            }
+
+            RegexNode parseAlternation()
+            {
+                RegexNode node = parseConcatenation();
+                if (!peek('|'))
+                    return node;
+
+                RegexNode alternation;
+                alternation.type = RegexNode::Type::Alternation;
+                alternation.children.push_back(std::move(node));
+                while (peek('|'))
+                {
+                    ++m_pos;
+                    alternation.children.push_back(parseConcatenation());
+                }
+
+                return alternation;
+            }
+
+            RegexNode parseConcatenation()
+            {
+                RegexNode node;
+                node.type = RegexNode::Type::Concatenation;
+                while ((m_pos < m_pattern.size()) && !peek('|') && !peek(')'))
+                {
+                    // A dollar sign at the end of the pattern is handled by the caller
+                    if (peek('$') && (m_pos + 1 == m_pattern.size()))
+                        break;
+
+                    node.children.push_back(parseRepetition());
+                }
+
+                return node;
+            }
+
+            unsigned int parseNumber()
+            {
+                if ((m_pos >= m_pattern.size()) || (m_pattern[m_pos] < '0') || (m_pattern[m_pos] > '9'))
+                    throw UnsupportedPattern{};
+
+                unsigned int number = 0;
+                while ((m_pos < m_pattern.size()) && (m_pattern[m_pos] >= '0') && (m_pattern[m_pos] <= '9'))
+                {
+                    number = number * 10 + static_cast<unsigned int>(m_pattern[m_pos] - '0');
+                    if (number > maxRepetitions)
+                        throw UnsupportedPattern{};
+
+                    ++m_pos;
+                }
+
+                return number;
+            }
+
+            RegexNode parseRepetition()
+            {
+                RegexNode node = parseAtom();
+                if (m_pos >= m_pattern.size())
+                    return node;
+
+                unsigned int minRepeat = 0;
+                unsigned int maxRepeat = 0;
+                bool unlimited = false;
+                const char c = m_pattern[m_pos];
+                if (c == '*')
+                    unlimited = true;
+                else if (c == '+')
+                {
+                    minRepeat = 1;
+                    unlimited = true;
+                }
+                else if (c == '?')
+                    maxRepeat = 1;
+                else if (c == '{')
+                {
+                    ++m_pos;
+                    minRepeat = parseNumber();
+                    maxRepeat = minRepeat;
+                    if (peek(','))
+                    {
+                        ++m_pos;
+                        if (peek('}'))
+                            unlimited = true;
+                        else
+                            maxRepeat = parseNumber();
+                    }
+
+                    if (!peek('}') || (!unlimited && (maxRepeat < minRepeat)))
+                        throw UnsupportedPattern{};
+                }
+                else
+                    return node;
+
+                ++m_pos;
+
+                // Lazy quantifiers match the same strings when the entire string has to match
+                if (peek('?'))
+                    ++m_pos;
+
+                // Repeating a quantifier (e.g. "a**") is an error
+                if (peek('*') || peek('+') || peek('?') || peek('{'))
+                    throw UnsupportedPattern{};
+
+                // Repeating something zero times leaves nothing to match
+                if (!unlimited && (maxRepeat == 0))
+                    return {};
+
+                RegexNode repetition;
+                repetition.type = RegexNode::Type::Repetition;
+                repetition.minRepeat = minRepeat;
+                repetition.maxRepeat = unlimited ? 0 : maxRepeat;
+                repetition.children.push_back(std::move(node));
+                return repetition;
+            }
+
+            RegexNode parseAtom()
+            {
+                RegexNode node;
+                node.type = RegexNode::Type::Characters;
+
+                const char c = next();
+                switch (c)
+                {
+                case '(':
+                {
+                    // Only non-capturing groups are supported, lookaheads are not
+                    if (peek('?'))
+                    {
+                        ++m_pos;
+                        if (next() != ':')
+                            throw UnsupportedPattern{};
+                    }
+
+                    node = parseAlternation();
+                    if (next() != ')')
+                        throw UnsupportedPattern{};
+
+                    return node;
+                }
+                case '[':
+                    node.ranges = parseCharacterClass();
+                    return node;
+
+                case '.':
+                    node.ranges = invertRanges({{'\n', '\n'}, {'\r', '\r'}});
+                    return node;
+
+                case '\\':
+                    node.ranges = parseEscape(false);
+                    return node;
+
+                // Quantifiers without anything in front of them, anchors in the middle of the pattern or unbalanced brackets
+                case '*': case '+': case '?': case '{': case '}': case ']': case ')': case '^': case '$': case '|':
+                    throw UnsupportedPattern{};
+
+                default:
+                    node.ranges.emplace_back(static_cast<unsigned char>(c), static_cast<unsigned char>(c));
+                    return node;
+                }
+            }
+
+            std::uint32_t parseHexDigits(unsigned int count)
+            {
+                std::uint32_t value = 0;
+                for (unsigned int i = 0; i < count; ++i)
+                {
+                    const char c = next();
+                    if ((c >= '0') && (c <= '9'))
+                        value = value * 16 + static_cast<std::uint32_t>(c - '0');
+                    else if ((c >= 'a') && (c <= 'f'))
+                        value = value * 16 + static_cast<std::uint32_t>(c - 'a' + 10);
+                    else if ((c >= 'A') && (c <= 'F'))
+                        value = value * 16 + static_cast<std::uint32_t>(c - 'A' + 10);
+                    else
+                        throw UnsupportedPattern{};
+                }
+
+                return value;
+            }
+
+            // Parses the part after a backslash, both inside and outside a character class
+            std::vector<CharRange> parseEscape(bool insideCharacterClass)
+            {
+                const std::vector<CharRange> digits = {{'0', '9'}};
+                const std::vector<CharRange> wordChars = {{'0', '9'}, {'A', 'Z'}, {'_', '_'}, {'a', 'z'}};
+                const std::vector<CharRange> spaces = {{'\t', '\r'}, {' ', ' '}};
+
+                const char c = next();
+                switch (c)
+                {
+                case 'd': return digits;
+                case 'D': return invertRanges(digits);
+                case 'w': return wordChars;
+                case 'W': return invertRanges(wordChars);
+                case 's': return spaces;
+                case 'S': return invertRanges(spaces);
+                case 't': return {{'\t', '\t'}};
+                case 'n': return {{'\n', '\n'}};
+                case 'r': return {{'\r', '\r'}};
+                case 'f': return {{'\f', '\f'}};
+                case 'v': return {{'\v', '\v'}};
+                case 'x':
+                {
+                    const std::uint32_t value = parseHexDigits(2);
+                    return {{value, value}};
+                }
+                case 'u':
+                {
+                    const std::uint32_t value = parseHexDigits(4);
+                    return {{value, value}};
+                }
+                case 'b':
+                    // Inside a character class it is a backspace, outside it is a word boundary
+                    if (!insideCharacterClass)
+                        throw UnsupportedPattern{};
+                    return {{'\b', '\b'}};
+                case '0':
+                    if ((m_pos < m_pattern.size()) && (m_pattern[m_pos] >= '0') && (m_pattern[m_pos] <= '9'))
+                        throw UnsupportedPattern{};
+                    return {{'\0', '\0'}};
+                default:
+                    // Letters and digits have a special meaning (e.g. back-references), other characters are just escaped
+                    if (((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || ((c >= '0') && (c <= '9')))
+                        throw UnsupportedPattern{};
+
+                    return {{static_cast<unsigned char>(c), static_cast<unsigned char>(c)}};
+                }
+            }
+
+            std::vector<CharRange> parseCharacterClass()
+            {
+                bool inverted = false;
+                if (peek('^'))
+                {
+                    inverted = true;
+                    ++m_pos;
+                }
+
+                // The meaning of "[]" differs between regex implementations
+                if (peek(']'))
+                    throw UnsupportedPattern{};
+
+                std::vector<CharRange> ranges;
+                while (!peek(']'))
+                {
+                    std::vector<CharRange> element = parseCharacterClassElement();
+                    if (peek('-') && (m_pos + 1 < m_pattern.size()) && (m_pattern[m_pos + 1] != ']'))
+                    {
+                        ++m_pos;
+                        const std::vector<CharRange> rangeEnd = parseCharacterClassElement();
+
+                        // Ranges can only be made between single characters (e.g. [\d-z] is not supported)
+                        if ((element.size() != 1) || (element[0].first != element[0].second)
+                         || (rangeEnd.size() != 1) || (rangeEnd[0].first != rangeEnd[0].second)
+                         || (element[0].first > rangeEnd[0].first))
+                            throw UnsupportedPattern{};
+
+                        ranges.emplace_back(element[0].first, rangeEnd[0].first);
+                    }
+                    else
+                        ranges.insert(ranges.end(), element.begin(), element.end());
+                }
+
+                ++m_pos; // Skip the closing bracket
+
+                if (inverted)
+                    return invertRanges(ranges);
+                else
+                    return ranges;
+            }
+
+            std::vector<CharRange> parseCharacterClassElement()
+            {
+                const char c = next();
+                if (c == '\\')
+                    return parseEscape(true);
+
+                // Classes like [:alpha:] are not supported
+                if ((c == '[') && (peek(':') || peek('.') || peek('=')))
+                    throw UnsupportedPattern{};
+
+                return {{static_cast<unsigned char>(c), static_cast<unsigned char>(c)}};
+            }
+
+        private:
+            const std::string& m_pattern;
+            std::size_t m_pos = 0;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Converts the parsed expression into a nondeterministic finite automaton (using Thompson's construction)
+        class NfaBuilder
+        {
+        public:
+            struct State
+            {
+                std::vector<CharRange> ranges; // Characters that lead to the next state
+                int next = -1;
+                std::vector<int> epsilonTransitions;
+            };
+
+            // Returns the start state, the accepting state is the last state
+            int build(const RegexNode& root)
+            {
+                const auto fragment = compile(root);
+                const int acceptingState = addState();
+                m_states[static_cast<std::size_t>(fragment.second)].epsilonTransitions.push_back(acceptingState);
+                return fragment.first;
+            }
+
+            const std::vector<State>& getStates() const
+            {
+                return m_states;
+            }
+
+        private:
+            int addState()
+            {
+                if (m_states.size() >= maxNfaStates)
+                    throw UnsupportedPattern{};
+
+                m_states.emplace_back();
+                return static_cast<int>(m_states.size() - 1);
+            }
+
+            void addEpsilon(int from, int to)
+            {
+                m_states[static_cast<std::size_t>(from)].epsilonTransitions.push_back(to);
+            }
+
+            // Returns the start and end states of the fragment
+            std::pair<int, int> compile(const RegexNode& node)
+            {
+                switch (node.type)
+                {
+                case RegexNode::Type::Empty:
+                {
+                    const int state = addState();
+                    return {state, state};
+                }
+                case RegexNode::Type::Characters:
+                {
+                    const int start = addState();
+                    const int end = addState();
+                    m_states[static_cast<std::size_t>(start)].ranges = node.ranges;
+                    m_states[static_cast<std::size_t>(start)].next = end;
+                    return {start, end};
+                }
+                case RegexNode::Type::Concatenation:
+                {
+                    const int start = addState();
+                    int end = start;
+                    for (const auto& child : node.children)
+                    {
+                        const auto fragment = compile(child);
+                        addEpsilon(end, fragment.first);
+                        end = fragment.second;
+                    }
+                    return {start, end};
+                }
+                case RegexNode::Type::Alternation:
+                {
+                    const int start = addState();
+                    const int end = addState();
+                    for (const auto& child : node.children)
+                    {
+                        const auto fragment = compile(child);
+                        addEpsilon(start, fragment.first);
+                        addEpsilon(fragment.second, end);
+                    }
+                    return {start, end};
+                }
+                case RegexNode::Type::Repetition:
+                {
+                    const int start = addState();
+                    int end = start;
+                    for (unsigned int i = 0; i < node.minRepeat; ++i)
+                    {
+                        const auto fragment = compile(node.children[0]);
+                        addEpsilon(end, fragment.first);
+                        end = fragment.second;
+                    }
+
+                    if (node.maxRepeat == 0)
+                    {
+                        // Loop back to be able to match the child as many times as needed
+                        const auto fragment = compile(node.children[0]);
+                        const int loopEnd = addState();
+                        addEpsilon(end, fragment.first);
+                        addEpsilon(end, loopEnd);
+                        addEpsilon(fragment.second, fragment.first);
+                        addEpsilon(fragment.second, loopEnd);
+                        end = loopEnd;
+                    }
+                    else if (node.maxRepeat > node.minRepeat)
+                    {
+                        // Every optional occurrence can jump to the end
+                        const int optionalEnd = addState();
+                        for (unsigned int i = node.minRepeat; i < node.maxRepeat; ++i)
+                        {
+                            const auto fragment = compile(node.children[0]);
+                            addEpsilon(end, fragment.first);
+                            addEpsilon(end, optionalEnd);
+                            end = fragment.second;
+                        }
+                        addEpsilon(end, optionalEnd);
+                        end = optionalEnd;
+                    }
+
+                    return {start, end};
+                }
+                }
+
+                throw UnsupportedPattern{};
+            }
+
+        private:
+            std::vector<State> m_states;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Adds the state and all states that can be reached from it without consuming a character to the set
+        void addEpsilonClosure(const std::vector<NfaBuilder::State>& states, int state, std::vector<int>& stateSet, std::vector<bool>& inSet)
+        {
+            std::vector<int> statesToVisit{state};
+            while (!statesToVisit.empty())
+            {
+                const int currentState = statesToVisit.back();
+                statesToVisit.pop_back();
+
+                if (inSet[static_cast<std::size_t>(currentState)])
+                    continue;
+
+                inSet[static_cast<std::size_t>(currentState)] = true;
+                stateSet.push_back(currentState);
+
+                for (const int nextState : states[static_cast<std::size_t>(currentState)].epsilonTransitions)
+                    statesToVisit.push_back(nextState);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct InputValidator::FallbackRegex
+    {
+        explicit FallbackRegex(const std::string& pattern) :
+            regex{pattern}
+        {
+        }
+
+        std::regex regex;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InputValidator::InputValidator()
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InputValidator::InputValidator(const std::string& pattern) :
+        m_pattern        {pattern},
+        m_acceptsAnyInput{pattern == ".*"}
+    {
+        if (m_acceptsAnyInput)
+            return;
+
+        try
+        {
+            const RegexNode root = RegexParser{pattern}.parse();
+
+            NfaBuilder builder;
+            const int startState = builder.build(root);
+            const auto& nfaStates = builder.getStates();
+            const int nfaAcceptingState = static_cast<int>(nfaStates.size() - 1);
+
+            // Split the characters in classes, characters in the same class always lead to the same state
+            m_characterClasses.push_back(0);
+            for (const auto& state : nfaStates)
+            {
+                for (const auto& range : state.ranges)
+                {
+                    m_characterClasses.push_back(range.first);
+                    if (range.second < maxCodePoint)
+                        m_characterClasses.push_back(range.second + 1);
+                }
+            }
+            std::sort(m_characterClasses.begin(), m_characterClasses.end());
+            m_characterClasses.erase(std::unique(m_characterClasses.begin(), m_characterClasses.end()), m_characterClasses.end());
+
+            // Convert the NFA into a DFA, each state of the DFA corresponds with a set of states in the NFA
+            std::vector<std::vector<int>> dfaStates;
+            std::map<std::vector<int>, int> dfaStateIds;
+
+            std::vector<bool> inSet(nfaStates.size(), false);
+            std::vector<int> initialSet;
+            addEpsilonClosure(nfaStates, startState, initialSet, inSet);
+            std::sort(initialSet.begin(), initialSet.end());
+            dfaStateIds[initialSet] = 0;
+            dfaStates.push_back(std::move(initialSet));
+
+            for (std::size_t dfaState = 0; dfaState < dfaStates.size(); ++dfaState)
+            {
+                m_acceptingStates.push_back(std::binary_search(dfaStates[dfaState].begin(), dfaStates[dfaState].end(), nfaAcceptingState));
+
+                for (const std::uint32_t character : m_characterClasses)
+                {
+                    std::vector<int> nextSet;
+                    std::fill(inSet.begin(), inSet.end(), false);
+                    for (const int nfaState : dfaStates[dfaState])
+                    {
+                        const auto& state = nfaStates[static_cast<std::size_t>(nfaState)];
+                        for (const auto& range : state.ranges)
+                        {
+                            if ((character >= range.first) && (character <= range.second))
+                            {
+                                addEpsilonClosure(nfaStates, state.next, nextSet, inSet);
+                                break;
+                            }
+                        }
+                    }
+
+                    if (nextSet.empty())
+                    {
+                        m_transitions.push_back(-1);
+                        continue;
+                    }
+
+                    std::sort(nextSet.begin(), nextSet.end());
+                    const auto it = dfaStateIds.find(nextSet);
+                    if (it != dfaStateIds.end())
+                        m_transitions.push_back(it->second);
+                    else
+                    {
+                        if (dfaStates.size() >= maxDfaStates)
+                            throw UnsupportedPattern{};
+
+                        const int newState = static_cast<int>(dfaStates.size());
+                        dfaStateIds[nextSet] = newState;
+                        dfaStates.push_back(std::move(nextSet));
+                        m_transitions.push_back(newState);
+                    }
+                }
+            }
+        }
+        catch (const UnsupportedPattern&)
+        {
+            m_characterClasses.clear();
+            m_transitions.clear();
+            m_acceptingStates.clear();
+
+            try
+            {
+                m_fallbackRegex = std::make_shared<FallbackRegex>(pattern);
+            }
+            catch (const std::regex_error& e)
+            {
+                throw Exception{"Failed to compile input validator '" + pattern + "'. " + e.what()};
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::string& InputValidator::getPattern() const
+    {
+        return m_pattern;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool InputValidator::acceptsAnyInput() const
+    {
+        return m_acceptsAnyInput;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool InputValidator::matches(const sf::String& text) const
+    {
+        if (m_acceptsAnyInput)
+            return true;
+
+        // Unicode is not supported when using std::regex because it can't be checked
+        if (m_fallbackRegex)
+            return std::regex_match(text.toAnsiString(), m_fallbackRegex->regex);
+
+        int state = 0;
+        for (const std::uint32_t c : text)
+        {
+            state = nextState(state, c);
+            if (state < 0)
+                return false;
+        }
+
+        return m_acceptingStates[static_cast<std::size_t>(state)];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool InputValidator::matchesAfterEdit(const sf::String& text, std::size_t pos, std::size_t removedChars, std::uint32_t insertedChar) const
+    {
+        if (m_acceptsAnyInput)
+            return true;
+
+        pos = std::min(pos, text.getSize());
+        removedChars = std::min(removedChars, text.getSize() - pos);
+
+        if (m_fallbackRegex)
+        {
+            sf::String newText = text;
+            newText.erase(pos, removedChars);
+            newText.insert(pos, insertedChar);
+            return std::regex_match(newText.toAnsiString(), m_fallbackRegex->regex);
+        }
+
+        // When the states of the text are known then only the characters behind the edit have to be checked, until the state
+        // machine ends up in the same state as it did for the unedited text
+        const bool useCachedStates = (m_cachedStates.size() == text.getSize() + 1);
+
+        int state = 0;
+        if (useCachedStates)
+            state = m_cachedStates[pos];
+        else
+        {
+            for (std::size_t i = 0; (i < pos) && (state >= 0); ++i)
+                state = nextState(state, text[i]);
+        }
+
+        if (state >= 0)
+            state = nextState(state, insertedChar);
+
+        for (std::size_t i = pos + removedChars; (i < text.getSize()) && (state >= 0); ++i)
+        {
+            if (useCachedStates && (state == m_cachedStates[i]))
+            {
+                state = m_cachedStates.back();
+                break;
+            }
+
+            state = nextState(state, text[i]);
+        }
+
+        return (state >= 0) && m_acceptingStates[static_cast<std::size_t>(state)];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void InputValidator::textEdited(const sf::String& text, std::size_t pos, std::size_t removedChars, std::size_t insertedChars) const
+    {
+        if (m_acceptsAnyInput || m_fallbackRegex)
+            return;
+
+        // Calculate the states of the entire text when they weren't known yet or when the edit doesn't match the cached text
+        const std::size_t previousLength = m_cachedStates.empty() ? 0 : m_cachedStates.size() - 1;
+        if (m_cachedStates.empty() || (pos > previousLength) || (removedChars > previousLength - pos)
+         || (text.getSize() != previousLength - removedChars + insertedChars))
+        {
+            m_cachedStates.resize(text.getSize() + 1);
+            m_cachedStates[0] = 0;
+            for (std::size_t i = 0; i < text.getSize(); ++i)
+                m_cachedStates[i + 1] = (m_cachedStates[i] >= 0) ? nextState(m_cachedStates[i], text[i]) : -1;
+
+            return;
+        }
+
+        // Make room for the states of the inserted characters. The states behind them still belong to the unedited text,
+        // they only have to be recalculated until the state machine ends up in the same state again.
+        if (insertedChars > removedChars)
+            m_cachedStates.insert(m_cachedStates.begin() + pos + 1, insertedChars - removedChars, -1);
+        else if (removedChars > insertedChars)
+            m_cachedStates.erase(m_cachedStates.begin() + pos + 1, m_cachedStates.begin() + pos + 1 + (removedChars - insertedChars));
+
+        int state = m_cachedStates[pos];
+        for (std::size_t i = pos; i < text.getSize(); ++i)
+        {
+            state = (state >= 0) ? nextState(state, text[i]) : -1;
+            if ((i >= pos + insertedChars) && (m_cachedStates[i + 1] == state))
+                break;
+
+            m_cachedStates[i + 1] = state;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int InputValidator::nextState(int state, std::uint32_t character) const
+    {
+        const auto characterClass = static_cast<std::size_t>(std::upper_bound(m_characterClasses.begin(), m_characterClasses.end(), character) - m_characterClasses.begin() - 1);
+        return m_transitions[static_cast<std::size_t>(state) * m_characterClasses.size() + characterClass];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
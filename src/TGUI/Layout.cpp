@@ -88,7 +88,7 @@ namespace tgui
                 else // value is a fraction of parent size
                 {
                     *this = Layout{Layout::Operation::Multiplies,
-                                   std::make_unique<Layout>(strToFloat(expression.substr(0, expression.length()-1)) / 100.f),
+                                   std::make_unique<Layout>(strToFloat(expression) / 100.f), // Parsing stops at the '%' sign
                                    std::make_unique<Layout>("&.innersize")};
                 }
             }
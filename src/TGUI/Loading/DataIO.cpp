@@ -452,42 +452,42 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::vector<std::string> convertNodesToLines(const std::unique_ptr<DataIO::Node>& node)
+        void writeIndentation(std::ostream& stream, std::size_t depth)
         {
-            std::vector<std::string> output;
+            for (std::size_t i = 0; i < depth; ++i)
+                stream << "    ";
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Writes the node directly to the stream, without first building the lines as strings
+        void emitNode(const std::unique_ptr<DataIO::Node>& node, std::ostream& stream, std::size_t depth)
+        {
+            writeIndentation(stream, depth);
             if (node->name.empty())
-                output.emplace_back("{");
+                stream << "{\n";
             else
-                output.emplace_back(node->name + " {");
+                stream << node->name << " {\n";
 
-            if (!node->propertyValuePairs.empty())
+            for (const auto& pair : node->propertyValuePairs)
             {
-                for (const auto& pair : node->propertyValuePairs)
-                    output.emplace_back("    " + pair.first + " = " + pair.second->value + ";");
+                writeIndentation(stream, depth + 1);
+                stream << pair.first << " = " << pair.second->value << ";\n";
             }
 
             if (node->propertyValuePairs.size() > 0 && node->children.size() > 0)
-                output.emplace_back("");
+                stream << '\n';
 
-            if (!node->children.empty())
+            for (std::size_t i = 0; i < node->children.size(); ++i)
             {
-                for (std::size_t i = 0; i < node->children.size(); ++i)
-                {
-                    for (const auto& line : convertNodesToLines(node->children[i]))
-                    {
-                        if (!line.empty())
-                            output.emplace_back("    " + line);
-                        else
-                            output.emplace_back("");
-                    }
+                emitNode(node->children[i], stream, depth + 1);
 
-                    if (i < node->children.size() - 1)
-                        output.emplace_back("");
-                }
+                if (i < node->children.size() - 1)
+                    stream << '\n';
             }
 
-            output.emplace_back("}");
-            return output;
+            writeIndentation(stream, depth);
+            stream << "}\n";
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -522,26 +522,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void DataIO::emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream)
+    void DataIO::emit(const std::unique_ptr<Node>& rootNode, std::ostream& stream)
     {
         for (const auto& pair : rootNode->propertyValuePairs)
-            stream << pair.first << " = " << pair.second->value << ";" << std::endl;
+            stream << pair.first << " = " << pair.second->value << ";\n";
 
         if (rootNode->propertyValuePairs.size() > 0 && rootNode->children.size() > 0)
-            stream << std::endl;
+            stream << '\n';
 
-        std::vector<std::string> output;
         for (std::size_t i = 0; i < rootNode->children.size(); ++i)
         {
-            for (const auto& line : convertNodesToLines(rootNode->children[i]))
-                output.emplace_back(std::move(line));
+            emitNode(rootNode->children[i], stream, 0);
 
             if (i < rootNode->children.size()-1)
-                output.emplace_back("");
+                stream << '\n';
         }
-
-        for (const auto& line : output)
-            stream << line << std::endl;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,7 +26,9 @@
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/DataIO.hpp>
 #include <TGUI/Renderers/WidgetRenderer.hpp>
+#include <TGUI/FontManager.hpp>
 #include <TGUI/Global.hpp>
+#include <algorithm>
 #include <cstdint>
 #include <cassert>
 
@@ -73,14 +75,35 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        bool readIntRect(std::string value, sf::IntRect& rect)
+        // Parses a list of integers that are separated by commas, without creating temporary strings.
+        // Returns the amount of values in the list. Values that aren't numbers are 0, just like with strToInt.
+        std::size_t parseIntList(const char* begin, const char* end, int* values, std::size_t maxValues)
+        {
+            std::size_t count = 0;
+            while (true)
+            {
+                const char* tokenEnd = std::find(begin, end, ',');
+                if ((count < maxValues) && !priv::parseInt(priv::skipWhitespace(begin, tokenEnd), tokenEnd, values[count]))
+                    values[count] = 0;
+
+                ++count;
+                if (tokenEnd == end)
+                    return count;
+
+                begin = tokenEnd + 1;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool readIntRect(const std::string& value, sf::IntRect& rect)
         {
             if (!value.empty() && (value[0] == '(') && (value[value.length()-1] == ')'))
             {
-                std::vector<std::string> tokens = Deserializer::split(value.substr(1, value.size()-2), ',');
-                if (tokens.size() == 4)
+                int values[4];
+                if (parseIntList(value.data() + 1, value.data() + value.length() - 1, values, 4) == 4)
                 {
-                    rect = {strToInt(tokens[0]), strToInt(tokens[1]), strToInt(tokens[2]), strToInt(tokens[3])};
+                    rect = {values[0], values[1], values[2], values[3]};
                     return true;
                 }
             }
@@ -112,19 +135,14 @@ namespace tgui
             if (filename.isEmpty())
                 return Font{};
 
-            // Load the font but insert the resource path into the filename unless the filename is an absolute path
-            auto font = std::make_shared<sf::Font>();
-#ifdef SFML_SYSTEM_WINDOWS
-            if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.getSize() <= 1) || (filename[1] != ':')))
-#else
-            if (filename[0] != '/')
-#endif
-                font->loadFromFile(getResourcePath() + filename);
-            else
-                font->loadFromFile(filename);
-
+            // Fonts are shared when the same file is used multiple times. When the font failed to load (the reason was
+            // already printed to sf::err) we still return an empty font, just like when the font isn't shared.
             // We create the SFML font manually first, as passing the string to the Font constructor would cause
             // an endless recursive call to this function.
+            auto font = FontManager::getFont(filename);
+            if (!font)
+                font = std::make_shared<sf::Font>();
+
             return Font{font};
         }
 
@@ -192,13 +210,14 @@ namespace tgui
             if ((str[0] == '(') && (str[str.length()-1] == ')'))
                 str = str.substr(1, str.length()-2);
 
-            const std::vector<std::string> tokens = Deserializer::split(str, ',');
-            if (tokens.size() == 3 || tokens.size() == 4)
+            int values[4];
+            const std::size_t valueCount = parseIntList(str.data(), str.data() + str.length(), values, 4);
+            if (valueCount == 3 || valueCount == 4)
             {
-                return Color{static_cast<std::uint8_t>(strToInt(tokens[0])),
-                             static_cast<std::uint8_t>(strToInt(tokens[1])),
-                             static_cast<std::uint8_t>(strToInt(tokens[2])),
-                             static_cast<std::uint8_t>((tokens.size() == 4) ? strToInt(tokens[3]) : 255)};
+                return Color{static_cast<std::uint8_t>(values[0]),
+                             static_cast<std::uint8_t>(values[1]),
+                             static_cast<std::uint8_t>(values[2]),
+                             static_cast<std::uint8_t>((valueCount == 4) ? values[3] : 255)};
             }
 
             throw Exception{"Failed to deserialize color '" + value + "'."};
@@ -287,12 +287,18 @@ namespace tgui
     {
         if (m_defaultTheme == this)
             setDefault(nullptr);
+
+        if (m_themeLoader && !m_primary.empty())
+            m_themeLoader->release(m_primary);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Theme::load(const std::string& primary)
     {
+        if (!m_primary.empty() && (m_primary != primary))
+            m_themeLoader->release(m_primary);
+
         m_primary = primary;
         m_themeLoader->preload(primary);
 
@@ -300,36 +306,29 @@ namespace tgui
         for (auto& pair : m_renderers)
         {
             auto& renderer = pair.second;
-            const auto oldData = renderer;
-
             if (!m_themeLoader->canLoad(m_primary, pair.first))
                 continue;
 
-            auto& properties = m_themeLoader->load(m_primary, pair.first);
-
             // Update the property-value pairs of the renderer
-            renderer->propertyValuePairs = std::map<std::string, ObjectConverter>{};
-            for (const auto& property : properties)
-                renderer->propertyValuePairs[property.first] = ObjectConverter(property.second);
+            const auto oldPropertyValuePairs = std::move(renderer->propertyValuePairs);
+            renderer->propertyValuePairs = m_themeLoader->loadDeserialized(m_primary, pair.first);
 
             // Tell the widgets that were using this renderer about all the updated properties, both new ones and old ones that were now reset to their default value
-            auto oldIt = oldData->propertyValuePairs.begin();
+            auto oldIt = oldPropertyValuePairs.begin();
             auto newIt = renderer->propertyValuePairs.begin();
-            while (oldIt != oldData->propertyValuePairs.end() && newIt != renderer->propertyValuePairs.end())
+            while (oldIt != oldPropertyValuePairs.end() && newIt != renderer->propertyValuePairs.end())
             {
                 if (oldIt->first < newIt->first)
                 {
                     // Update values that no longer exist in the new renderer and are now reset to the default value
-                    for (const auto& observer : renderer->observers)
-                        observer.second(oldIt->first);
+                    renderer->notifyObservers(oldIt->first);
 
                     ++oldIt;
                 }
                 else
                 {
                     // Update changed and new properties
-                    for (const auto& observer : renderer->observers)
-                        observer.second(newIt->first);
+                    renderer->notifyObservers(newIt->first);
 
                     if (newIt->first < oldIt->first)
                         ++newIt;
@@ -340,17 +339,15 @@ namespace tgui
                     }
                 }
             }
-            while (oldIt != oldData->propertyValuePairs.end())
+            while (oldIt != oldPropertyValuePairs.end())
             {
-                for (const auto& observer : renderer->observers)
-                    observer.second(oldIt->first);
+                renderer->notifyObservers(oldIt->first);
 
                 ++oldIt;
             }
             while (newIt != renderer->propertyValuePairs.end())
             {
-                for (const auto& observer : renderer->observers)
-                    observer.second(newIt->first);
+                renderer->notifyObservers(newIt->first);
 
                 ++newIt;
             }
@@ -369,9 +366,7 @@ namespace tgui
             return it->second;
 
         m_renderers[lowercaseSecondary] = RendererData::create();
-        auto& properties = m_themeLoader->load(m_primary, lowercaseSecondary);
-        for (const auto& property : properties)
-            m_renderers[lowercaseSecondary]->propertyValuePairs[property.first] = ObjectConverter(property.second);
+        m_renderers[lowercaseSecondary]->propertyValuePairs = m_themeLoader->loadDeserialized(m_primary, lowercaseSecondary);
 
         return m_renderers[lowercaseSecondary];
     }
@@ -392,9 +387,7 @@ namespace tgui
         if (!m_themeLoader->canLoad(m_primary, lowercaseSecondary))
             return nullptr;
 
-        auto& properties = m_themeLoader->load(m_primary, lowercaseSecondary);
-        for (const auto& property : properties)
-            m_renderers[lowercaseSecondary]->propertyValuePairs[property.first] = ObjectConverter(property.second);
+        m_renderers[lowercaseSecondary]->propertyValuePairs = m_themeLoader->loadDeserialized(m_primary, lowercaseSecondary);
 
         return m_renderers[lowercaseSecondary];
     }
@@ -26,6 +26,7 @@
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/ThemeLoader.hpp>
 #include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <TGUI/Global.hpp>
 
 #include <cassert>
@@ -53,6 +54,7 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::map<std::string, std::map<std::string, std::map<sf::String, sf::String>>> DefaultThemeLoader::m_propertiesCache;
+    std::map<std::string, std::map<std::string, std::map<std::string, ObjectConverter>>> DefaultThemeLoader::m_deserializedCache;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -133,6 +135,77 @@ namespace tgui
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Derives the type of a theme property from its name, so that the value can be deserialized once when the section is
+        // loaded instead of by every widget that uses it. Returns None when the type isn't known.
+        ObjectConverter::Type getThemePropertyType(const std::string& lowercaseProperty, const sf::String& value)
+        {
+            const auto endsWith = [&](const std::string& suffix){
+                return (lowercaseProperty.size() >= suffix.size())
+                    && (lowercaseProperty.compare(lowercaseProperty.size() - suffix.size(), suffix.size(), suffix) == 0);
+            };
+
+            if (!value.isEmpty() && (value[0] == '{'))
+                return ObjectConverter::Type::RendererData;
+            else if (lowercaseProperty.compare(0, 7, "texture") == 0)
+                return ObjectConverter::Type::Texture;
+            else if (lowercaseProperty.find("color") != std::string::npos)
+                return ObjectConverter::Type::Color;
+            else if (lowercaseProperty.find("textstyle") != std::string::npos)
+                return ObjectConverter::Type::TextStyle;
+            else if (lowercaseProperty == "font")
+                return ObjectConverter::Type::Font;
+            else if (endsWith("borders") || endsWith("padding"))
+                return ObjectConverter::Type::Outline;
+            else
+                return ObjectConverter::Type::None;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        ObjectConverter deserializeThemeProperty(const std::string& property, const sf::String& value)
+        {
+            const ObjectConverter::Type type = getThemePropertyType(toLower(property), value);
+            if (type == ObjectConverter::Type::None)
+                return {value};
+
+            ObjectConverter result;
+            try
+            {
+                result = Deserializer::deserialize(type, value);
+            }
+            catch (const Exception&)
+            {
+                // Keep the string, the error will be reported when a widget tries to use the value
+                return {value};
+            }
+
+            // The properties inside nested sections are deserialized as well
+            if (type == ObjectConverter::Type::RendererData)
+            {
+                for (auto& pair : result.getRenderer()->propertyValuePairs)
+                    pair.second = deserializeThemeProperty(pair.first, pair.second.getString());
+            }
+
+            return result;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Values can be shared, except for nested renderers which could otherwise be changed by one theme while in use by others
+        ObjectConverter copyThemeProperty(ObjectConverter& value)
+        {
+            if (value.getType() != ObjectConverter::Type::RendererData)
+                return value;
+
+            auto rendererData = RendererData::create();
+            for (auto& pair : value.getRenderer()->propertyValuePairs)
+                rendererData->propertyValuePairs[pair.first] = copyThemeProperty(pair.second);
+
+            return {rendererData};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -143,6 +216,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::map<std::string, ObjectConverter> BaseThemeLoader::loadDeserialized(const std::string& primary, const std::string& secondary)
+    {
+        std::map<std::string, ObjectConverter> values;
+        for (const auto& property : load(primary, secondary))
+            values[property.first] = ObjectConverter(property.second);
+
+        return values;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BaseThemeLoader::release(const std::string&)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void DefaultThemeLoader::flushCache(const std::string& filename)
     {
         if (filename != "")
@@ -150,10 +240,15 @@ namespace tgui
             auto propertiesCacheIt = m_propertiesCache.find(filename);
             if (propertiesCacheIt != m_propertiesCache.end())
                 m_propertiesCache.erase(propertiesCacheIt);
+
+            auto deserializedCacheIt = m_deserializedCache.find(filename);
+            if (deserializedCacheIt != m_deserializedCache.end())
+                m_deserializedCache.erase(deserializedCacheIt);
         }
         else
         {
             m_propertiesCache.clear();
+            m_deserializedCache.clear();
         }
     }
 
@@ -246,6 +341,40 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::map<std::string, ObjectConverter> DefaultThemeLoader::loadDeserialized(const std::string& filename, const std::string& section)
+    {
+        const auto& properties = load(filename, section);
+
+        auto& sectionsCache = m_deserializedCache[filename];
+        const std::string lowercaseClassName = toLower(section);
+        auto sectionIt = sectionsCache.find(lowercaseClassName);
+        if (sectionIt == sectionsCache.end())
+        {
+            std::map<std::string, ObjectConverter> values;
+            for (const auto& property : properties)
+                values[property.first] = deserializeThemeProperty(property.first, property.second);
+
+            sectionIt = sectionsCache.emplace(lowercaseClassName, std::move(values)).first;
+        }
+
+        std::map<std::string, ObjectConverter> values;
+        for (auto& pair : sectionIt->second)
+            values.emplace_hint(values.end(), pair.first, copyThemeProperty(pair.second));
+
+        return values;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DefaultThemeLoader::release(const std::string& filename)
+    {
+        auto deserializedCacheIt = m_deserializedCache.find(filename);
+        if (deserializedCacheIt != m_deserializedCache.end())
+            m_deserializedCache.erase(deserializedCacheIt);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void DefaultThemeLoader::readFile(const std::string& filename, std::stringstream& contents) const
     {
         if (filename.empty())
@@ -75,15 +75,16 @@ namespace tgui
 
     void WidgetRenderer::setProperty(const std::string& property, ObjectConverter&& value)
     {
-        std::string lowercaseProperty = toLower(property);
+        const std::string lowercaseProperty = toLower(property);
 
-        if (m_data->propertyValuePairs[lowercaseProperty] != value)
-        {
-            m_data->propertyValuePairs[lowercaseProperty] = value;
+        // Shared data is only copied when the value really changes
+        const auto it = m_data->propertyValuePairs.find(lowercaseProperty);
+        if ((it != m_data->propertyValuePairs.end()) ? (it->second == value) : (value.getType() == ObjectConverter::Type::None))
+            return;
 
-            for (const auto& observer : m_data->observers)
-                observer.second(lowercaseProperty);
-        }
+        detachData();
+        m_data->propertyValuePairs[lowercaseProperty] = std::move(value);
+        m_data->notifyObservers(lowercaseProperty);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -108,6 +109,10 @@ namespace tgui
 
     void WidgetRenderer::subscribe(const void* id, const std::function<void(const std::string& property)>& function)
     {
+        // When the renderer is copied together with its widget, the copied callback belongs to the new widget
+        if (m_copyOnWriteId)
+            m_copyOnWriteId = id;
+
         m_data->observers[id] = function;
     }
 
@@ -123,11 +128,21 @@ namespace tgui
     void WidgetRenderer::setData(const std::shared_ptr<RendererData>& data)
     {
         m_data = data;
+        m_copyOnWriteId = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::shared_ptr<RendererData> WidgetRenderer::getData() const
+    {
+        // The data can be changed or given to another widget, so a renderer that wasn't shared has to stop sharing it now
+        detachData();
+        return m_data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::shared_ptr<RendererData>& WidgetRenderer::getSharedData() const
     {
         return m_data;
     }
@@ -136,12 +151,42 @@ namespace tgui
 
     std::shared_ptr<RendererData> WidgetRenderer::clone() const
     {
-        auto data = std::make_shared<RendererData>(*m_data);
-        data->observers = {};
+        auto data = std::make_shared<RendererData>();
+        data->propertyValuePairs = m_data->propertyValuePairs;
+        data->shared = m_data->shared;
         return data;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetRenderer::copyOnWrite(const void* id)
+    {
+        m_copyOnWriteId = id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetRenderer::detachData() const
+    {
+        if (!m_copyOnWriteId)
+            return;
+
+        auto data = clone();
+        data->shared = false;
+
+        // Only the callback of the widget that owns this renderer moves to the copy, other widgets keep using the shared data
+        const auto it = m_data->observers.find(m_copyOnWriteId);
+        if (it != m_data->observers.end())
+        {
+            data->observers.emplace(it->first, std::move(it->second));
+            m_data->observers.erase(it);
+        }
+
+        m_data = data;
+        m_copyOnWriteId = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,12 @@
 #include <TGUI/String.hpp>
 
 #include <cctype> // tolower, toupper, isspace
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <clocale>
 
 #if TGUI_COMPILED_WITH_CPP_VER >= 17
     #include <charconv>
@@ -65,69 +71,468 @@ namespace tgui
 
     int strToInt(const std::string& str, int defaultValue)
     {
-#if TGUI_COMPILED_WITH_CPP_VER >= 17
         int value;
-        const char* cstr = str.c_str();
-        if (std::from_chars(&cstr[0], &cstr[str.length()], value).ec == std::errc{})
+        if (priv::parseInt(str.data(), str.data() + str.length(), value))
             return value;
         else
             return defaultValue;
-#else
-        try
-        {
-            return std::stoi(str);
-        }
-        catch (const std::exception&)
-        {
-            return defaultValue;
-        }
-#endif
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int strToUInt(const std::string& str, unsigned int defaultValue)
     {
-#if TGUI_COMPILED_WITH_CPP_VER >= 17
         unsigned int value;
-        const char* cstr = str.c_str();
-        if (std::from_chars(&cstr[0], &cstr[str.length()], value).ec == std::errc{})
+        if (priv::parseUInt(str.data(), str.data() + str.length(), value))
             return value;
         else
             return defaultValue;
-#else
-        try
-        {
-            return static_cast<unsigned int>(std::stoi(str));
-        }
-        catch (const std::exception&)
-        {
-            return defaultValue;
-        }
-#endif
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     float strToFloat(const std::string& str, float defaultValue)
     {
-#if TGUI_COMPILED_WITH_CPP_VER >= 17
         float value;
-        const char* cstr = str.c_str();
-        if (std::from_chars(&cstr[0], &cstr[str.length()], value).ec == std::errc{})
+        if (priv::parseFloat(str.data(), str.data() + str.length(), value))
             return value;
         else
             return defaultValue;
-#else
-        try
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace priv
+    {
+        namespace
         {
-            return std::stof(str);
+#if TGUI_COMPILED_WITH_CPP_VER < 17
+            bool isDigit(char c)
+            {
+                return (c >= '0') && (c <= '9');
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            // Skips leading whitespace and an optional sign, just like strtol and strtof. Returns false when there is a minus sign.
+            bool skipWhitespaceAndSign(const char*& it, const char* end)
+            {
+                it = skipWhitespace(it, end);
+
+                if ((it != end) && (*it == '+'))
+                    ++it;
+                else if ((it != end) && (*it == '-'))
+                {
+                    ++it;
+                    return false;
+                }
+
+                return true;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            int getHexDigitValue(char c)
+            {
+                if (isDigit(c))
+                    return c - '0';
+                else if ((c >= 'a') && (c <= 'f'))
+                    return c - 'a' + 10;
+                else if ((c >= 'A') && (c <= 'F'))
+                    return c - 'A' + 10;
+                else
+                    return -1;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            // Checks whether the characters start with the given lowercase word, ignoring the case of the characters
+            bool startsWithWord(const char* it, const char* end, const char* word)
+            {
+                for (; *word != '\0'; ++word, ++it)
+                {
+                    if ((it == end) || ((*it != *word) && (*it != *word - 'a' + 'A')))
+                        return false;
+                }
+
+                return true;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            // Parses the digits of an unsigned number. The value is limited to maxValue to detect overflows.
+            const char* parseDigits(const char* it, const char* end, unsigned long long maxValue, unsigned long long& value)
+            {
+                if ((it == end) || !isDigit(*it))
+                    return nullptr;
+
+                value = 0;
+                while ((it != end) && isDigit(*it))
+                {
+                    const unsigned int digit = static_cast<unsigned int>(*it - '0');
+                    if (value > (maxValue - digit) / 10)
+                        return nullptr;
+
+                    value = (value * 10) + digit;
+                    ++it;
+                }
+
+                return it;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            // Parses the exponent of a float, starting at the character behind the 'e' or 'p'. The exponent is only part of the
+            // number when it contains digits (e.g. in "5em" the 'e' isn't part of the number), nullptr is returned otherwise.
+            const char* parseExponent(const char* it, const char* end, int& exponent)
+            {
+                bool positive = true;
+                if ((it != end) && ((*it == '+') || (*it == '-')))
+                {
+                    positive = (*it == '+');
+                    ++it;
+                }
+
+                if ((it == end) || !isDigit(*it))
+                    return nullptr;
+
+                // All digits belong to the exponent, but the value no longer matters once it is out of range for a float
+                int value = 0;
+                while ((it != end) && isDigit(*it))
+                {
+                    if (value < 100000)
+                        value = (value * 10) + (*it - '0');
+
+                    ++it;
+                }
+
+                exponent = positive ? value : -value;
+                return it;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            // Parses a hexadecimal float without the "0x" prefix (e.g. "1.8p3"). The caller checked that there is a digit.
+            const char* parseHexFloat(const char* it, const char* end, double& result, bool& nonZero)
+            {
+                // Hexadecimal digits that no longer fit in the mantissa only change the exponent
+                const unsigned long long maxMantissa = 1ull << 59;
+                unsigned long long mantissa = 0;
+                int exponent = 0;
+
+                while ((it != end) && (getHexDigitValue(*it) >= 0))
+                {
+                    if (mantissa < maxMantissa)
+                        mantissa = (mantissa * 16) + static_cast<unsigned int>(getHexDigitValue(*it));
+                    else
+                        exponent += 4;
+
+                    ++it;
+                }
+
+                if ((it != end) && (*it == '.'))
+                {
+                    ++it;
+                    while ((it != end) && (getHexDigitValue(*it) >= 0))
+                    {
+                        if (mantissa < maxMantissa)
+                        {
+                            mantissa = (mantissa * 16) + static_cast<unsigned int>(getHexDigitValue(*it));
+                            exponent -= 4;
+                        }
+
+                        ++it;
+                    }
+                }
+
+                int binaryExponent;
+                if ((it != end) && ((*it == 'p') || (*it == 'P')))
+                {
+                    const char* exponentIt = parseExponent(it + 1, end, binaryExponent);
+                    if (exponentIt)
+                    {
+                        exponent += binaryExponent;
+                        it = exponentIt;
+                    }
+                }
+
+                nonZero = (mantissa != 0);
+                result = std::ldexp(static_cast<double>(mantissa), exponent);
+                return it;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            // Parses a decimal float (e.g. "1.5e3"), returns nullptr when there are no digits
+            const char* parseDecimalFloat(const char* it, const char* end, double& result, bool& nonZero)
+            {
+                // The significant digits are collected in an integer, the position of the decimal point is kept in the exponent.
+                // Digits that no longer fit in the integer only change the exponent.
+                const unsigned int maxSignificantDigits = 19;
+                unsigned long long significand = 0;
+                unsigned int significantDigits = 0;
+                int exponent = 0;
+                bool digitFound = false;
+
+                while ((it != end) && isDigit(*it))
+                {
+                    digitFound = true;
+                    if (significantDigits < maxSignificantDigits)
+                    {
+                        significand = (significand * 10) + static_cast<unsigned int>(*it - '0');
+                        if (significand > 0)
+                            ++significantDigits;
+                    }
+                    else
+                        ++exponent;
+
+                    ++it;
+                }
+
+                if ((it != end) && (*it == '.'))
+                {
+                    ++it;
+                    while ((it != end) && isDigit(*it))
+                    {
+                        digitFound = true;
+                        if (significantDigits < maxSignificantDigits)
+                        {
+                            significand = (significand * 10) + static_cast<unsigned int>(*it - '0');
+                            if (significand > 0)
+                                ++significantDigits;
+
+                            --exponent;
+                        }
+
+                        ++it;
+                    }
+                }
+
+                if (!digitFound)
+                    return nullptr;
+
+                int explicitExponent;
+                if ((it != end) && ((*it == 'e') || (*it == 'E')))
+                {
+                    const char* exponentIt = parseExponent(it + 1, end, explicitExponent);
+                    if (exponentIt)
+                    {
+                        exponent += explicitExponent;
+                        it = exponentIt;
+                    }
+                }
+
+                // Powers of ten up to 1e22 are exactly representable as a double. Dividing by an exact power of ten gives a more
+                // accurate result than multiplying with an inexact negative power.
+                static const double powersOfTen[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                                     1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+                nonZero = (significand != 0);
+                result = static_cast<double>(significand);
+                if (nonZero)
+                {
+                    while ((exponent > 0) && (result <= std::numeric_limits<float>::max()))
+                    {
+                        const int step = std::min(exponent, 22);
+                        result *= powersOfTen[step];
+                        exponent -= step;
+                    }
+                    while ((exponent < 0) && (result > 0))
+                    {
+                        const int step = std::min(-exponent, 22);
+                        result /= powersOfTen[step];
+                        exponent += step;
+                    }
+                }
+
+                return it;
+            }
+#endif
         }
-        catch (const std::exception&)
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const char* skipWhitespace(const char* begin, const char* end)
         {
-            return defaultValue;
+            // Same characters as std::isspace in the "C" locale
+            while ((begin != end) && ((*begin == ' ') || ((*begin >= '\t') && (*begin <= '\r'))))
+                ++begin;
+
+            return begin;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const char* parseInt(const char* begin, const char* end, int& value)
+        {
+#if TGUI_COMPILED_WITH_CPP_VER >= 17
+            const auto result = std::from_chars(begin, end, value);
+            return (result.ec == std::errc{}) ? result.ptr : nullptr;
+#else
+            const char* it = begin;
+            const bool positive = skipWhitespaceAndSign(it, end);
+
+            // The negative range is one larger than the positive range
+            const unsigned long long maxValue = positive ? static_cast<unsigned long long>(std::numeric_limits<int>::max())
+                                                         : static_cast<unsigned long long>(std::numeric_limits<int>::max()) + 1;
+            unsigned long long absValue;
+            it = parseDigits(it, end, maxValue, absValue);
+            if (!it)
+                return nullptr;
+
+            if (positive)
+                value = static_cast<int>(absValue);
+            else
+                value = static_cast<int>(-static_cast<long long>(absValue));
+
+            return it;
+#endif
         }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const char* parseUInt(const char* begin, const char* end, unsigned int& value)
+        {
+#if TGUI_COMPILED_WITH_CPP_VER >= 17
+            const auto result = std::from_chars(begin, end, value);
+            return (result.ec == std::errc{}) ? result.ptr : nullptr;
+#else
+            // Unsigned values were parsed with std::stoi as well, so negative values wrap around
+            int signedValue;
+            const char* it = parseInt(begin, end, signedValue);
+            if (!it)
+                return nullptr;
+
+            value = static_cast<unsigned int>(signedValue);
+            return it;
+#endif
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const char* parseFloat(const char* begin, const char* end, float& value)
+        {
+#if TGUI_COMPILED_WITH_CPP_VER >= 17
+            const auto result = std::from_chars(begin, end, value);
+            return (result.ec == std::errc{}) ? result.ptr : nullptr;
+#else
+            const char* it = begin;
+            const bool positive = skipWhitespaceAndSign(it, end);
+
+            // Infinity and NaN are written out, in any case
+            if (startsWithWord(it, end, "inf"))
+            {
+                it += startsWithWord(it, end, "infinity") ? 8 : 3;
+                value = positive ? std::numeric_limits<float>::infinity() : -std::numeric_limits<float>::infinity();
+                return it;
+            }
+            if (startsWithWord(it, end, "nan"))
+            {
+                it += 3;
+
+                // The NaN can be followed by letters, digits and underscores between brackets
+                if ((it != end) && (*it == '('))
+                {
+                    const char* bracketIt = it + 1;
+                    while ((bracketIt != end) && (isDigit(*bracketIt) || (*bracketIt == '_')
+                        || ((*bracketIt >= 'a') && (*bracketIt <= 'z')) || ((*bracketIt >= 'A') && (*bracketIt <= 'Z'))))
+                    {
+                        ++bracketIt;
+                    }
+
+                    if ((bracketIt != end) && (*bracketIt == ')'))
+                        it = bracketIt + 1;
+                }
+
+                value = positive ? std::numeric_limits<float>::quiet_NaN() : -std::numeric_limits<float>::quiet_NaN();
+                return it;
+            }
+
+            // The "0x" prefix only belongs to a hexadecimal float when a digit follows, otherwise only the 0 is parsed
+            const char* hexIt = nullptr;
+            if ((end - it >= 3) && (it[0] == '0') && ((it[1] == 'x') || (it[1] == 'X')))
+            {
+                const char* digitIt = (it[2] == '.') ? it + 3 : it + 2;
+                if ((digitIt != end) && (getHexDigitValue(*digitIt) >= 0))
+                    hexIt = it + 2;
+            }
+
+            double result;
+            bool nonZero;
+            if (hexIt)
+                it = parseHexFloat(hexIt, end, result, nonZero);
+            else
+                it = parseDecimalFloat(it, end, result, nonZero);
+
+            if (!it)
+                return nullptr;
+
+            // Just like with std::stof, values that don't fit in a float are rejected. Values slightly larger than the maximum
+            // are still accepted when they would be rounded down to the maximum (up to half the distance to the next float).
+            const double halfFloatUlpAtMax = std::ldexp(1.0, std::numeric_limits<float>::max_exponent - std::numeric_limits<float>::digits - 1);
+            if (result >= static_cast<double>(std::numeric_limits<float>::max()) + halfFloatUlpAtMax)
+                return nullptr;
+
+            // Non-zero values that are too small to be stored as a normal float are rejected by std::stof as well
+            if (nonZero && (std::abs(static_cast<float>(result)) < std::numeric_limits<float>::min()))
+                return nullptr;
+
+            value = static_cast<float>(positive ? result : -result);
+            return it;
 #endif
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::string formatUnsignedInteger(unsigned long long value)
+        {
+            char buffer[std::numeric_limits<unsigned long long>::digits10 + 2];
+            char* const end = buffer + sizeof(buffer);
+            char* it = end;
+            do
+            {
+                *--it = static_cast<char>('0' + (value % 10));
+                value /= 10;
+            }
+            while (value > 0);
+
+            return std::string(it, end);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::string formatSignedInteger(long long value)
+        {
+            if (value >= 0)
+                return formatUnsignedInteger(static_cast<unsigned long long>(value));
+
+            // Negate as unsigned value to also handle the smallest possible number
+            return '-' + formatUnsignedInteger(0ull - static_cast<unsigned long long>(value));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::string formatFloat(double value)
+        {
+            // "%g" produces the same output as a stream with the default precision of 6 digits
+            char buffer[32];
+            const int length = std::snprintf(buffer, sizeof(buffer), "%g", value);
+            if (length <= 0)
+                return {};
+
+            std::string result(buffer, std::min(static_cast<std::size_t>(length), sizeof(buffer) - 1));
+
+            // The C locale decides which decimal point is used by snprintf, but the output has to use a dot
+            const char* decimalPoint = std::localeconv()->decimal_point;
+            if (decimalPoint && (decimalPoint[0] != '\0') && ((decimalPoint[0] != '.') || (decimalPoint[1] != '\0')))
+            {
+                const auto pos = result.find(decimalPoint);
+                if (pos != std::string::npos)
+                    result.replace(pos, std::strlen(decimalPoint), ".");
+            }
+
+            return result;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,7 +26,9 @@
 #include <TGUI/Text.hpp>
 #include <TGUI/Global.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -38,6 +40,60 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    namespace
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void addTextGlyphQuad(std::vector<sf::Vertex>& vertices, Vector2f position, const sf::Color& color, const sf::Glyph& glyph, float italicShear)
+        {
+            const float padding = 1;
+
+            const float left   = glyph.bounds.left - padding;
+            const float top    = glyph.bounds.top - padding;
+            const float right  = glyph.bounds.left + glyph.bounds.width + padding;
+            const float bottom = glyph.bounds.top + glyph.bounds.height + padding;
+
+            const float u1 = static_cast<float>(glyph.textureRect.left) - padding;
+            const float v1 = static_cast<float>(glyph.textureRect.top) - padding;
+            const float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
+            const float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + padding;
+
+            vertices.emplace_back(sf::Vector2f{position.x + left - italicShear * top, position.y + top}, color, sf::Vector2f{u1, v1});
+            vertices.emplace_back(sf::Vector2f{position.x + right - italicShear * top, position.y + top}, color, sf::Vector2f{u2, v1});
+            vertices.emplace_back(sf::Vector2f{position.x + left - italicShear * bottom, position.y + bottom}, color, sf::Vector2f{u1, v2});
+            vertices.emplace_back(sf::Vector2f{position.x + left - italicShear * bottom, position.y + bottom}, color, sf::Vector2f{u1, v2});
+            vertices.emplace_back(sf::Vector2f{position.x + right - italicShear * top, position.y + top}, color, sf::Vector2f{u2, v1});
+            vertices.emplace_back(sf::Vector2f{position.x + right - italicShear * bottom, position.y + bottom}, color, sf::Vector2f{u2, v2});
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void addTextLine(std::vector<sf::Vertex>& vertices, float lineLength, float lineTop, const sf::Color& color, float offset, float thickness, float outlineThickness = 0)
+        {
+            const float top = std::floor(lineTop + offset - (thickness / 2) + 0.5f);
+            const float bottom = top + std::floor(thickness + 0.5f);
+
+            vertices.emplace_back(sf::Vector2f{-outlineThickness, top - outlineThickness}, color, sf::Vector2f{1, 1});
+            vertices.emplace_back(sf::Vector2f{lineLength + outlineThickness, top - outlineThickness}, color, sf::Vector2f{1, 1});
+            vertices.emplace_back(sf::Vector2f{-outlineThickness, bottom + outlineThickness}, color, sf::Vector2f{1, 1});
+            vertices.emplace_back(sf::Vector2f{-outlineThickness, bottom + outlineThickness}, color, sf::Vector2f{1, 1});
+            vertices.emplace_back(sf::Vector2f{lineLength + outlineThickness, top - outlineThickness}, color, sf::Vector2f{1, 1});
+            vertices.emplace_back(sf::Vector2f{lineLength + outlineThickness, bottom + outlineThickness}, color, sf::Vector2f{1, 1});
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void setTextVertexColors(std::vector<sf::Vertex>& vertices, const sf::Color& color)
+        {
+            for (auto& vertex : vertices)
+                vertex.color = color;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2f Text::getSize() const
     {
         return m_size;
@@ -47,7 +103,11 @@ namespace tgui
 
     void Text::setString(const sf::String& string)
     {
-        m_text.setString(string);
+        if (string == m_string)
+            return;
+
+        m_string = string;
+        m_geometryNeedUpdate = true;
         recalculateSize();
     }
 
@@ -55,14 +115,18 @@ namespace tgui
 
     const sf::String& Text::getString() const
     {
-        return m_text.getString();
+        return m_string;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Text::setCharacterSize(unsigned int size)
     {
-        m_text.setCharacterSize(size);
+        if (size == m_characterSize)
+            return;
+
+        m_characterSize = size;
+        m_geometryNeedUpdate = true;
         recalculateSize();
     }
 
@@ -70,7 +134,7 @@ namespace tgui
 
     unsigned int Text::getCharacterSize() const
     {
-        return m_text.getCharacterSize();
+        return m_characterSize;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -78,12 +142,7 @@ namespace tgui
     void Text::setColor(Color color)
     {
         m_color = color;
-
-#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        m_text.setFillColor(Color::calcColorOpacity(color, m_opacity));
-#else
-        m_text.setColor(Color::calcColorOpacity(color, m_opacity));
-#endif
+        updateVertexColors();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -98,13 +157,7 @@ namespace tgui
     void Text::setOpacity(float opacity)
     {
         m_opacity = opacity;
-
-#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        m_text.setFillColor(Color::calcColorOpacity(m_color, opacity));
-        m_text.setOutlineColor(Color::calcColorOpacity(m_outlineColor, opacity));
-#else
-        m_text.setColor(Color::calcColorOpacity(m_color, opacity));
-#endif
+        updateVertexColors();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -118,30 +171,11 @@ namespace tgui
 
     void Text::setFont(Font font)
     {
-        m_font = font;
-
-        if (font)
-            m_text.setFont(*font.getFont());
-        else
-        {
-            // We can't keep using a pointer to the old font (it might be destroyed), but sf::Text has no function to pass an empty font
-            if (m_text.getFont())
-            {
-                m_text = sf::Text();
-                m_text.setString(getString());
-                m_text.setCharacterSize(getCharacterSize());
-                m_text.setStyle(getStyle());
-
-#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-                m_text.setFillColor(Color::calcColorOpacity(getColor(), getOpacity()));
-                m_text.setOutlineColor(Color::calcColorOpacity(getOutlineColor(), getOpacity()));
-                m_text.setOutlineThickness(getOutlineThickness());
-#else
-                m_text.setColor(Color::calcColorOpacity(getColor(), getOpacity()));
-#endif
-            }
-        }
+        if (font == m_font)
+            return;
 
+        m_font = font;
+        m_geometryNeedUpdate = true;
         recalculateSize();
     }
 
@@ -156,9 +190,10 @@ namespace tgui
 
     void Text::setStyle(TextStyle style)
     {
-        if (style != m_text.getStyle())
+        if (style != m_style)
         {
-            m_text.setStyle(style);
+            m_style = style;
+            m_geometryNeedUpdate = true;
             recalculateSize();
         }
     }
@@ -167,7 +202,7 @@ namespace tgui
 
     TextStyle Text::getStyle() const
     {
-        return m_text.getStyle();
+        return m_style;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -175,10 +210,7 @@ namespace tgui
     void Text::setOutlineColor(Color color)
     {
         m_outlineColor = color;
-
-#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        m_text.setOutlineColor(Color::calcColorOpacity(m_outlineColor, m_opacity));
-#endif
+        updateVertexColors();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -193,7 +225,11 @@ namespace tgui
     void Text::setOutlineThickness(float thickness)
     {
 #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        m_text.setOutlineThickness(thickness);
+        if (thickness != m_outlineThickness)
+        {
+            m_outlineThickness = thickness;
+            m_geometryNeedUpdate = true;
+        }
 #else
         (void)thickness;
 #endif
@@ -203,24 +239,69 @@ namespace tgui
 
     float Text::getOutlineThickness() const
     {
-#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        return m_text.getOutlineThickness();
-#else
-        return 0;
-#endif
+        return m_outlineThickness;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Vector2f Text::findCharacterPos(std::size_t index) const
     {
-        return m_text.findCharacterPos(index);
+        if (m_font == nullptr)
+            return {};
+
+        if (index > m_string.getSize())
+            index = m_string.getSize();
+
+        const bool bold = (m_style & sf::Text::Bold) != 0;
+        const float whitespaceWidth = m_font.getGlyph(' ', m_characterSize, bold).advance;
+        const float lineSpacing = m_font.getLineSpacing(m_characterSize);
+
+        Vector2f position;
+        std::uint32_t prevChar = 0;
+        for (std::size_t i = 0; i < index; ++i)
+        {
+            const std::uint32_t curChar = m_string[i];
+
+            position.x += m_font.getKerning(prevChar, curChar, m_characterSize);
+            prevChar = curChar;
+
+            if (curChar == ' ')
+                position.x += whitespaceWidth;
+            else if (curChar == '\t')
+                position.x += whitespaceWidth * 4;
+            else if (curChar == '\n')
+            {
+                position.y += lineSpacing;
+                position.x = 0;
+            }
+            else
+                position.x += m_font.getGlyph(curChar, m_characterSize, bold).advance;
+        }
+
+        return position;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Text::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        if (m_font == nullptr)
+            return;
+
+        // The vertices have to be recreated when the font was reloaded since they were created
+        const std::shared_ptr<sf::Font> font = m_font.getFont();
+        if ((&font->getTexture(m_characterSize) != m_fontTexture) || (m_fontTexture->getNativeHandle() != m_fontTextureHandle))
+            m_geometryNeedUpdate = true;
+
+        updateGeometry();
+
+        // Creating the vertices can add glyphs to the font, which replaces the texture with a larger one when it is full
+        m_fontTexture = &font->getTexture(m_characterSize);
+        m_fontTextureHandle = m_fontTexture->getNativeHandle();
+
+        if (m_vertices.empty())
+            return;
+
         states.transform *= getTransform();
 
         // Round the position to avoid blurry text
@@ -229,7 +310,12 @@ namespace tgui
                                          matrix[1], matrix[5], std::floor(matrix[13]),
                                          matrix[3], matrix[7], matrix[15]};
 
-        target.draw(m_text, states);
+        states.texture = m_fontTexture;
+
+        if (!m_outlineVertices.empty())
+            target.draw(m_outlineVertices.data(), m_outlineVertices.size(), sf::Triangles, states);
+
+        target.draw(m_vertices.data(), m_vertices.size(), sf::Triangles, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -246,33 +332,160 @@ namespace tgui
         float maxWidth = 0;
         unsigned int lines = 1;
         std::uint32_t prevChar = 0;
-        const sf::String& string = m_text.getString();
-        const bool bold = (m_text.getStyle() & sf::Text::Bold) != 0;
-        const unsigned int textSize = m_text.getCharacterSize();
-        for (std::size_t i = 0; i < string.getSize(); ++i)
+        const bool bold = (m_style & sf::Text::Bold) != 0;
+        for (std::size_t i = 0; i < m_string.getSize(); ++i)
         {
-            const float kerning = m_font.getKerning(prevChar, string[i], textSize);
-            if (string[i] == '\n')
+            const float kerning = m_font.getKerning(prevChar, m_string[i], m_characterSize);
+            if (m_string[i] == '\n')
             {
                 maxWidth = std::max(maxWidth, width);
                 width = 0;
                 lines++;
             }
-            else if (string[i] == '\t')
-                width += (static_cast<float>(m_font.getGlyph(' ', textSize, bold).advance) * 4) + kerning;
+            else if (m_string[i] == '\t')
+                width += (static_cast<float>(m_font.getGlyph(' ', m_characterSize, bold).advance) * 4) + kerning;
             else
-                width += static_cast<float>(m_font.getGlyph(string[i], textSize, bold).advance) + kerning;
+                width += static_cast<float>(m_font.getGlyph(m_string[i], m_characterSize, bold).advance) + kerning;
 
-            prevChar = string[i];
+            prevChar = m_string[i];
         }
 
-        const float extraVerticalSpace = Text::calculateExtraVerticalSpace(m_font, m_text.getCharacterSize(), m_text.getStyle());
-        const float height = lines * m_font.getLineSpacing(m_text.getCharacterSize()) + extraVerticalSpace;
+        const float extraVerticalSpace = Text::calculateExtraVerticalSpace(m_font, m_characterSize, m_style);
+        const float height = lines * m_font.getLineSpacing(m_characterSize) + extraVerticalSpace;
         m_size = {std::max(maxWidth, width), height};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Text::updateVertexColors()
+    {
+        const sf::Color fillColor = Color::calcColorOpacity(m_color, m_opacity);
+        const sf::Color outlineColor = Color::calcColorOpacity(m_outlineColor, m_opacity);
+
+        // The vertices don't need to be touched when they are going to be recreated anyway
+        if (!m_geometryNeedUpdate)
+        {
+            if (fillColor != m_fillColorCached)
+                setTextVertexColors(m_vertices, fillColor);
+            if (outlineColor != m_outlineColorCached)
+                setTextVertexColors(m_outlineVertices, outlineColor);
+        }
+
+        m_fillColorCached = fillColor;
+        m_outlineColorCached = outlineColor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Text::updateGeometry() const
+    {
+        if (!m_geometryNeedUpdate)
+            return;
+
+        m_geometryNeedUpdate = false;
+
+        // The vectors are cleared instead of recreated so that their memory can be reused
+        m_vertices.clear();
+        m_outlineVertices.clear();
+
+        if ((m_font == nullptr) || m_string.isEmpty())
+            return;
+
+        const bool bold = (m_style & sf::Text::Bold) != 0;
+        const bool underlined = (m_style & sf::Text::Underlined) != 0;
+        const bool strikeThrough = (m_style & sf::Text::StrikeThrough) != 0;
+        const float italicShear = (m_style & sf::Text::Italic) ? 0.209f : 0.f; // 12 degrees in radians
+
+        const std::shared_ptr<sf::Font> font = m_font.getFont();
+        const float underlineOffset = font->getUnderlinePosition(m_characterSize);
+        const float underlineThickness = font->getUnderlineThickness(m_characterSize);
+
+        // The strike through line is placed in the middle of the lowercase 'x'
+        const sf::FloatRect xBounds = m_font.getGlyph('x', m_characterSize, bold).bounds;
+        const float strikeThroughOffset = xBounds.top + xBounds.height / 2.f;
+
+        const float whitespaceWidth = m_font.getGlyph(' ', m_characterSize, bold).advance;
+        const float lineSpacing = m_font.getLineSpacing(m_characterSize);
+
+        // Every character uses 6 vertices, reserving the space up front avoids reallocating while adding the glyphs
+        m_vertices.reserve(m_string.getSize() * 6);
+        if (m_outlineThickness != 0)
+            m_outlineVertices.reserve(m_string.getSize() * 6);
+
+        float x = 0;
+        float y = static_cast<float>(m_characterSize);
+        std::uint32_t prevChar = 0;
+        for (std::size_t i = 0; i < m_string.getSize(); ++i)
+        {
+            const std::uint32_t curChar = m_string[i];
+
+            x += m_font.getKerning(prevChar, curChar, m_characterSize);
+
+            // Finish the lines when reaching the end of the line
+            if ((curChar == '\n') && (prevChar != '\n'))
+            {
+                if (underlined)
+                {
+                    addTextLine(m_vertices, x, y, m_fillColorCached, underlineOffset, underlineThickness);
+                    if (m_outlineThickness != 0)
+                        addTextLine(m_outlineVertices, x, y, m_outlineColorCached, underlineOffset, underlineThickness, m_outlineThickness);
+                }
+
+                if (strikeThrough)
+                {
+                    addTextLine(m_vertices, x, y, m_fillColorCached, strikeThroughOffset, underlineThickness);
+                    if (m_outlineThickness != 0)
+                        addTextLine(m_outlineVertices, x, y, m_outlineColorCached, strikeThroughOffset, underlineThickness, m_outlineThickness);
+                }
+            }
+
+            prevChar = curChar;
+
+            // Whitespace characters don't have a glyph to draw
+            if (curChar == ' ')
+            {
+                x += whitespaceWidth;
+                continue;
+            }
+            else if (curChar == '\t')
+            {
+                x += whitespaceWidth * 4;
+                continue;
+            }
+            else if (curChar == '\n')
+            {
+                y += lineSpacing;
+                x = 0;
+                continue;
+            }
+
+            if (m_outlineThickness != 0)
+                addTextGlyphQuad(m_outlineVertices, {x, y}, m_outlineColorCached, m_font.getGlyph(curChar, m_characterSize, bold, m_outlineThickness), italicShear);
+
+            const sf::Glyph& glyph = m_font.getGlyph(curChar, m_characterSize, bold);
+            addTextGlyphQuad(m_vertices, {x, y}, m_fillColorCached, glyph, italicShear);
+
+            x += glyph.advance;
+        }
+
+        // Add the lines on the last line of the text
+        if (underlined && (x > 0))
+        {
+            addTextLine(m_vertices, x, y, m_fillColorCached, underlineOffset, underlineThickness);
+            if (m_outlineThickness != 0)
+                addTextLine(m_outlineVertices, x, y, m_outlineColorCached, underlineOffset, underlineThickness, m_outlineThickness);
+        }
+
+        if (strikeThrough && (x > 0))
+        {
+            addTextLine(m_vertices, x, y, m_fillColorCached, strikeThroughOffset, underlineThickness);
+            if (m_outlineThickness != 0)
+                addTextLine(m_outlineVertices, x, y, m_outlineColorCached, strikeThroughOffset, underlineThickness, m_outlineThickness);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     float Text::getExtraHorizontalPadding(const Text& text)
     {
@@ -450,6 +663,19 @@ namespace tgui
 
     sf::String Text::wordWrap(float maxWidth, const sf::String& text, Font font, unsigned int textSize, bool bold, bool dropLeadingSpace)
     {
+        float minimumWidth;
+        float maximumWidth;
+        return wordWrap(maxWidth, text, font, textSize, bold, dropLeadingSpace, minimumWidth, maximumWidth);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String Text::wordWrap(float maxWidth, const sf::String& text, Font font, unsigned int textSize, bool bold, bool dropLeadingSpace,
+                              float& minimumWidth, float& maximumWidth)
+    {
+        minimumWidth = 0;
+        maximumWidth = (maxWidth == 0) ? 0 : std::numeric_limits<float>::infinity();
+
         if (font == nullptr)
             return "";
 
@@ -483,11 +709,19 @@ namespace tgui
                     index++;
                 }
                 else
+                {
+                    // A larger maximum width would allow this character to be placed on the line as well
+                    maximumWidth = std::min(maximumWidth, width + charWidth + kerning);
                     break;
+                }
 
                 prevChar = curChar;
             }
 
+            // The characters that were placed on the line must still fit when the maximum width becomes smaller
+            if (maxWidth != 0)
+                minimumWidth = std::max(minimumWidth, width);
+
             // Every line contains at least one character
             if (index == oldIndex)
                 index++;
@@ -0,0 +1,510 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/TextBuffer.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    constexpr std::size_t TextBuffer::NoNode;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextBuffer::TextBuffer(const sf::String& text)
+    {
+        setText(text);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBuffer::setText(const sf::String& text)
+    {
+        m_originalBuffer = text.toUtf32();
+        m_originalBuffer.shrink_to_fit();
+        m_addedBuffer = {};
+        m_addedLineBreaks = {};
+        m_pieces.clear();
+        m_unusedPieces.clear();
+
+        m_originalLineBreaks.clear();
+        for (std::size_t i = 0; i < m_originalBuffer.size(); ++i)
+        {
+            if (m_originalBuffer[i] == '\n')
+                m_originalLineBreaks.push_back(i);
+        }
+        m_originalLineBreaks.shrink_to_fit();
+
+        m_root = m_originalBuffer.empty() ? NoNode : createPiece(false, 0, m_originalBuffer.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String TextBuffer::getText() const
+    {
+        return getSubstring(0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String TextBuffer::getSubstring(std::size_t pos, std::size_t count) const
+    {
+        const std::size_t size = getSize();
+        if (pos >= size)
+            return "";
+
+        count = std::min(count, size - pos);
+
+        std::basic_string<std::uint32_t> str;
+        str.reserve(count);
+        appendCharacters(m_root, pos, count, str);
+        return str;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint32_t TextBuffer::getCharacter(std::size_t pos) const
+    {
+        assert(pos < getSize());
+
+        std::size_t node = m_root;
+        while (node != NoNode)
+        {
+            const Piece& piece = m_pieces[node];
+            const std::size_t leftLength = (piece.left != NoNode) ? m_pieces[piece.left].subtreeLength : 0;
+            if (pos < leftLength)
+                node = piece.left;
+            else if (pos < leftLength + piece.length)
+                return (piece.added ? m_addedBuffer : m_originalBuffer)[piece.start + pos - leftLength];
+            else
+            {
+                pos -= leftLength + piece.length;
+                node = piece.right;
+            }
+        }
+
+        return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextBuffer::getSize() const
+    {
+        return (m_root != NoNode) ? m_pieces[m_root].subtreeLength : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextBuffer::isEmpty() const
+    {
+        return m_root == NoNode;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBuffer::insert(std::size_t pos, const sf::String& text)
+    {
+        if (text.isEmpty())
+            return;
+
+        pos = std::min(pos, getSize());
+
+        // The inserted characters are always appended to the added buffer
+        const std::size_t addedStart = m_addedBuffer.size();
+        m_addedBuffer.append(text.begin(), text.end());
+
+        std::size_t lineBreaks = 0;
+        for (std::size_t i = addedStart; i < m_addedBuffer.size(); ++i)
+        {
+            if (m_addedBuffer[i] == '\n')
+            {
+                m_addedLineBreaks.push_back(i);
+                ++lineBreaks;
+            }
+        }
+
+        // When typing, the new characters directly follow the ones from the previous insert and no new piece is needed
+        if (extendPieceEndingAt(m_root, pos, text.getSize(), lineBreaks, addedStart))
+            return;
+
+        const std::size_t newPiece = createPiece(true, addedStart, text.getSize());
+
+        std::size_t left;
+        std::size_t right;
+        split(m_root, pos, left, right);
+        m_root = merge(merge(left, newPiece), right);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBuffer::erase(std::size_t pos, std::size_t count)
+    {
+        const std::size_t size = getSize();
+        if ((pos >= size) || (count == 0))
+            return;
+
+        count = std::min(count, size - pos);
+
+        std::size_t left;
+        std::size_t middle;
+        std::size_t right;
+        split(m_root, pos, left, right);
+        split(right, count, middle, right);
+        releasePieces(middle);
+        m_root = merge(left, right);
+
+        // The added buffer can be cleared once no piece refers to it anymore
+        if (m_root == NoNode)
+        {
+            m_addedBuffer.clear();
+            m_addedLineBreaks.clear();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextBuffer::getLineCount() const
+    {
+        return ((m_root != NoNode) ? m_pieces[m_root].subtreeLineBreaks : 0) + 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextBuffer::getLineStart(std::size_t line) const
+    {
+        if (line == 0)
+            return 0;
+
+        // Search the piece that contains the newline in front of the line
+        std::size_t lineBreak = line;
+        std::size_t offset = 0;
+        std::size_t node = m_root;
+        while (node != NoNode)
+        {
+            const Piece& piece = m_pieces[node];
+            const std::size_t leftLength = (piece.left != NoNode) ? m_pieces[piece.left].subtreeLength : 0;
+            const std::size_t leftLineBreaks = (piece.left != NoNode) ? m_pieces[piece.left].subtreeLineBreaks : 0;
+            if (lineBreak <= leftLineBreaks)
+                node = piece.left;
+            else if (lineBreak <= leftLineBreaks + piece.lineBreaks)
+            {
+                const std::vector<std::size_t>& lineBreaks = piece.added ? m_addedLineBreaks : m_originalLineBreaks;
+                const auto firstLineBreakIt = std::lower_bound(lineBreaks.begin(), lineBreaks.end(), piece.start);
+                const std::size_t lineBreakPos = *(firstLineBreakIt + static_cast<std::ptrdiff_t>(lineBreak - leftLineBreaks - 1));
+                return offset + leftLength + (lineBreakPos - piece.start) + 1;
+            }
+            else
+            {
+                lineBreak -= leftLineBreaks + piece.lineBreaks;
+                offset += leftLength + piece.length;
+                node = piece.right;
+            }
+        }
+
+        return getSize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextBuffer::getLineLength(std::size_t line) const
+    {
+        const std::size_t start = getLineStart(line);
+        if (line + 1 < getLineCount())
+            return getLineStart(line + 1) - 1 - start;
+        else
+            return getSize() - start;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextBuffer::getLineOfPosition(std::size_t pos) const
+    {
+        std::size_t line = 0;
+        std::size_t node = m_root;
+        while (node != NoNode)
+        {
+            const Piece& piece = m_pieces[node];
+            const std::size_t leftLength = (piece.left != NoNode) ? m_pieces[piece.left].subtreeLength : 0;
+            if (pos <= leftLength)
+                node = piece.left;
+            else if (pos <= leftLength + piece.length)
+            {
+                line += (piece.left != NoNode) ? m_pieces[piece.left].subtreeLineBreaks : 0;
+                return line + countLineBreaks(piece.added, piece.start, pos - leftLength);
+            }
+            else
+            {
+                line += piece.lineBreaks + ((piece.left != NoNode) ? m_pieces[piece.left].subtreeLineBreaks : 0);
+                pos -= leftLength + piece.length;
+                node = piece.right;
+            }
+        }
+
+        return line;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextBuffer::getPieceCount() const
+    {
+        return m_pieces.size() - m_unusedPieces.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextBuffer::getMemoryUsage() const
+    {
+        return sizeof(TextBuffer)
+            + (m_originalBuffer.capacity() + m_addedBuffer.capacity()) * sizeof(std::uint32_t)
+            + (m_originalLineBreaks.capacity() + m_addedLineBreaks.capacity() + m_unusedPieces.capacity()) * sizeof(std::size_t)
+            + m_pieces.capacity() * sizeof(Piece);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextBuffer::createPiece(bool added, std::size_t start, std::size_t length)
+    {
+        std::size_t node;
+        if (!m_unusedPieces.empty())
+        {
+            node = m_unusedPieces.back();
+            m_unusedPieces.pop_back();
+        }
+        else
+        {
+            node = m_pieces.size();
+            m_pieces.emplace_back();
+        }
+
+        Piece& piece = m_pieces[node];
+        piece.added = added;
+        piece.start = start;
+        piece.length = length;
+        piece.lineBreaks = countLineBreaks(added, start, length);
+        piece.left = NoNode;
+        piece.right = NoNode;
+        piece.priority = generatePriority();
+        updatePiece(node);
+        return node;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBuffer::releasePieces(std::size_t node)
+    {
+        if (node == NoNode)
+            return;
+
+        releasePieces(m_pieces[node].left);
+        releasePieces(m_pieces[node].right);
+        m_unusedPieces.push_back(node);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBuffer::updatePiece(std::size_t node)
+    {
+        Piece& piece = m_pieces[node];
+        piece.subtreeLength = piece.length;
+        piece.subtreeLineBreaks = piece.lineBreaks;
+
+        if (piece.left != NoNode)
+        {
+            piece.subtreeLength += m_pieces[piece.left].subtreeLength;
+            piece.subtreeLineBreaks += m_pieces[piece.left].subtreeLineBreaks;
+        }
+
+        if (piece.right != NoNode)
+        {
+            piece.subtreeLength += m_pieces[piece.right].subtreeLength;
+            piece.subtreeLineBreaks += m_pieces[piece.right].subtreeLineBreaks;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBuffer::split(std::size_t node, std::size_t pos, std::size_t& left, std::size_t& right)
+    {
+        if (node == NoNode)
+        {
+            left = NoNode;
+            right = NoNode;
+            return;
+        }
+
+        // Splitting a piece creates a new node which may reallocate m_pieces, so no references to pieces can be kept around
+        const std::size_t leftLength = (m_pieces[node].left != NoNode) ? m_pieces[m_pieces[node].left].subtreeLength : 0;
+        if (pos <= leftLength)
+        {
+            std::size_t newLeftChild;
+            split(m_pieces[node].left, pos, left, newLeftChild);
+            m_pieces[node].left = newLeftChild;
+            updatePiece(node);
+            right = node;
+        }
+        else if (pos >= leftLength + m_pieces[node].length)
+        {
+            std::size_t newRightChild;
+            split(m_pieces[node].right, pos - leftLength - m_pieces[node].length, newRightChild, right);
+            m_pieces[node].right = newRightChild;
+            updatePiece(node);
+            left = node;
+        }
+        else // The split happens inside this piece
+        {
+            const std::size_t offset = pos - leftLength;
+            const std::size_t secondHalf = createPiece(m_pieces[node].added, m_pieces[node].start + offset, m_pieces[node].length - offset);
+            m_pieces[node].length = offset;
+            m_pieces[node].lineBreaks -= m_pieces[secondHalf].lineBreaks;
+
+            const std::size_t oldRight = m_pieces[node].right;
+            m_pieces[node].right = NoNode;
+            updatePiece(node);
+
+            left = node;
+            right = merge(secondHalf, oldRight);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextBuffer::merge(std::size_t left, std::size_t right)
+    {
+        if (left == NoNode)
+            return right;
+        if (right == NoNode)
+            return left;
+
+        if (m_pieces[left].priority > m_pieces[right].priority)
+        {
+            const std::size_t newRightChild = merge(m_pieces[left].right, right);
+            m_pieces[left].right = newRightChild;
+            updatePiece(left);
+            return left;
+        }
+        else
+        {
+            const std::size_t newLeftChild = merge(left, m_pieces[right].left);
+            m_pieces[right].left = newLeftChild;
+            updatePiece(right);
+            return right;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextBuffer::extendPieceEndingAt(std::size_t node, std::size_t pos, std::size_t length, std::size_t lineBreaks, std::size_t addedStart)
+    {
+        if (node == NoNode)
+            return false;
+
+        Piece& piece = m_pieces[node];
+        const std::size_t leftLength = (piece.left != NoNode) ? m_pieces[piece.left].subtreeLength : 0;
+
+        bool extended;
+        if (pos <= leftLength)
+            extended = extendPieceEndingAt(piece.left, pos, length, lineBreaks, addedStart);
+        else if (pos < leftLength + piece.length)
+            extended = false;
+        else if (pos == leftLength + piece.length)
+        {
+            extended = piece.added && (piece.start + piece.length == addedStart);
+            if (extended)
+            {
+                piece.length += length;
+                piece.lineBreaks += lineBreaks;
+            }
+        }
+        else
+            extended = extendPieceEndingAt(piece.right, pos - leftLength - piece.length, length, lineBreaks, addedStart);
+
+        if (extended)
+        {
+            piece.subtreeLength += length;
+            piece.subtreeLineBreaks += lineBreaks;
+        }
+
+        return extended;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBuffer::appendCharacters(std::size_t node, std::size_t pos, std::size_t count, std::basic_string<std::uint32_t>& str) const
+    {
+        if ((node == NoNode) || (count == 0))
+            return;
+
+        const Piece& piece = m_pieces[node];
+        const std::size_t leftLength = (piece.left != NoNode) ? m_pieces[piece.left].subtreeLength : 0;
+
+        if (pos < leftLength)
+        {
+            const std::size_t countInLeft = std::min(count, leftLength - pos);
+            appendCharacters(piece.left, pos, countInLeft, str);
+            pos += countInLeft;
+            count -= countInLeft;
+        }
+
+        if ((count > 0) && (pos < leftLength + piece.length))
+        {
+            const std::size_t offset = pos - leftLength;
+            const std::size_t countInPiece = std::min(count, piece.length - offset);
+            str.append((piece.added ? m_addedBuffer : m_originalBuffer), piece.start + offset, countInPiece);
+            pos += countInPiece;
+            count -= countInPiece;
+        }
+
+        if (count > 0)
+            appendCharacters(piece.right, pos - leftLength - piece.length, count, str);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextBuffer::countLineBreaks(bool added, std::size_t start, std::size_t length) const
+    {
+        const std::vector<std::size_t>& lineBreaks = added ? m_addedLineBreaks : m_originalLineBreaks;
+        const auto firstIt = std::lower_bound(lineBreaks.begin(), lineBreaks.end(), start);
+        const auto lastIt = std::lower_bound(firstIt, lineBreaks.end(), start + length);
+        return static_cast<std::size_t>(lastIt - firstIt);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint32_t TextBuffer::generatePriority()
+    {
+        // Xorshift generator, the priorities only have to be spread evenly to keep the tree balanced
+        m_randomState ^= m_randomState << 13;
+        m_randomState ^= m_randomState >> 17;
+        m_randomState ^= m_randomState << 5;
+        return m_randomState;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,410 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/TextLineList.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    constexpr std::size_t TextLineList::NoNode;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLineList::assign(const std::vector<Line>& lines)
+    {
+        clear();
+        m_nodes.reserve(lines.size());
+        m_root = buildTree(lines, true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLineList::clear()
+    {
+        m_nodes.clear();
+        m_unusedNodes.clear();
+        m_root = NoNode;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextLineList::size() const
+    {
+        return (m_root != NoNode) ? m_nodes[m_root].subtreeSize : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextLineList::empty() const
+    {
+        return m_root == NoNode;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextLineList::Line TextLineList::operator[](std::size_t index) const
+    {
+        assert(index < size());
+
+        // The index of the line in the text is the amount of lines in front of it that start a line in the text, minus one
+        std::size_t textLines = 0;
+        std::size_t node = m_root;
+        while (true)
+        {
+            const Node& current = m_nodes[node];
+            const std::size_t leftSize = (current.left != NoNode) ? m_nodes[current.left].subtreeSize : 0;
+            if (index < leftSize)
+            {
+                node = current.left;
+                continue;
+            }
+
+            textLines += (current.left != NoNode) ? m_nodes[current.left].subtreeTextLines : 0;
+            if (current.startsTextLine)
+                ++textLines;
+
+            if (index == leftSize)
+                return {textLines - 1, current.offset, current.length, current.width};
+
+            index -= leftSize + 1;
+            node = current.right;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextLineList::findFirstLine(std::size_t textLine) const
+    {
+        if ((m_root == NoNode) || (textLine >= m_nodes[m_root].subtreeTextLines))
+            return size();
+
+        // Search for the line that starts the (textLine + 1)th line in the text
+        std::size_t remaining = textLine + 1;
+        std::size_t index = 0;
+        std::size_t node = m_root;
+        while (true)
+        {
+            const Node& current = m_nodes[node];
+            const std::size_t leftTextLines = (current.left != NoNode) ? m_nodes[current.left].subtreeTextLines : 0;
+            if (remaining <= leftTextLines)
+            {
+                node = current.left;
+                continue;
+            }
+
+            remaining -= leftTextLines;
+            index += (current.left != NoNode) ? m_nodes[current.left].subtreeSize : 0;
+            if (current.startsTextLine)
+            {
+                if (remaining == 1)
+                    return index;
+
+                --remaining;
+            }
+
+            ++index;
+            node = current.right;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextLineList::findLine(std::size_t textLine, std::size_t offset) const
+    {
+        // The lines are ordered by their line in the text and by their end within that line, so the first line that belongs
+        // to a later line in the text or that doesn't end before the offset can be found while descending the tree
+        std::size_t result = size();
+        std::size_t index = 0;
+        std::size_t textLinesInFront = 0;
+        std::size_t node = m_root;
+        while (node != NoNode)
+        {
+            const Node& current = m_nodes[node];
+            const std::size_t leftSize = (current.left != NoNode) ? m_nodes[current.left].subtreeSize : 0;
+            const std::size_t leftTextLines = (current.left != NoNode) ? m_nodes[current.left].subtreeTextLines : 0;
+            const std::size_t currentTextLines = textLinesInFront + leftTextLines + (current.startsTextLine ? 1 : 0);
+            const std::size_t currentTextLine = currentTextLines - 1;
+            if ((currentTextLine > textLine) || ((currentTextLine == textLine) && (current.offset + current.length >= offset)))
+            {
+                result = index + leftSize;
+                node = current.left;
+            }
+            else
+            {
+                index += leftSize + 1;
+                textLinesInFront = currentTextLines;
+                node = current.right;
+            }
+        }
+
+        return result;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLineList::replace(std::size_t first, std::size_t last, const std::vector<Line>& lines)
+    {
+        assert(first <= last);
+        assert(last <= size());
+
+        // Whether the first new line starts a line in the text depends on the line in front of it
+        const bool firstStartsTextLine = (first == 0) || lines.empty() || ((*this)[first - 1].textLine != lines.front().textLine);
+
+        std::size_t left;
+        std::size_t middle;
+        std::size_t removed;
+        std::size_t right;
+        split(m_root, first, left, middle);
+        split(middle, last - first, removed, right);
+        releaseNodes(removed);
+
+        const std::size_t inserted = buildTree(lines, firstStartsTextLine);
+        m_root = merge(merge(left, inserted), right);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float TextLineList::getMaxWidth() const
+    {
+        return (m_root != NoNode) ? m_nodes[m_root].subtreeMaxWidth : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextLineList::getMaxLength() const
+    {
+        return (m_root != NoNode) ? m_nodes[m_root].subtreeMaxLength : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextLineList::findLongestLine() const
+    {
+        if (m_root == NoNode)
+            return 0;
+
+        const std::size_t maxLength = m_nodes[m_root].subtreeMaxLength;
+        std::size_t index = 0;
+        std::size_t node = m_root;
+        while (true)
+        {
+            const Node& current = m_nodes[node];
+            if ((current.left != NoNode) && (m_nodes[current.left].subtreeMaxLength == maxLength))
+            {
+                node = current.left;
+                continue;
+            }
+
+            index += (current.left != NoNode) ? m_nodes[current.left].subtreeSize : 0;
+            if (current.length == maxLength)
+                return index;
+
+            ++index;
+            node = current.right;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextLineList::createNode(const Line& line, bool startsTextLine)
+    {
+        std::size_t node;
+        if (!m_unusedNodes.empty())
+        {
+            node = m_unusedNodes.back();
+            m_unusedNodes.pop_back();
+        }
+        else
+        {
+            node = m_nodes.size();
+            m_nodes.emplace_back();
+        }
+
+        Node& newNode = m_nodes[node];
+        newNode.offset = line.offset;
+        newNode.length = line.length;
+        newNode.width = line.width;
+        newNode.startsTextLine = startsTextLine;
+        newNode.left = NoNode;
+        newNode.right = NoNode;
+        newNode.priority = generatePriority();
+        updateNode(node);
+        return node;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLineList::releaseNodes(std::size_t node)
+    {
+        if (node == NoNode)
+            return;
+
+        releaseNodes(m_nodes[node].left);
+        releaseNodes(m_nodes[node].right);
+        m_unusedNodes.push_back(node);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLineList::updateNode(std::size_t node)
+    {
+        Node& current = m_nodes[node];
+        current.subtreeSize = 1;
+        current.subtreeTextLines = current.startsTextLine ? 1 : 0;
+        current.subtreeMaxLength = current.length;
+        current.subtreeMaxWidth = current.width;
+
+        for (const std::size_t child : {current.left, current.right})
+        {
+            if (child == NoNode)
+                continue;
+
+            current.subtreeSize += m_nodes[child].subtreeSize;
+            current.subtreeTextLines += m_nodes[child].subtreeTextLines;
+            current.subtreeMaxLength = std::max(current.subtreeMaxLength, m_nodes[child].subtreeMaxLength);
+            current.subtreeMaxWidth = std::max(current.subtreeMaxWidth, m_nodes[child].subtreeMaxWidth);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLineList::updateSubtree(std::size_t node)
+    {
+        if (node == NoNode)
+            return;
+
+        updateSubtree(m_nodes[node].left);
+        updateSubtree(m_nodes[node].right);
+        updateNode(node);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLineList::split(std::size_t node, std::size_t count, std::size_t& left, std::size_t& right)
+    {
+        if (node == NoNode)
+        {
+            left = NoNode;
+            right = NoNode;
+            return;
+        }
+
+        const std::size_t leftSize = (m_nodes[node].left != NoNode) ? m_nodes[m_nodes[node].left].subtreeSize : 0;
+        if (count <= leftSize)
+        {
+            std::size_t newLeftChild;
+            split(m_nodes[node].left, count, left, newLeftChild);
+            m_nodes[node].left = newLeftChild;
+            updateNode(node);
+            right = node;
+        }
+        else
+        {
+            std::size_t newRightChild;
+            split(m_nodes[node].right, count - leftSize - 1, newRightChild, right);
+            m_nodes[node].right = newRightChild;
+            updateNode(node);
+            left = node;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextLineList::merge(std::size_t left, std::size_t right)
+    {
+        if (left == NoNode)
+            return right;
+        if (right == NoNode)
+            return left;
+
+        if (m_nodes[left].priority > m_nodes[right].priority)
+        {
+            const std::size_t newRightChild = merge(m_nodes[left].right, right);
+            m_nodes[left].right = newRightChild;
+            updateNode(left);
+            return left;
+        }
+        else
+        {
+            const std::size_t newLeftChild = merge(left, m_nodes[right].left);
+            m_nodes[right].left = newLeftChild;
+            updateNode(right);
+            return right;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextLineList::buildTree(const std::vector<Line>& lines, bool firstStartsTextLine)
+    {
+        // The nodes on the right edge of the tree are kept on a stack. A new node is placed at the bottom of the right edge,
+        // below the last node with a higher priority, and the nodes that it passes become its left subtree.
+        m_buildStack.clear();
+        for (std::size_t i = 0; i < lines.size(); ++i)
+        {
+            const bool startsTextLine = (i == 0) ? firstStartsTextLine : (lines[i].textLine != lines[i-1].textLine);
+            const std::size_t node = createNode(lines[i], startsTextLine);
+
+            std::size_t leftChild = NoNode;
+            while (!m_buildStack.empty() && (m_nodes[m_buildStack.back()].priority < m_nodes[node].priority))
+            {
+                leftChild = m_buildStack.back();
+                m_buildStack.pop_back();
+            }
+
+            m_nodes[node].left = leftChild;
+            if (!m_buildStack.empty())
+                m_nodes[m_buildStack.back()].right = node;
+
+            m_buildStack.push_back(node);
+        }
+
+        if (m_buildStack.empty())
+            return NoNode;
+
+        const std::size_t root = m_buildStack.front();
+        updateSubtree(root);
+        return root;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint32_t TextLineList::generatePriority()
+    {
+        // Xorshift generator, the priorities only have to be spread evenly to keep the tree balanced
+        m_randomState ^= m_randomState << 13;
+        m_randomState ^= m_randomState >> 17;
+        m_randomState ^= m_randomState << 5;
+        return m_randomState;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -30,7 +30,8 @@
 #include <TGUI/Loading/WidgetFactory.hpp>
 #include <TGUI/SignalManager.hpp>
 #include <SFML/System/Err.hpp>
-#include <SFML/Graphics/RectangleShape.hpp>
+
+#include <mutex>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -114,9 +115,43 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    namespace priv
+    {
+        WidgetTypeName::WidgetTypeName(const char* type) :
+            WidgetTypeName{std::string{type}}
+        {
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        WidgetTypeName::WidgetTypeName(const std::string& type)
+        {
+            // Elements of an unordered_set never move in memory, so the pointer remains valid when more types are added
+            static std::unordered_set<std::string> internedTypes;
+            static std::mutex mutex;
+
+            std::lock_guard<std::mutex> lock(mutex);
+            m_type = &*internedTypes.insert(type).first;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const std::string& WidgetTypeName::get() const
+        {
+            static const std::string emptyType;
+            return m_type ? *m_type : emptyType;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::atomic<unsigned int> Widget::m_queuedLayoutUpdateCount{0};
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget::Widget()
     {
-        m_renderer->subscribe(this, m_rendererChangedCallback);
+        subscribeToRenderer();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -127,11 +162,7 @@ namespace tgui
         if (m_renderer)
             m_renderer->unsubscribe(this);
 
-        for (auto& layout : m_boundPositionLayouts)
-            layout->unbindWidget();
-
-        for (auto& layout : m_boundSizeLayouts)
-            layout->unbindWidget();
+        unbindLayouts();
 
         SignalManager::getSignalManager()->remove(this);
     }
@@ -146,25 +177,29 @@ namespace tgui
         m_position                     {other.m_position},
         m_size                         {other.m_size},
         m_textSize                     {other.m_textSize},
-        m_boundPositionLayouts         {},
-        m_boundSizeLayouts             {},
         m_enabled                      {other.m_enabled},
         m_visible                      {other.m_visible},
         m_parent                       {nullptr},
         m_draggableWidget              {other.m_draggableWidget},
         m_containerWidget              {other.m_containerWidget},
-        m_toolTip                      {other.m_toolTip ? other.m_toolTip->clone() : nullptr},
         m_renderer                     {other.m_renderer},
-        m_showAnimations               {other.m_showAnimations},
         m_fontCached                   {other.m_fontCached},
         m_opacityCached                {other.m_opacityCached}
     {
+        if (other.m_rareData)
+        {
+            if (other.m_rareData->toolTip)
+                getRareData().toolTip = other.m_rareData->toolTip->clone();
+            if (!other.m_rareData->showAnimations.empty())
+                getRareData().showAnimations = other.m_rareData->showAnimations;
+        }
+
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
         m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
         m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
         m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
-        m_renderer->subscribe(this, m_rendererChangedCallback);
+        subscribeToRenderer();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -183,8 +218,6 @@ namespace tgui
         m_position                     {std::move(other.m_position)},
         m_size                         {std::move(other.m_size)},
         m_textSize                     {std::move(other.m_textSize)},
-        m_boundPositionLayouts         {std::move(other.m_boundPositionLayouts)},
-        m_boundSizeLayouts             {std::move(other.m_boundSizeLayouts)},
         m_enabled                      {std::move(other.m_enabled)},
         m_visible                      {std::move(other.m_visible)},
         m_parent                       {nullptr},
@@ -194,11 +227,10 @@ namespace tgui
         m_animationTimeElapsed         {std::move(other.m_animationTimeElapsed)},
         m_draggableWidget              {std::move(other.m_draggableWidget)},
         m_containerWidget              {std::move(other.m_containerWidget)},
-        m_toolTip                      {std::move(other.m_toolTip)},
         m_renderer                     {other.m_renderer},
-        m_showAnimations               {std::move(other.m_showAnimations)},
         m_fontCached                   {std::move(other.m_fontCached)},
-        m_opacityCached                {std::move(other.m_opacityCached)}
+        m_opacityCached                {std::move(other.m_opacityCached)},
+        m_rareData                     {std::move(other.m_rareData)}
     {
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
         m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
@@ -206,7 +238,7 @@ namespace tgui
         m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
         other.m_renderer->unsubscribe(&other);
-        m_renderer->subscribe(this, m_rendererChangedCallback);
+        subscribeToRenderer();
 
         other.m_renderer = nullptr;
 
@@ -237,8 +269,6 @@ namespace tgui
             m_position             = other.m_position;
             m_size                 = other.m_size;
             m_textSize             = other.m_textSize;
-            m_boundPositionLayouts = {};
-            m_boundSizeLayouts     = {};
             m_enabled              = other.m_enabled;
             m_visible              = other.m_visible;
             m_mouseHover           = false;
@@ -247,18 +277,27 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_draggableWidget      = other.m_draggableWidget;
             m_containerWidget      = other.m_containerWidget;
-            m_toolTip              = other.m_toolTip ? other.m_toolTip->clone() : nullptr;
             m_renderer             = other.m_renderer;
-            m_showAnimations       = {};
             m_fontCached           = other.m_fontCached;
             m_opacityCached        = other.m_opacityCached;
 
+            // The user data is kept, the other rarely used members are reset. The layouts of other widgets that were bound
+            // to this widget no longer refer to it, as they were bound to what the widget was before the assignment.
+            unbindLayouts();
+            if (m_rareData)
+            {
+                m_rareData->showAnimations = {};
+                m_rareData->toolTip = nullptr;
+            }
+            if (other.m_rareData && other.m_rareData->toolTip)
+                getRareData().toolTip = other.m_rareData->toolTip->clone();
+
             m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
             m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
             m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
             m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
-            m_renderer->subscribe(this, m_rendererChangedCallback);
+            subscribeToRenderer();
 
             if (m_parent)
             {
@@ -279,6 +318,10 @@ namespace tgui
             m_renderer->unsubscribe(this);
             other.m_renderer->unsubscribe(&other);
 
+            // Layouts that are bound to either widget keep pointing to the widget they were bound to, so they can't move along
+            unbindLayouts();
+            other.unbindLayouts();
+
             SignalWidgetBase::operator=(std::move(other));
             enable_shared_from_this::operator=(std::move(other));
 
@@ -293,8 +336,6 @@ namespace tgui
             m_position             = std::move(other.m_position);
             m_size                 = std::move(other.m_size);
             m_textSize             = std::move(other.m_textSize);
-            m_boundPositionLayouts = std::move(other.m_boundPositionLayouts);
-            m_boundSizeLayouts     = std::move(other.m_boundSizeLayouts);
             m_enabled              = std::move(other.m_enabled);
             m_visible              = std::move(other.m_visible);
             m_mouseHover           = std::move(other.m_mouseHover);
@@ -303,18 +344,17 @@ namespace tgui
             m_animationTimeElapsed = std::move(other.m_animationTimeElapsed);
             m_draggableWidget      = std::move(other.m_draggableWidget);
             m_containerWidget      = std::move(other.m_containerWidget);
-            m_toolTip              = std::move(other.m_toolTip);
             m_renderer             = std::move(other.m_renderer);
-            m_showAnimations       = std::move(other.m_showAnimations);
             m_fontCached           = std::move(other.m_fontCached);
             m_opacityCached        = std::move(other.m_opacityCached);
+            m_rareData             = std::move(other.m_rareData);
 
             m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
             m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
             m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
             m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
-            m_renderer->subscribe(this, m_rendererChangedCallback);
+            subscribeToRenderer();
 
             other.m_renderer = nullptr;
 
@@ -335,12 +375,12 @@ namespace tgui
         if (rendererData == nullptr)
             rendererData = RendererData::create();
 
-        std::shared_ptr<RendererData> oldData = m_renderer->getData();
+        std::shared_ptr<RendererData> oldData = m_renderer->getSharedData();
 
         // Update the data
         m_renderer->unsubscribe(this);
         m_renderer->setData(rendererData);
-        m_renderer->subscribe(this, m_rendererChangedCallback);
+        subscribeToRenderer();
         rendererData->shared = true;
 
         // Tell the widget about all the updated properties, both new ones and old ones that were now reset to their default value
@@ -399,13 +439,9 @@ namespace tgui
 
     const WidgetRenderer* Widget::getRenderer() const
     {
-        if (m_renderer->getData()->shared)
-        {
-            m_renderer->unsubscribe(this);
-            m_renderer->setData(m_renderer->clone());
-            m_renderer->subscribe(this, m_rendererChangedCallback);
-            m_renderer->getData()->shared = false;
-        }
+        // The shared data is only copied once a property is changed through the returned renderer
+        if (m_renderer->getSharedData()->shared)
+            m_renderer->copyOnWrite(this);
 
         // You should not be allowed to call setters on the renderer when the widget is const
         return m_renderer.get();
@@ -415,13 +451,9 @@ namespace tgui
 
     WidgetRenderer* Widget::getRenderer()
     {
-        if (m_renderer->getData()->shared)
-        {
-            m_renderer->unsubscribe(this);
-            m_renderer->setData(m_renderer->clone());
-            m_renderer->subscribe(this, m_rendererChangedCallback);
-            m_renderer->getData()->shared = false;
-        }
+        // The shared data is only copied once a property is changed through the returned renderer
+        if (m_renderer->getSharedData()->shared)
+            m_renderer->copyOnWrite(this);
 
         return m_renderer.get();
     }
@@ -438,9 +470,8 @@ namespace tgui
         {
             m_prevPosition = getPosition();
             onPositionChange.emit(this, getPosition());
-
-            for (auto& layout : m_boundPositionLayouts)
-                layout->recalculateValue();
+            invalidate();
+            recalculateBoundPositionLayouts();
         }
     }
 
@@ -456,9 +487,8 @@ namespace tgui
         {
             m_prevSize = getSize();
             onSizeChange.emit(this, getSize());
-
-            for (auto& layout : m_boundSizeLayouts)
-                layout->recalculateValue();
+            invalidate();
+            recalculateBoundSizeLayouts();
         }
     }
 
@@ -499,7 +529,7 @@ namespace tgui
         //const Vector2f startPosition = getPosition();
         //const Vector2f startSize = getSize();
 
-        finishExistingConflictingAnimations(m_showAnimations, type);
+        finishExistingConflictingAnimations(getRareData().showAnimations, type);
 
         switch (type)
         {
@@ -516,14 +546,14 @@ namespace tgui
                 else // If fading was already in progress then adapt the duration to finish the animation sooner
                     duration *= (startOpacity / endOpacity);
 
-                m_showAnimations.push_back(std::make_shared<priv::FadeAnimation>(shared_from_this(), animStartOpacity, endOpacity, duration,
+                m_rareData->showAnimations.push_back(std::make_shared<priv::FadeAnimation>(shared_from_this(), animStartOpacity, endOpacity, duration,
                                                                                  TGUI_LAMBDA_CAPTURE_EQ_THIS{onAnimationFinished.emit(this, type, true); }));
                 break;
             }
             case ShowAnimationType::Scale:
             {
-                m_showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), getPosition() + (getSize() / 2.f), getPosition(), duration));
-                m_showAnimations.push_back(std::make_shared<priv::ResizeAnimation>(shared_from_this(), Vector2f{0, 0}, getSize(), duration,
+                m_rareData->showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), getPosition() + (getSize() / 2.f), getPosition(), duration));
+                m_rareData->showAnimations.push_back(std::make_shared<priv::ResizeAnimation>(shared_from_this(), Vector2f{0, 0}, getSize(), duration,
                                                                                    TGUI_LAMBDA_CAPTURE_EQ_THIS{onAnimationFinished.emit(this, type, true); }));
                 setPosition(getPosition() + (getSize() / 2.f));
                 setSize(0, 0);
@@ -531,7 +561,7 @@ namespace tgui
             }
             case ShowAnimationType::SlideFromLeft:
             {
-                m_showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{-getFullSize().x, getPosition().y}, getPosition(), duration,
+                m_rareData->showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{-getFullSize().x, getPosition().y}, getPosition(), duration,
                                                                                  TGUI_LAMBDA_CAPTURE_EQ_THIS{onAnimationFinished.emit(this, type, true); }));
                 setPosition({-getFullSize().x, getPosition().y});
                 break;
@@ -540,7 +570,7 @@ namespace tgui
             {
                 if (getParent())
                 {
-                    m_showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getParent()->getSize().x + getWidgetOffset().x, getPosition().y}, getPosition(), duration,
+                    m_rareData->showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getParent()->getSize().x + getWidgetOffset().x, getPosition().y}, getPosition(), duration,
                                                                                      TGUI_LAMBDA_CAPTURE_EQ_THIS{onAnimationFinished.emit(this, type, true); }));
                     setPosition({getParent()->getSize().x + getWidgetOffset().x, getPosition().y});
                 }
@@ -553,7 +583,7 @@ namespace tgui
             }
             case ShowAnimationType::SlideFromTop:
             {
-                m_showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, -getFullSize().y}, getPosition(), duration,
+                m_rareData->showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, -getFullSize().y}, getPosition(), duration,
                                                                                  TGUI_LAMBDA_CAPTURE_EQ_THIS{onAnimationFinished.emit(this, type, true); }));
                 setPosition({getPosition().x, -getFullSize().y});
                 break;
@@ -562,7 +592,7 @@ namespace tgui
             {
                 if (getParent())
                 {
-                    m_showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, getParent()->getSize().y + getWidgetOffset().y}, getPosition(), duration,
+                    m_rareData->showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, getParent()->getSize().y + getWidgetOffset().y}, getPosition(), duration,
                                                                                      TGUI_LAMBDA_CAPTURE_EQ_THIS{onAnimationFinished.emit(this, type, true); }));
                     setPosition({getPosition().x, getParent()->getSize().y + getWidgetOffset().y});
                 }
@@ -587,7 +617,7 @@ namespace tgui
         //const Vector2f startPosition = getPosition();
         //const Vector2f startSize = getSize();
 
-        finishExistingConflictingAnimations(m_showAnimations, type);
+        finishExistingConflictingAnimations(getRareData().showAnimations, type);
 
         const auto position = getPosition();
 
@@ -601,15 +631,15 @@ namespace tgui
                 if (startOpacity != endOpacity)
                     duration *= (startOpacity / endOpacity);
 
-                m_showAnimations.push_back(std::make_shared<priv::FadeAnimation>(shared_from_this(), startOpacity, 0.f, duration,
+                m_rareData->showAnimations.push_back(std::make_shared<priv::FadeAnimation>(shared_from_this(), startOpacity, 0.f, duration,
                     TGUI_LAMBDA_CAPTURE_EQ_THIS{ setVisible(false); setInheritedOpacity(endOpacity); onAnimationFinished.emit(this, type, false); }));
                 break;
             }
             case ShowAnimationType::Scale:
             {
                 const auto size = getSize();
-                m_showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), position, position + (size / 2.f), duration));
-                m_showAnimations.push_back(std::make_shared<priv::ResizeAnimation>(shared_from_this(), size, Vector2f{0, 0}, duration,
+                m_rareData->showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), position, position + (size / 2.f), duration));
+                m_rareData->showAnimations.push_back(std::make_shared<priv::ResizeAnimation>(shared_from_this(), size, Vector2f{0, 0}, duration,
                     TGUI_LAMBDA_CAPTURE_EQ_THIS{ setVisible(false); setPosition(position); setSize(size); onAnimationFinished.emit(this, type, false); }));
                 break;
             }
@@ -617,7 +647,7 @@ namespace tgui
             {
                 if (getParent())
                 {
-                    m_showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{getParent()->getSize().x + getWidgetOffset().x, position.y}, duration,
+                    m_rareData->showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{getParent()->getSize().x + getWidgetOffset().x, position.y}, duration,
                         TGUI_LAMBDA_CAPTURE_EQ_THIS{ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
                 }
                 else
@@ -629,7 +659,7 @@ namespace tgui
             }
             case ShowAnimationType::SlideToLeft:
             {
-                m_showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{-getFullSize().x, position.y}, duration,
+                m_rareData->showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{-getFullSize().x, position.y}, duration,
                     TGUI_LAMBDA_CAPTURE_EQ_THIS{ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
                 break;
             }
@@ -637,7 +667,7 @@ namespace tgui
             {
                 if (getParent())
                 {
-                    m_showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, getParent()->getSize().y + getWidgetOffset().y}, duration,
+                    m_rareData->showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, getParent()->getSize().y + getWidgetOffset().y}, duration,
                         TGUI_LAMBDA_CAPTURE_EQ_THIS{ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
                 }
                 else
@@ -649,7 +679,7 @@ namespace tgui
             }
             case ShowAnimationType::SlideToTop:
             {
-                m_showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, -getFullSize().y}, duration,
+                m_rareData->showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, -getFullSize().y}, duration,
                     TGUI_LAMBDA_CAPTURE_EQ_THIS{ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
                 break;
             }
@@ -660,7 +690,11 @@ namespace tgui
 
     void Widget::setVisible(bool visible)
     {
-        m_visible = visible;
+        if (m_visible != visible)
+        {
+            m_visible = visible;
+            invalidate();
+        }
 
         // If the widget is hiden while still focused then it must be unfocused
         if (!visible)
@@ -671,7 +705,11 @@ namespace tgui
 
     void Widget::setEnabled(bool enabled)
     {
-        m_enabled = enabled;
+        if (m_enabled != enabled)
+        {
+            m_enabled = enabled;
+            invalidate();
+        }
 
         if (!enabled)
         {
@@ -697,6 +735,7 @@ namespace tgui
             if (canGainFocus())
             {
                 m_focused = true;
+                invalidate();
 
                 if (m_parent)
                     m_parent->childWidgetFocused(shared_from_this());
@@ -707,6 +746,7 @@ namespace tgui
         else // Unfocusing widget
         {
             m_focused = false;
+            invalidate();
             onUnfocus.emit(this);
         }
     }
@@ -722,7 +762,7 @@ namespace tgui
 
     bool Widget::isAnimationPlaying() const
     {
-        return !m_showAnimations.empty();
+        return m_rareData && !m_rareData->showAnimations.empty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -747,6 +787,7 @@ namespace tgui
     {
         m_inheritedFont = font;
         rendererChanged("font");
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -762,6 +803,7 @@ namespace tgui
     {
         m_inheritedOpacity = opacity;
         rendererChanged("opacity");
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -789,14 +831,18 @@ namespace tgui
 
     void Widget::setToolTip(Widget::Ptr toolTip)
     {
-        m_toolTip = toolTip;
+        if (toolTip || m_rareData)
+            getRareData().toolTip = toolTip;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Ptr Widget::getToolTip() const
     {
-        return m_toolTip;
+        if (m_rareData)
+            return m_rareData->toolTip;
+        else
+            return nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -862,7 +908,13 @@ namespace tgui
             SignalManager::getSignalManager()->add(shared_from_this());
         }
 
-        m_parent = parent;
+        // Both the gui that we are removed from and the one that we are added to have to be redrawn
+        if (m_parent != parent)
+        {
+            invalidate();
+            m_parent = parent;
+            invalidate();
+        }
 
         // Give the layouts another chance to find widgets to which it refers
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
@@ -877,13 +929,67 @@ namespace tgui
     {
         m_animationTimeElapsed += elapsedTime;
 
-        for (unsigned int i = 0; i < m_showAnimations.size();)
+        if (!m_rareData || m_rareData->showAnimations.empty())
+            return;
+
+        auto& animations = m_rareData->showAnimations;
+        for (unsigned int i = 0; i < animations.size();)
         {
-            if (m_showAnimations[i]->update(elapsedTime))
-                m_showAnimations.erase(m_showAnimations.begin() + i);
+            if (animations[i]->update(elapsedTime))
+                animations.erase(animations.begin() + i);
             else
                 i++;
         }
+
+        // The animation has to continue in the next frame
+        invalidate();
+        if (!animations.empty())
+            requestWakeup({});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::invalidate()
+    {
+        if (m_invalidationDeferred)
+            return;
+
+        if (m_parent)
+            m_parent->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::requestWakeup(sf::Time delay)
+    {
+        if (m_parent)
+            m_parent->requestWakeup(delay);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Widget::queueLayoutUpdate(const std::shared_ptr<Container>& container)
+    {
+        if (m_parent)
+            return m_parent->queueLayoutUpdate(container);
+        else
+            return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::updateQueuedLayouts()
+    {
+        if (m_parent)
+            m_parent->updateQueuedLayouts();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::updateQueuedLayoutsOfGui() const
+    {
+        if (m_parent)
+            m_parent->updateQueuedLayouts();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -991,7 +1097,7 @@ namespace tgui
 
     Widget::Ptr Widget::askToolTip(Vector2f mousePos)
     {
-        if (m_toolTip && mouseOnWidget(mousePos))
+        if (m_rareData && m_rareData->toolTip && mouseOnWidget(mousePos))
             return getToolTip();
         else
             return nullptr;
@@ -1001,28 +1107,30 @@ namespace tgui
 
     void Widget::bindPositionLayout(Layout* layout)
     {
-        m_boundPositionLayouts.insert(layout);
+        getRareData().boundPositionLayouts.insert(layout);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::unbindPositionLayout(Layout* layout)
     {
-        m_boundPositionLayouts.erase(layout);
+        if (m_rareData)
+            m_rareData->boundPositionLayouts.erase(layout);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::bindSizeLayout(Layout* layout)
     {
-        m_boundSizeLayouts.insert(layout);
+        getRareData().boundSizeLayouts.insert(layout);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::unbindSizeLayout(Layout* layout)
     {
-        m_boundSizeLayouts.erase(layout);
+        if (m_rareData)
+            m_rareData->boundSizeLayouts.erase(layout);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1097,25 +1205,25 @@ namespace tgui
         if (getSize() != Vector2f{})
             node->propertyValuePairs["Size"] = std::make_unique<DataIO::ValueNode>(m_size.toString());
 #if TGUI_COMPILED_WITH_CPP_VER >= 17
-        if (m_userData.has_value())
+        if (m_rareData && m_rareData->userData.has_value())
         {
             try
             {
-                const sf::String string = std::any_cast<sf::String>(m_userData);
+                const sf::String string = std::any_cast<sf::String>(m_rareData->userData);
                 node->propertyValuePairs["UserData"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(string.toAnsiString()));
             }
             catch (const std::bad_any_cast&)
             {
                 try
                 {
-                    const std::string string = std::any_cast<std::string>(m_userData);
+                    const std::string string = std::any_cast<std::string>(m_rareData->userData);
                     node->propertyValuePairs["UserData"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(string));
                 }
                 catch (const std::bad_any_cast&)
                 {
                     try
                     {
-                        const std::string string = std::any_cast<const char*>(m_userData);
+                        const std::string string = std::any_cast<const char*>(m_rareData->userData);
                         node->propertyValuePairs["UserData"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(string));
                     }
                     catch (const std::bad_any_cast&)
@@ -1125,19 +1233,19 @@ namespace tgui
             }
         }
 #else
-        if (m_userData.not_null())
+        if (m_rareData && m_rareData->userData.not_null())
         {
-            if (m_userData.is<sf::String>())
+            if (m_rareData->userData.is<sf::String>())
             {
-                node->propertyValuePairs["UserData"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(m_userData.as<sf::String>().toAnsiString()));
+                node->propertyValuePairs["UserData"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(m_rareData->userData.as<sf::String>().toAnsiString()));
             }
-            else if (m_userData.is<std::string>())
+            else if (m_rareData->userData.is<std::string>())
             {
-                node->propertyValuePairs["UserData"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(m_userData.as<std::string>()));
+                node->propertyValuePairs["UserData"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(m_rareData->userData.as<std::string>()));
             }
-            else if (m_userData.is<const char*>())
+            else if (m_rareData->userData.is<const char*>())
             {
-                node->propertyValuePairs["UserData"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(m_userData.as<const char*>()));
+                node->propertyValuePairs["UserData"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(m_rareData->userData.as<const char*>()));
             }
         }
 #endif
@@ -1179,9 +1287,9 @@ namespace tgui
         if (node->propertyValuePairs["userdata"])
         {
 #if TGUI_COMPILED_WITH_CPP_VER >= 17
-            m_userData = std::make_any<std::string>(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["userdata"]->value).getString().toAnsiString());
+            getRareData().userData = std::make_any<std::string>(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["userdata"]->value).getString().toAnsiString());
 #else
-            m_userData = tgui::Any(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["userdata"]->value).getString().toAnsiString());
+            getRareData().userData = tgui::Any(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["userdata"]->value).getString().toAnsiString());
 #endif
         }
 
@@ -1247,6 +1355,7 @@ namespace tgui
     void Widget::mouseEnteredWidget()
     {
         m_mouseHover = true;
+        invalidate();
         onMouseEnter.emit(this);
     }
 
@@ -1255,14 +1364,82 @@ namespace tgui
     void Widget::mouseLeftWidget()
     {
         m_mouseHover = false;
+        invalidate();
         onMouseLeave.emit(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Widget::isDrawnInsideBounds() const
+    {
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::recalculateBoundPositionLayouts()
+    {
+        if (!m_rareData)
+            return;
+
+        for (auto& layout : m_rareData->boundPositionLayouts)
+            layout->recalculateValue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::recalculateBoundSizeLayouts()
+    {
+        if (!m_rareData)
+            return;
+
+        for (auto& layout : m_rareData->boundSizeLayouts)
+            layout->recalculateValue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::unbindLayouts()
+    {
+        if (!m_rareData)
+            return;
+
+        // The sets are emptied first, unbinding a layout may cause its widget to bind a new layout to this widget
+        const auto positionLayouts = std::move(m_rareData->boundPositionLayouts);
+        const auto sizeLayouts = std::move(m_rareData->boundSizeLayouts);
+        m_rareData->boundPositionLayouts.clear();
+        m_rareData->boundSizeLayouts.clear();
+
+        for (auto& layout : positionLayouts)
+            layout->unbindWidget();
+
+        for (auto& layout : sizeLayouts)
+            layout->unbindWidget();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::RareData& Widget::getRareData()
+    {
+        if (!m_rareData)
+            m_rareData = std::make_unique<RareData>();
+
+        return *m_rareData;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::rendererChangedCallback(const std::string& property)
     {
         rendererChanged(property);
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::subscribeToRenderer()
+    {
+        m_renderer->subscribe(this, [this](const std::string& property){ rendererChangedCallback(property); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1272,14 +1449,17 @@ namespace tgui
                                     Vector2f size,
                                     Color color) const
     {
-        sf::RectangleShape shape{size};
+        const sf::Color vertexColor = Color::calcColorOpacity(color, m_opacityCached);
 
-        if (m_opacityCached < 1)
-            shape.setFillColor(Color::calcColorOpacity(color, m_opacityCached));
-        else
-            shape.setFillColor(color);
+        // The vertices are drawn directly instead of through sf::RectangleShape, which would allocate memory on every draw
+        const sf::Vertex vertices[] = {
+            {{0, 0}, vertexColor},
+            {{0, size.y}, vertexColor},
+            {{size.x, 0}, vertexColor},
+            {{size.x, size.y}, vertexColor}
+        };
 
-        target.draw(shape, states);
+        target.draw(vertices, 4, sf::PrimitiveType::TrianglesStrip, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1290,15 +1470,19 @@ namespace tgui
                              Vector2f size,
                              Color borderColor) const
     {
-        const Color color = Color::calcColorOpacity(borderColor, m_opacityCached);
+        const sf::Color color = Color::calcColorOpacity(borderColor, m_opacityCached);
 
         // If size is too small then draw entire size as border
         if ((size.x <= borders.getLeft() + borders.getRight()) || (size.y <= borders.getTop() + borders.getBottom()))
         {
-            sf::RectangleShape border;
-            border.setFillColor(color);
-            border.setSize({size.x, size.y});
-            target.draw(border, states);
+            const sf::Vertex vertices[] = {
+                {{0, 0}, color},
+                {{0, size.y}, color},
+                {{size.x, 0}, color},
+                {{size.x, size.y}, color}
+            };
+
+            target.draw(vertices, 4, sf::PrimitiveType::TrianglesStrip, states);
         }
         else // Draw borders in the normal way
         {
@@ -1312,7 +1496,7 @@ namespace tgui
             // |              | //
             // 2--------------4 //
             //////////////////////
-            const std::vector<sf::Vertex> vertices = {
+            const sf::Vertex vertices[] = {
                 {{0, 0}, color},
                 {{borders.getLeft(), 0}, color},
                 {{0, size.y}, color},
@@ -1325,7 +1509,7 @@ namespace tgui
                 {{borders.getLeft(), borders.getTop()}, color}
             };
 
-            target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+            target.draw(vertices, 10, sf::PrimitiveType::TrianglesStrip, states);
         }
     }
 
@@ -24,6 +24,9 @@
 
 
 #include <TGUI/Widgets/Canvas.hpp>
+#include <TGUI/Clipping.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <algorithm>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -31,10 +34,25 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    namespace
+    {
+        bool isCanvasVertexBufferAvailable()
+        {
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+            return sf::VertexBuffer::isAvailable();
+#else
+            return false;
+#endif
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Canvas::Canvas(const Layout2d& size)
     {
         m_type = "Canvas";
 
+        m_layers.push_back(std::make_unique<Layer>());
         setSize(size);
     }
 
@@ -43,6 +61,7 @@ namespace tgui
     Canvas::Canvas(const Canvas& other) :
         ClickableWidget{other}
     {
+        copyLayers(other);
         setSize(other.getSize());
     }
 
@@ -52,6 +71,7 @@ namespace tgui
         ClickableWidget{std::move(other)}
     {
         // sf::RenderTexture does not support move yet
+        copyLayers(other);
         setSize(other.getSize());
     }
 
@@ -62,6 +82,7 @@ namespace tgui
         if (this != &right)
         {
             ClickableWidget::operator=(right);
+            copyLayers(right);
             setSize(right.getSize());
         }
 
@@ -77,6 +98,7 @@ namespace tgui
             ClickableWidget::operator=(std::move(right));
 
             // sf::RenderTexture does not support move yet
+            copyLayers(right);
             setSize(right.getSize());
         }
 
@@ -116,6 +138,9 @@ namespace tgui
 
             m_renderTexture.clear();
             m_renderTexture.display();
+
+            for (std::size_t i = 1; i < m_layers.size(); ++i)
+                resizeLayer(*m_layers[i], newSize);
         }
 
         Widget::setSize(size);
@@ -125,6 +150,8 @@ namespace tgui
 
     void Canvas::setView(const sf::View& view)
     {
+        // A view set by the user replaces the one that limited drawing to part of the canvas
+        m_layers[0]->clipped = false;
         m_renderTexture.setView(view);
     }
 
@@ -181,7 +208,216 @@ namespace tgui
 
     void Canvas::display()
     {
-        m_renderTexture.display();
+        display(0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Canvas::addLayer()
+    {
+        auto layer = std::make_unique<Layer>();
+        layer->renderTexture = std::make_unique<sf::RenderTexture>();
+        layer->sprite.setColor(m_sprite.getColor());
+        resizeLayer(*layer, getSize());
+
+        m_layers.push_back(std::move(layer));
+        invalidate();
+        return m_layers.size() - 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Canvas::addGeometryLayer(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::Texture* texture)
+    {
+        auto layer = std::make_unique<Layer>();
+        layer->geometry = true;
+        layer->primitiveType = type;
+        layer->texture = texture;
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+        // The geometry is uploaded once and then drawn every frame
+        layer->vertexBuffer = sf::VertexBuffer{type, sf::VertexBuffer::Static};
+#endif
+
+        m_layers.push_back(std::move(layer));
+        updateGeometry(m_layers.size() - 1, vertices, vertexCount, 0);
+        invalidate();
+        return m_layers.size() - 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Canvas::updateGeometry(std::size_t layerIndex, const sf::Vertex* vertices, std::size_t vertexCount, std::size_t offset)
+    {
+        if ((layerIndex >= m_layers.size()) || !m_layers[layerIndex]->geometry)
+            return false;
+
+        // Only an update starting at the first vertex can change the amount of vertices in the layer
+        Layer& layer = *m_layers[layerIndex];
+        const bool resize = (offset == 0);
+        if (!resize && (offset + vertexCount > layer.vertexCount))
+            return false;
+
+        if (isCanvasVertexBufferAvailable())
+        {
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+            // Only the changed vertices are uploaded, unless the buffer has to grow. When the layer shrinks, the vertices
+            // at the end of the buffer are kept but no longer drawn.
+            if ((vertexCount > layer.vertexBuffer.getVertexCount()) && !layer.vertexBuffer.create(vertexCount))
+                return false;
+
+            if ((vertexCount > 0) && !layer.vertexBuffer.update(vertices, vertexCount, static_cast<unsigned int>(offset)))
+                return false;
+#endif
+        }
+        else
+        {
+            if (resize)
+                layer.vertices.resize(vertexCount);
+
+            std::copy(vertices, vertices + vertexCount, layer.vertices.begin() + static_cast<std::ptrdiff_t>(offset));
+        }
+
+        if (resize)
+            layer.vertexCount = vertexCount;
+
+        invalidate();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Canvas::removeLayer(std::size_t layer)
+    {
+        if ((layer == 0) || (layer >= m_layers.size()))
+            return false;
+
+        m_layers.erase(m_layers.begin() + static_cast<std::ptrdiff_t>(layer));
+        invalidate();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Canvas::getLayerCount() const
+    {
+        return m_layers.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Canvas::setLayerVisible(std::size_t layer, bool visible)
+    {
+        if ((layer >= m_layers.size()) || (m_layers[layer]->visible == visible))
+            return;
+
+        m_layers[layer]->visible = visible;
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Canvas::isLayerVisible(std::size_t layer) const
+    {
+        if (layer >= m_layers.size())
+            return false;
+
+        return m_layers[layer]->visible;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Canvas::clear(std::size_t layer, Color color)
+    {
+        sf::RenderTexture* renderTexture = getLayerRenderTexture(layer);
+        if (renderTexture)
+            renderTexture->clear(color);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Canvas::clear(std::size_t layerIndex, const sf::FloatRect& rect, Color color)
+    {
+        sf::RenderTexture* renderTexture = getLayerRenderTexture(layerIndex);
+        if (!renderTexture)
+            return;
+
+        Layer& layer = *m_layers[layerIndex];
+        if (layer.clipped)
+            renderTexture->setView(layer.unclippedView);
+
+        const sf::View view = renderTexture->getView();
+
+        // Overwrite the pixels (including their alpha) instead of blending the color with the existing contents
+        sf::RectangleShape shape{{rect.width, rect.height}};
+        shape.setPosition(rect.left, rect.top);
+        shape.setFillColor(color);
+        renderTexture->setView(renderTexture->getDefaultView());
+        renderTexture->draw(shape, sf::RenderStates{sf::BlendNone});
+
+        layer.unclippedView = view;
+        layer.clipped = true;
+        if (view.getRotation() != 0)
+        {
+            renderTexture->setView(view);
+            return;
+        }
+
+        // Limit drawing to the rectangle by shrinking the viewport, while keeping the same mapping from coordinates to pixels
+        const sf::IntRect viewport = renderTexture->getViewport(view);
+        sf::FloatRect clipRect;
+        if (!rect.intersects(sf::FloatRect{viewport}, clipRect))
+            clipRect = {};
+
+        const Vector2f scale{viewport.width / view.getSize().x, viewport.height / view.getSize().y};
+        const Vector2f viewTopLeft = view.getCenter() - (view.getSize() / 2.f);
+
+        sf::View clippedView;
+        clippedView.setSize(clipRect.width / scale.x, clipRect.height / scale.y);
+        clippedView.setCenter(viewTopLeft.x + ((clipRect.left - viewport.left) / scale.x) + (clippedView.getSize().x / 2.f),
+                              viewTopLeft.y + ((clipRect.top - viewport.top) / scale.y) + (clippedView.getSize().y / 2.f));
+
+        const sf::Vector2u textureSize = renderTexture->getSize();
+        clippedView.setViewport({clipRect.left / textureSize.x, clipRect.top / textureSize.y,
+                                 clipRect.width / textureSize.x, clipRect.height / textureSize.y});
+        renderTexture->setView(clippedView);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Canvas::draw(std::size_t layer, const sf::Drawable& drawable, const sf::RenderStates& states)
+    {
+        sf::RenderTexture* renderTexture = getLayerRenderTexture(layer);
+        if (renderTexture)
+            renderTexture->draw(drawable, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Canvas::draw(std::size_t layer, const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states)
+    {
+        sf::RenderTexture* renderTexture = getLayerRenderTexture(layer);
+        if (renderTexture)
+            renderTexture->draw(vertices, vertexCount, type, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Canvas::display(std::size_t layerIndex)
+    {
+        sf::RenderTexture* renderTexture = getLayerRenderTexture(layerIndex);
+        if (!renderTexture)
+            return;
+
+        renderTexture->display();
+
+        Layer& layer = *m_layers[layerIndex];
+        if (layer.clipped)
+        {
+            renderTexture->setView(layer.unclippedView);
+            layer.clipped = false;
+        }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -191,7 +427,11 @@ namespace tgui
         Widget::rendererChanged(property);
 
         if ((property == "opacity") || (property == "opacitydisabled"))
+        {
             m_sprite.setColor(Color::calcColorOpacity(Color::White, m_opacityCached));
+            for (auto& layer : m_layers)
+                layer->sprite.setColor(m_sprite.getColor());
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -203,6 +443,37 @@ namespace tgui
 
         states.transform.translate(getPosition());
         target.draw(m_sprite, states);
+
+        // Unchanged layers are just drawn again, only their contents had to be updated when they changed
+        for (std::size_t i = 1; i < m_layers.size(); ++i)
+        {
+            const Layer& layer = *m_layers[i];
+            if (!layer.visible)
+                continue;
+
+            if (!layer.geometry)
+            {
+                target.draw(layer.sprite, states);
+                continue;
+            }
+
+            if (layer.vertexCount == 0)
+                continue;
+
+            const Clipping clipping{target, states, {}, getSize()};
+
+            sf::RenderStates geometryStates = states;
+            geometryStates.texture = layer.texture;
+
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+            if (isCanvasVertexBufferAvailable())
+            {
+                target.draw(layer.vertexBuffer, 0, layer.vertexCount, geometryStates);
+                continue;
+            }
+#endif
+            target.draw(layer.vertices.data(), layer.vertices.size(), layer.primitiveType, geometryStates);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -213,6 +484,67 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::RenderTexture* Canvas::getLayerRenderTexture(std::size_t layer)
+    {
+        if (layer == 0)
+            return &m_renderTexture;
+        else if ((layer < m_layers.size()) && !m_layers[layer]->geometry)
+            return m_layers[layer]->renderTexture.get();
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Canvas::resizeLayer(Layer& layer, Vector2f size)
+    {
+        if (layer.geometry || !layer.renderTexture || (size.x <= 0) || (size.y <= 0))
+            return;
+
+        sf::RenderTexture& renderTexture = *layer.renderTexture;
+        if ((renderTexture.getSize().x < static_cast<unsigned int>(size.x)) || (renderTexture.getSize().y < static_cast<unsigned int>(size.y)))
+            renderTexture.create(static_cast<unsigned int>(size.x), static_cast<unsigned int>(size.y));
+
+        layer.sprite.setTexture(renderTexture.getTexture());
+        layer.sprite.setTextureRect(sf::IntRect{0, 0, static_cast<int>(size.x), static_cast<int>(size.y)});
+        layer.clipped = false;
+
+        renderTexture.setView(renderTexture.getDefaultView());
+        renderTexture.clear(Color::Transparent);
+        renderTexture.display();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Canvas::copyLayers(const Canvas& other)
+    {
+        m_layers.clear();
+        for (const auto& otherLayer : other.m_layers)
+        {
+            auto layer = std::make_unique<Layer>();
+            layer->geometry = otherLayer->geometry;
+            layer->visible = otherLayer->visible;
+            layer->sprite.setColor(otherLayer->sprite.getColor());
+
+            if (otherLayer->geometry)
+            {
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+                layer->vertexBuffer = otherLayer->vertexBuffer;
+#endif
+                layer->vertices = otherLayer->vertices;
+                layer->vertexCount = otherLayer->vertexCount;
+                layer->primitiveType = otherLayer->primitiveType;
+                layer->texture = otherLayer->texture;
+            }
+            else if (!m_layers.empty())
+                layer->renderTexture = std::make_unique<sf::RenderTexture>();
+
+            m_layers.push_back(std::move(layer));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -155,6 +155,7 @@ namespace tgui
             m_lines.push_front(std::move(line));
 
         recalculateFullTextHeight();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -293,7 +294,10 @@ namespace tgui
     void ChatBox::setLinesStartFromTop(bool startFromTop)
     {
         if (m_linesStartFromTop != startFromTop)
+        {
             m_linesStartFromTop = startFromTop;
+            invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -308,6 +312,7 @@ namespace tgui
     void ChatBox::setNewLinesBelowOthers(bool newLinesBelowOthers)
     {
         m_newLinesBelowOthers = newLinesBelowOthers;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -322,6 +327,7 @@ namespace tgui
     void ChatBox::setScrollbarValue(unsigned int value)
     {
         m_scroll->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -452,6 +458,8 @@ namespace tgui
                 m_scroll->setValue(m_scroll->getMaximum() - m_scroll->getViewportSize());
             }
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
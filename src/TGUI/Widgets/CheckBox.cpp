@@ -121,6 +121,8 @@ namespace tgui
             else
                 m_text.setStyle(m_textStyleCached);
 
+            invalidate();
+
             onCheck.emit(this, true);
             onChange.emit(this, true);
         }
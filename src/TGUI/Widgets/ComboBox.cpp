@@ -29,6 +29,8 @@
 #include <SFML/Graphics/ConvexShape.hpp>
 #include <TGUI/SignalImpl.hpp>
 
+#include <cmath>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -270,6 +272,7 @@ namespace tgui
     {
         const bool ret = m_listBox->addItem(item, id);
         updateListBoxHeight();
+        invalidate();
         return ret;
     }
 
@@ -285,6 +288,7 @@ namespace tgui
         if (previousSelectedItemIndex != m_listBox->getSelectedItemIndex())
             onItemSelect.emit(this, m_listBox->getSelectedItem(), m_listBox->getSelectedItemId(), m_listBox->getSelectedItemIndex());
 
+        invalidate();
         return ret;
     }
 
@@ -300,6 +304,7 @@ namespace tgui
         if (previousSelectedItemIndex != m_listBox->getSelectedItemIndex())
             onItemSelect.emit(this, m_listBox->getSelectedItem(), m_listBox->getSelectedItemId(), m_listBox->getSelectedItemIndex());
 
+        invalidate();
         return ret;
     }
 
@@ -315,6 +320,7 @@ namespace tgui
         if (previousSelectedItemIndex != m_listBox->getSelectedItemIndex())
             onItemSelect.emit(this, m_listBox->getSelectedItem(), m_listBox->getSelectedItemId(), m_listBox->getSelectedItemIndex());
 
+        invalidate();
         return ret;
     }
 
@@ -324,6 +330,7 @@ namespace tgui
     {
         m_text.setString("");
         m_listBox->deselectItem();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -340,6 +347,7 @@ namespace tgui
         if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
             updateListBoxHeight();
 
+        invalidate();
         return ret;
     }
 
@@ -369,6 +377,7 @@ namespace tgui
         if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
             updateListBoxHeight();
 
+        invalidate();
         return ret;
     }
 
@@ -380,6 +389,7 @@ namespace tgui
         m_listBox->removeAllItems();
 
         updateListBoxHeight();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -416,6 +426,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItem(originalValue, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -425,6 +436,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemById(id, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -434,6 +446,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemByIndex(index, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -456,6 +469,7 @@ namespace tgui
     void ComboBox::setMaximumItems(std::size_t maximumItems)
     {
         m_listBox->setMaximumItems(maximumItems);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -472,6 +486,7 @@ namespace tgui
         m_listBox->setTextSize(textSize);
         m_text.setCharacterSize(m_listBox->getTextSize());
         m_defaultText.setCharacterSize(m_listBox->getTextSize());
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -486,6 +501,7 @@ namespace tgui
     void ComboBox::setDefaultText(const sf::String& defaultText)
     {
         m_defaultText.setString(defaultText);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -592,26 +608,30 @@ namespace tgui
         if (m_listBox->isVisible())
             return false;
 
-        // Check if you are scrolling down
-        if (delta < 0)
-        {
-            // Select the next item
-            if (static_cast<std::size_t>(m_listBox->getSelectedItemIndex() + 1) < m_listBox->getItemCount())
-            {
-                m_listBox->setSelectedItemByIndex(static_cast<std::size_t>(m_listBox->getSelectedItemIndex() + 1));
-                m_text.setString(m_listBox->getSelectedItem());
-                onItemSelect.emit(this, m_listBox->getSelectedItem(), m_listBox->getSelectedItemId(), m_listBox->getSelectedItemIndex());
-            }
-        }
-        else // You are scrolling up
+        // Scrolling in opposite directions may have cancelled each other out when the events were merged
+        if (delta == 0)
+            return true;
+
+        // Scrolling down selects the next item. Merged events move multiple items at once, while small movements of
+        // a touchpad still move a single item.
+        int itemsToMove;
+        if (std::abs(delta) <= 1)
+            itemsToMove = (delta < 0) ? 1 : -1;
+        else
+            itemsToMove = -static_cast<int>(std::round(delta));
+
+        // Without a selected item, only scrolling down selects one
+        const int selectedIndex = m_listBox->getSelectedItemIndex();
+        if ((selectedIndex < 0) && (itemsToMove < 0))
+            return true;
+
+        const int lastIndex = static_cast<int>(m_listBox->getItemCount()) - 1;
+        const int newIndex = std::max(0, std::min(selectedIndex + itemsToMove, lastIndex));
+        if ((newIndex != selectedIndex) && (newIndex <= lastIndex))
         {
-            // Select the previous item
-            if (m_listBox->getSelectedItemIndex() > 0)
-            {
-                m_listBox->setSelectedItemByIndex(static_cast<std::size_t>(m_listBox->getSelectedItemIndex() - 1));
-                m_text.setString(m_listBox->getSelectedItem());
-                onItemSelect.emit(this, m_listBox->getSelectedItem(), m_listBox->getSelectedItemId(), m_listBox->getSelectedItemIndex());
-            }
+            m_listBox->setSelectedItemByIndex(static_cast<std::size_t>(newIndex));
+            m_text.setString(m_listBox->getSelectedItem());
+            onItemSelect.emit(this, m_listBox->getSelectedItem(), m_listBox->getSelectedItemId(), m_listBox->getSelectedItemIndex());
         }
 
         return true;
@@ -41,6 +41,7 @@ namespace tgui
     const std::string EditBox::Validator::Int   = "[+-]?[0-9]*";
     const std::string EditBox::Validator::UInt  = "[0-9]*";
     const std::string EditBox::Validator::Float = "[+-]?[0-9]*\\.?[0-9]*";
+    const std::string EditBox::Validator::Hex   = "[0-9a-fA-F]*";
 #endif
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -168,10 +169,9 @@ namespace tgui
         }
 
         // Change the text if allowed
-        if (m_regexString == ".*")
+        const std::size_t previousLength = m_text.getSize();
+        if (m_inputValidator.matches(text))
             m_text = text;
-        else if (std::regex_match(text.toAnsiString(), m_regex))
-            m_text = text.toAnsiString(); // Unicode is not supported when using regex because it can't be checked
         else // Clear the text
             m_text = "";
 
@@ -179,6 +179,9 @@ namespace tgui
         if ((m_maxChars > 0) && (m_text.getSize() > m_maxChars))
             m_text.erase(m_maxChars, sf::String::InvalidPos);
 
+        m_inputValidator.textEdited(m_text, 0, previousLength, m_text.getSize());
+        invalidate();
+
         // Set the displayed text
         if (m_passwordChar != '\0')
         {
@@ -210,6 +213,7 @@ namespace tgui
                 displayedString.erase(displayedString.getSize()-1);
                 m_textFull.setString(displayedString);
                 m_text.erase(m_text.getSize()-1);
+                m_inputValidator.textEdited(m_text, m_text.getSize(), 1, 0);
             }
 
             m_textBeforeSelection.setString(m_textFull.getString());
@@ -319,7 +323,9 @@ namespace tgui
             sf::String displayedText = m_textFull.getString();
 
             // Remove all the excess characters
+            const std::size_t removedChars = m_text.getSize() - m_maxChars;
             m_text.erase(m_maxChars, sf::String::InvalidPos);
+            m_inputValidator.textEdited(m_text, m_maxChars, removedChars, 0);
             displayedText.erase(m_maxChars, sf::String::InvalidPos);
 
             // If we passed here then the text has changed.
@@ -375,6 +381,7 @@ namespace tgui
                 displayedString.erase(displayedString.getSize()-1);
                 m_textFull.setString(displayedString);
                 m_text.erase(m_text.getSize()-1);
+                m_inputValidator.textEdited(m_text, m_text.getSize(), 1, 0);
             }
 
             m_textBeforeSelection.setString(m_textFull.getString());
@@ -436,14 +443,13 @@ namespace tgui
     {
         try
         {
-            m_regex = regex;
+            m_inputValidator = InputValidator{regex};
         }
-        catch (const std::regex_error&)
+        catch (const Exception&)
         {
             return false;
         }
 
-        m_regexString = regex;
         setText(m_text);
         return true;
     }
@@ -452,7 +458,7 @@ namespace tgui
 
     const std::string& EditBox::getInputValidator() const
     {
-        return m_regexString;
+        return m_inputValidator.getPattern();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -770,6 +776,7 @@ namespace tgui
                     displayedString.erase(m_selEnd-1, 1);
                     m_textFull.setString(displayedString);
                     m_text.erase(m_selEnd-1, 1);
+                    m_inputValidator.textEdited(m_text, m_selEnd-1, 1, 0);
 
                     // Set the caret back on the correct position
                     setCaretPosition(m_selEnd - 1);
@@ -809,6 +816,7 @@ namespace tgui
                     displayedString.erase(m_selEnd, 1);
                     m_textFull.setString(displayedString);
                     m_text.erase(m_selEnd, 1);
+                    m_inputValidator.textEdited(m_text, m_selEnd, 1, 0);
 
                     // Set the caret back on the correct position
                     setCaretPosition(m_selEnd);
@@ -904,23 +912,8 @@ namespace tgui
             return;
 
         // Only add the character when the regex matches
-        if (m_regexString != ".*")
-        {
-            sf::String text = m_text;
-
-            if (m_selChars == 0)
-                text.insert(m_selEnd, key);
-            else
-            {
-                const std::size_t pos = std::min(m_selStart, m_selEnd);
-                text.erase(pos, m_selChars);
-                text.insert(pos, key);
-            }
-
-            // The character has to match the regex
-            if (!std::regex_match(text.toAnsiString(), m_regex))
-                return;
-        }
+        if (!m_inputValidator.matchesAfterEdit(m_text, (m_selChars == 0) ? m_selEnd : std::min(m_selStart, m_selEnd), m_selChars, key))
+            return;
 
         // If there are selected characters then delete them first
         if (m_selChars > 0)
@@ -932,6 +925,7 @@ namespace tgui
 
         // Insert our character
         m_text.insert(m_selEnd, key);
+        m_inputValidator.textEdited(m_text, m_selEnd, 0, 1);
 
         // Change the displayed text
         sf::String displayedText = m_textFull.getString();
@@ -950,6 +944,7 @@ namespace tgui
             {
                 // If the text does not fit in the EditBox then delete the added character
                 m_text.erase(m_selEnd, 1);
+                m_inputValidator.textEdited(m_text, m_selEnd, 1, 0);
                 displayedText.erase(m_selEnd, 1);
                 m_textFull.setString(displayedText);
                 return;
@@ -1145,6 +1140,8 @@ namespace tgui
                 node->propertyValuePairs["InputValidator"] = std::make_unique<DataIO::ValueNode>("UInt");
             else if (getInputValidator() == EditBox::Validator::Float)
                 node->propertyValuePairs["InputValidator"] = std::make_unique<DataIO::ValueNode>("Float");
+            else if (getInputValidator() == EditBox::Validator::Hex)
+                node->propertyValuePairs["InputValidator"] = std::make_unique<DataIO::ValueNode>("Hex");
             else
                 node->propertyValuePairs["InputValidator"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(sf::String{getInputValidator()}));
         }
@@ -1214,6 +1211,8 @@ namespace tgui
                 setInputValidator(EditBox::Validator::UInt);
             else if (toLower(node->propertyValuePairs["inputvalidator"]->value) == "float")
                 setInputValidator(EditBox::Validator::Float);
+            else if (toLower(node->propertyValuePairs["inputvalidator"]->value) == "hex")
+                setInputValidator(EditBox::Validator::Hex);
             else
                 setInputValidator(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["inputvalidator"]->value).getString());
         }
@@ -1327,6 +1326,7 @@ namespace tgui
         displayedString.erase(pos, m_selChars);
         m_textFull.setString(displayedString);
         m_text.erase(pos, m_selChars);
+        m_inputValidator.textEdited(m_text, pos, m_selChars, 0);
 
         // Set the caret back on the correct position
         setCaretPosition(pos);
@@ -1503,7 +1503,14 @@ namespace tgui
 
             // Too slow for double clicking
             m_possibleDoubleClick = false;
+
+            // The caret is only drawn while the widget is focused
+            if (m_focused)
+                invalidate();
         }
+
+        if (m_focused)
+            requestWakeup(sf::milliseconds(500) - m_animationTimeElapsed);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
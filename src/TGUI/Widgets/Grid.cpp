@@ -637,8 +637,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Grid::isDrawnInsideBounds() const
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Grid::updatePositionsOfAllWidgets()
     {
+        if (deferLayoutUpdate())
+            return;
+
         Vector2f position;
 
         // Fill the entire space when a size was given
@@ -738,6 +748,9 @@ namespace tgui
 
     void Grid::updateWidgets()
     {
+        if (deferLayoutUpdate())
+            return;
+
         // Reset the column widths
         for (float& width : m_columnWidth)
             width = 0;
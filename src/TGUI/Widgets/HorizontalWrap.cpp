@@ -61,6 +61,9 @@ namespace tgui
 
     void HorizontalWrap::updateWidgets()
     {
+        if (deferLayoutUpdate())
+            return;
+
         const Vector2f contentSize = {getSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(),
                                           getSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()};
 
@@ -26,6 +26,7 @@
 #include <TGUI/Widgets/Label.hpp>
 #include <TGUI/Clipping.hpp>
 
+#include <algorithm>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -110,7 +111,7 @@ namespace tgui
 
         // You are no longer auto-sizing
         m_autoSize = false;
-        rearrangeText();
+        requestRearrangeText();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -118,7 +119,9 @@ namespace tgui
     void Label::setText(const sf::String& string)
     {
         m_string = string;
-        rearrangeText();
+        m_wrapCache.clear();
+        requestRearrangeText();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -135,7 +138,7 @@ namespace tgui
         if (size != m_textSize)
         {
             m_textSize = size;
-            rearrangeText();
+            requestRearrangeText();
         }
     }
 
@@ -144,7 +147,7 @@ namespace tgui
     void Label::setHorizontalAlignment(HorizontalAlignment alignment)
     {
         m_horizontalAlignment = alignment;
-        rearrangeText();
+        requestRearrangeText();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -159,7 +162,7 @@ namespace tgui
     void Label::setVerticalAlignment(VerticalAlignment alignment)
     {
         m_verticalAlignment = alignment;
-        rearrangeText();
+        requestRearrangeText();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -177,7 +180,7 @@ namespace tgui
 
         // The policy only has an effect when not auto-sizing
         if (!m_autoSize)
-            rearrangeText();
+            requestRearrangeText();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -195,7 +198,7 @@ namespace tgui
             return;
 
         m_autoSize = autoSize;
-        rearrangeText();
+        requestRearrangeText();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -213,7 +216,7 @@ namespace tgui
             return;
 
         m_maximumTextWidth = maximumWidth;
-        rearrangeText();
+        requestRearrangeText();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -270,10 +273,14 @@ namespace tgui
 
     void Label::leftMousePressed(Vector2f pos)
     {
+        if (m_rearrangeTextPending)
+            rearrangeText();
+
         if (m_scrollbar->isShown() && m_scrollbar->mouseOnWidget(pos - getPosition()))
         {
             m_mouseDown = true;
             m_scrollbar->leftMousePressed(pos - getPosition());
+            updateVisibleLines();
         }
         else
             ClickableWidget::leftMousePressed(pos);
@@ -283,6 +290,9 @@ namespace tgui
 
     void Label::leftMouseReleased(Vector2f pos)
     {
+        if (m_rearrangeTextPending)
+            rearrangeText();
+
         if (!m_scrollbar->isShown() || !m_scrollbar->isMouseDown())
         {
             const bool mouseDown = m_mouseDown;
@@ -309,15 +319,24 @@ namespace tgui
             m_mouseDown = false;
 
         if (m_scrollbar->isShown())
+        {
             m_scrollbar->leftMouseReleased(pos - getPosition());
+            updateVisibleLines();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Label::mouseMoved(Vector2f pos)
     {
+        if (m_rearrangeTextPending)
+            rearrangeText();
+
         if (m_scrollbar->isShown() && ((m_scrollbar->isMouseDown() && m_scrollbar->isMouseDownOnThumb()) || m_scrollbar->mouseOnWidget(pos - getPosition())))
+        {
             m_scrollbar->mouseMoved(pos - getPosition());
+            updateVisibleLines();
+        }
         else
         {
             ClickableWidget::mouseMoved(pos);
@@ -331,9 +350,13 @@ namespace tgui
 
     bool Label::mouseWheelScrolled(float delta, Vector2f pos)
     {
+        if (m_rearrangeTextPending)
+            rearrangeText();
+
         if (!m_autoSize && m_scrollbar->isShown())
         {
             m_scrollbar->mouseWheelScrolled(delta, pos - getPosition());
+            updateVisibleLines();
             return true;
         }
 
@@ -377,18 +400,18 @@ namespace tgui
             m_bordersCached.updateParentSize(getSize());
             m_spriteBackground.setSize({getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
                                         getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
-            rearrangeText();
+            requestRearrangeText();
         }
         else if (property == "padding")
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             m_paddingCached.updateParentSize(getSize());
-            rearrangeText();
+            requestRearrangeText();
         }
         else if (property == "textstyle")
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
-            rearrangeText();
+            requestRearrangeText();
         }
         else if (property == "textcolor")
         {
@@ -428,19 +451,19 @@ namespace tgui
             if (!getSharedRenderer()->getScrollbarWidth())
             {
                 m_scrollbar->setSize({m_scrollbar->getDefaultWidth(), m_scrollbar->getSize().y});
-                rearrangeText();
+                requestRearrangeText();
             }
         }
         else if (property == "scrollbarwidth")
         {
             const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scrollbar->getDefaultWidth();
             m_scrollbar->setSize({width, m_scrollbar->getSize().y});
-            rearrangeText();
+            requestRearrangeText();
         }
         else if (property == "font")
         {
             Widget::rendererChanged(property);
-            rearrangeText();
+            requestRearrangeText();
         }
         else if ((property == "opacity") || (property == "opacitydisabled"))
         {
@@ -552,6 +575,10 @@ namespace tgui
     {
         Widget::update(elapsedTime);
 
+        // Changes to the size or text are only processed once, right before the label is drawn
+        if (m_rearrangeTextPending)
+            rearrangeText();
+
         if (m_animationTimeElapsed >= sf::milliseconds(getDoubleClickTime()))
         {
             m_animationTimeElapsed = {};
@@ -563,7 +590,11 @@ namespace tgui
 
     void Label::rearrangeText()
     {
+        m_rearrangeTextPending = false;
         m_lines.clear();
+        m_wrappedString.clear();
+        m_lineStarts.clear();
+        m_firstVisibleLine = 0;
 
         if (m_fontCached == nullptr)
             return;
@@ -608,14 +639,14 @@ namespace tgui
         }
 
         // Fit the text in the available space
-        sf::String string = Text::wordWrap(maxWidth, m_string, m_fontCached, m_textSize, m_textStyleCached & sf::Text::Bold);
+        m_wrappedString = getWrappedText(maxWidth);
 
         const Outline outline = {m_paddingCached.getLeft() + m_bordersCached.getLeft(),
                                  m_paddingCached.getTop() + m_bordersCached.getTop(),
                                  m_paddingCached.getRight() + m_bordersCached.getRight(),
                                  m_paddingCached.getBottom() + m_bordersCached.getBottom()};
 
-        const auto lineCount = std::count(string.begin(), string.end(), static_cast<sf::Uint32>('\n')) + 1;
+        const auto lineCount = std::count(m_wrappedString.begin(), m_wrappedString.end(), static_cast<sf::Uint32>('\n')) + 1;
         float requiredTextHeight = lineCount * m_fontCached.getLineSpacing(m_textSize)
                                    + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize, m_textStyleCached)
                                    + Text::getExtraVerticalPadding(m_textSize);
@@ -628,11 +659,14 @@ namespace tgui
             {
                 maxWidth -= m_scrollbar->getSize().x;
                 if (maxWidth <= 0)
+                {
+                    m_wrappedString.clear();
                     return;
+                }
 
-                string = Text::wordWrap(maxWidth, m_string, m_fontCached, m_textSize, m_textStyleCached & sf::Text::Bold);
+                m_wrappedString = getWrappedText(maxWidth);
 
-                const auto newLineCount = std::count(string.begin(), string.end(), static_cast<sf::Uint32>('\n')) + 1;
+                const auto newLineCount = std::count(m_wrappedString.begin(), m_wrappedString.end(), static_cast<sf::Uint32>('\n')) + 1;
                 requiredTextHeight = newLineCount * m_fontCached.getLineSpacing(m_textSize)
                                      + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize, m_textStyleCached)
                                      + Text::getExtraVerticalPadding(m_textSize);
@@ -645,37 +679,26 @@ namespace tgui
             m_scrollbar->setScrollAmount(m_textSize);
         }
 
-        // Split the string in multiple lines
-        float width = 0;
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        while (newLinePos != sf::String::InvalidPos)
+        // Find out where each line starts
+        m_lineStarts.push_back(0);
+        for (std::size_t i = 0; i < m_wrappedString.getSize(); ++i)
         {
-            newLinePos = string.find('\n', searchPosStart);
-
-            TGUI_EMPLACE_BACK(line, m_lines)
-            line.setCharacterSize(getTextSize());
-            line.setFont(m_fontCached);
-            line.setStyle(m_textStyleCached);
-            line.setColor(m_textColorCached);
-            line.setOpacity(m_opacityCached);
-            line.setOutlineColor(m_textOutlineColorCached);
-            line.setOutlineThickness(m_textOutlineThicknessCached);
-
-            if (newLinePos != sf::String::InvalidPos)
-                line.setString(string.substring(searchPosStart, newLinePos - searchPosStart));
-            else
-                line.setString(string.substring(searchPosStart));
-
-            if (line.getSize().x > width)
-                width = line.getSize().x;
-
-            searchPosStart = newLinePos + 1;
+            if (m_wrappedString[i] == '\n')
+                m_lineStarts.push_back(i + 1);
         }
 
-        // Update the size of the label
+        // Update the size of the label, which requires all lines to be created in order to know the width of the text
         if (m_autoSize)
         {
+            createLines(0, m_lineStarts.size());
+
+            float width = 0;
+            for (const auto& line : m_lines)
+            {
+                if (line.getSize().x > width)
+                    width = line.getSize().x;
+            }
+
             Widget::setSize({std::max(width, maxWidth) + outline.getLeft() + outline.getRight() + 2*textOffset, requiredTextHeight + outline.getTop() + outline.getBottom()});
             m_bordersCached.updateParentSize(getSize());
             m_paddingCached.updateParentSize(getSize());
@@ -684,55 +707,173 @@ namespace tgui
                                         getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
         }
 
-        // Update the line positions
-        {
-            if ((getSize().x <= outline.getLeft() + outline.getRight()) || (getSize().y <= outline.getTop() + outline.getBottom()))
-                return;
+        // Find the position of the first line
+        if ((getSize().x <= outline.getLeft() + outline.getRight()) || (getSize().y <= outline.getTop() + outline.getBottom()))
+            return;
 
-            Vector2f pos{m_paddingCached.getLeft() + textOffset, m_paddingCached.getTop()};
+        m_linesPosition = {m_paddingCached.getLeft() + textOffset, m_paddingCached.getTop()};
+        if (m_verticalAlignment != VerticalAlignment::Top)
+        {
+            const float totalHeight = getSize().y - outline.getTop() - outline.getBottom();
+            const float totalTextHeight = m_lineStarts.size() * m_fontCached.getLineSpacing(m_textSize);
 
-            if (m_verticalAlignment != VerticalAlignment::Top)
+            if (!m_scrollbar->isShown() || (totalTextHeight < totalHeight))
             {
-                const float totalHeight = getSize().y - outline.getTop() - outline.getBottom();
-                const float totalTextHeight = m_lines.size() * m_fontCached.getLineSpacing(m_textSize);
-
-                if (!m_scrollbar->isShown() || (totalTextHeight < totalHeight))
-                {
-                    if (m_verticalAlignment == VerticalAlignment::Center)
-                        pos.y += (totalHeight - totalTextHeight) / 2.f;
-                    else if (m_verticalAlignment == VerticalAlignment::Bottom)
-                        pos.y += totalHeight - totalTextHeight;
-                }
+                if (m_verticalAlignment == VerticalAlignment::Center)
+                    m_linesPosition.y += (totalHeight - totalTextHeight) / 2.f;
+                else if (m_verticalAlignment == VerticalAlignment::Bottom)
+                    m_linesPosition.y += totalHeight - totalTextHeight;
             }
+        }
+
+        if (m_autoSize)
+            positionLines();
+        else
+            updateVisibleLines(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Label::requestRearrangeText()
+    {
+        // An auto-sized label has to be rearranged immediately, as its size depends on the result
+        if (m_autoSize)
+        {
+            rearrangeText();
+            return;
+        }
+
+        m_rearrangeTextPending = true;
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::String& Label::getWrappedText(float maxWidth)
+    {
+        const bool bold = (m_textStyleCached & sf::Text::Bold) != 0;
+        if ((m_wrapCacheFont != m_fontCached) || (m_wrapCacheTextSize != m_textSize) || (m_wrapCacheBold != bold))
+        {
+            m_wrapCache.clear();
+            m_wrapCacheFont = m_fontCached;
+            m_wrapCacheTextSize = m_textSize;
+            m_wrapCacheBold = bold;
+        }
 
-            if (m_horizontalAlignment == HorizontalAlignment::Left)
+        // A maximum width of 0 means that the text isn't wrapped, which is stored as an empty range
+        for (auto it = m_wrapCache.begin(); it != m_wrapCache.end(); ++it)
+        {
+            const bool match = (maxWidth == 0) ? (it->maximumWidth == 0) : ((it->minimumWidth <= maxWidth) && (maxWidth < it->maximumWidth));
+            if (match)
             {
-                const float lineSpacing = m_fontCached.getLineSpacing(m_textSize);
-                for (auto& line : m_lines)
-                {
-                    line.setPosition(pos.x, pos.y);
-                    pos.y += lineSpacing;
-                }
+                // Keep the most recently used entry in front
+                std::rotate(m_wrapCache.begin(), it, it + 1);
+                return m_wrapCache.front().wrappedString;
             }
-            else // Center or Right alignment
+        }
+
+        // Only a few entries are kept, which is enough to switch between the widths with and without a scrollbar
+        const std::size_t maxCacheEntries = 4;
+        if (m_wrapCache.size() >= maxCacheEntries)
+            m_wrapCache.pop_back();
+
+        WrapCacheEntry entry;
+        entry.wrappedString = Text::wordWrap(maxWidth, m_string, m_fontCached, m_textSize, bold, true, entry.minimumWidth, entry.maximumWidth);
+        m_wrapCache.insert(m_wrapCache.begin(), std::move(entry));
+        return m_wrapCache.front().wrappedString;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Label::updateVisibleLines(bool forceRebuild)
+    {
+        if (m_lineStarts.empty() || (m_fontCached == nullptr))
+            return;
+
+        // Find the lines that intersect with the clipping area, with one extra line on each side for characters that stick out
+        std::size_t firstLine = 0;
+        std::size_t lastLine = m_lineStarts.size();
+        const float lineSpacing = m_fontCached.getLineSpacing(m_textSize);
+        if (lineSpacing > 0)
+        {
+            const float visibleTop = m_paddingCached.getTop() + (m_scrollbar->isShown() ? static_cast<float>(m_scrollbar->getValue()) : 0.f);
+            const float visibleHeight = getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom() - m_paddingCached.getTop() - m_paddingCached.getBottom();
+
+            const float firstLineFloat = std::floor((visibleTop - m_linesPosition.y) / lineSpacing) - 1;
+            const float lastLineFloat = std::ceil((visibleTop + visibleHeight - m_linesPosition.y) / lineSpacing) + 1;
+            if (firstLineFloat > 0)
+                firstLine = std::min(lastLine, static_cast<std::size_t>(firstLineFloat));
+            if (lastLineFloat < static_cast<float>(lastLine))
+                lastLine = std::max(firstLine, static_cast<std::size_t>(std::max(0.f, lastLineFloat)));
+        }
+
+        if (!forceRebuild && (firstLine == m_firstVisibleLine) && (lastLine - firstLine == m_lines.size()))
+            return;
+
+        m_lines.clear();
+        createLines(firstLine, lastLine);
+        positionLines();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Label::createLines(std::size_t firstLine, std::size_t lastLine)
+    {
+        m_firstVisibleLine = firstLine;
+        m_lines.reserve(lastLine - firstLine);
+        for (std::size_t i = firstLine; i < lastLine; ++i)
+        {
+            TGUI_EMPLACE_BACK(line, m_lines)
+            line.setCharacterSize(getTextSize());
+            line.setFont(m_fontCached);
+            line.setStyle(m_textStyleCached);
+            line.setColor(m_textColorCached);
+            line.setOpacity(m_opacityCached);
+            line.setOutlineColor(m_textOutlineColorCached);
+            line.setOutlineThickness(m_textOutlineThicknessCached);
+
+            if (i + 1 < m_lineStarts.size())
+                line.setString(m_wrappedString.substring(m_lineStarts[i], m_lineStarts[i+1] - 1 - m_lineStarts[i]));
+            else
+                line.setString(m_wrappedString.substring(m_lineStarts[i]));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Label::positionLines()
+    {
+        const float lineSpacing = m_fontCached.getLineSpacing(m_textSize);
+        Vector2f pos{m_linesPosition.x, m_linesPosition.y + m_firstVisibleLine * lineSpacing};
+
+        if (m_horizontalAlignment == HorizontalAlignment::Left)
+        {
+            for (auto& line : m_lines)
             {
-                const float totalWidth = getSize().x - outline.getLeft() - outline.getRight() - 2*textOffset;
+                line.setPosition(pos.x, pos.y);
+                pos.y += lineSpacing;
+            }
+        }
+        else // Center or Right alignment
+        {
+            const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize, m_textStyleCached);
+            const float totalWidth = getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight()
+                                     - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2*textOffset;
 
-                for (auto& line : m_lines)
-                {
-                    std::size_t lastChar = line.getString().getSize();
-                    while (lastChar > 0 && isWhitespace(line.getString()[lastChar-1]))
-                        lastChar--;
+            for (auto& line : m_lines)
+            {
+                std::size_t lastChar = line.getString().getSize();
+                while (lastChar > 0 && isWhitespace(line.getString()[lastChar-1]))
+                    lastChar--;
 
-                    const float textWidth = line.findCharacterPos(lastChar).x;
+                const float textWidth = line.findCharacterPos(lastChar).x;
 
-                    if (m_horizontalAlignment == HorizontalAlignment::Center)
-                        line.setPosition(pos.x + ((totalWidth - textWidth) / 2.f), pos.y);
-                    else // if (m_horizontalAlignment == HorizontalAlignment::Right)
-                        line.setPosition(pos.x + totalWidth - textWidth, pos.y);
+                if (m_horizontalAlignment == HorizontalAlignment::Center)
+                    line.setPosition(pos.x + ((totalWidth - textWidth) / 2.f), pos.y);
+                else // if (m_horizontalAlignment == HorizontalAlignment::Right)
+                    line.setPosition(pos.x + totalWidth - textWidth, pos.y);
 
-                    pos.y += m_fontCached.getLineSpacing(m_textSize);
-                }
+                pos.y += lineSpacing;
             }
         }
     }
@@ -25,11 +25,58 @@
 
 #include <TGUI/Widgets/ListBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <cwctype>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Characters typed after a pause of this length start a new search instead of extending the previous one
+        const sf::Time typeToSearchTimeout = sf::seconds(1);
+
+        std::uint32_t listBoxCharToLower(std::uint32_t c)
+        {
+            if (c < 128)
+                return ((c >= 'A') && (c <= 'Z')) ? c - 'A' + 'a' : c;
+            else if (c <= 0xFFFF)
+                return static_cast<std::uint32_t>(std::towlower(static_cast<std::wint_t>(c)));
+            else
+                return c;
+        }
+
+        // Compares the first characters of the item with the prefix, ignoring case.
+        // Returns a negative value when the item comes before the prefix, 0 when the item starts with it and a positive value otherwise.
+        int compareListBoxItemWithPrefix(const sf::String& item, const sf::String& lowercasePrefix)
+        {
+            const std::size_t length = std::min(item.getSize(), lowercasePrefix.getSize());
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                const std::uint32_t c = listBoxCharToLower(item[i]);
+                if (c != lowercasePrefix[i])
+                    return (c < lowercasePrefix[i]) ? -1 : 1;
+            }
+
+            return (item.getSize() < lowercasePrefix.getSize()) ? -1 : 0;
+        }
+
+        bool lessListBoxItem(const sf::String& left, const sf::String& right)
+        {
+            const std::size_t length = std::min(left.getSize(), right.getSize());
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                const std::uint32_t leftChar = listBoxCharToLower(left[i]);
+                const std::uint32_t rightChar = listBoxCharToLower(right[i]);
+                if (leftChar != rightChar)
+                    return leftChar < rightChar;
+            }
+
+            return left.getSize() < right.getSize();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     ListBox::ListBox()
@@ -98,9 +145,6 @@ namespace tgui
     {
         Widget::setPosition(position);
 
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-            m_items[i].setPosition({0, (i * m_itemHeight) + ((m_itemHeight - m_items[i].getSize().y) / 2.0f)});
-
         m_scroll->setPosition(getSize().x - m_bordersCached.getRight() - m_scroll->getSize().x, m_bordersCached.getTop());
     }
 
@@ -134,19 +178,10 @@ namespace tgui
             if (m_autoScroll && (m_scroll->getViewportSize() < m_scroll->getMaximum()))
                 m_scroll->setValue(m_scroll->getMaximum() - m_scroll->getViewportSize());
 
-            // Create the new item
-            Text newItem;
-            newItem.setFont(m_fontCached);
-            newItem.setColor(m_textColorCached);
-            newItem.setOpacity(m_opacityCached);
-            newItem.setStyle(m_textStyleCached);
-            newItem.setCharacterSize(m_textSize);
-            newItem.setString(itemName);
-            newItem.setPosition({0, (m_items.size() * m_itemHeight) + ((m_itemHeight - newItem.getSize().y) / 2.0f)});
-
-            // Add the new item to the list
-            m_items.push_back(std::move(newItem));
+            // Add the new item to the list, its text is only created when it becomes visible
+            m_items.push_back(itemName);
             m_itemIds.push_back(id);
+            itemsChanged();
             return true;
         }
         else // The item limit was reached
@@ -159,7 +194,7 @@ namespace tgui
     {
         for (std::size_t i = 0; i < m_items.size(); ++i)
         {
-            if (m_items[i].getString() == itemName)
+            if (m_items[i] == itemName)
                 return setSelectedItemByIndex(i);
         }
 
@@ -201,6 +236,7 @@ namespace tgui
         else if ((m_selectedItem + 1) * getItemHeight() > m_scroll->getValue() + m_scroll->getViewportSize())
             m_scroll->setValue((m_selectedItem + 1) * getItemHeight() - m_scroll->getViewportSize());
 
+        invalidate();
         return true;
     }
 
@@ -217,7 +253,7 @@ namespace tgui
     {
         for (std::size_t i = 0; i < m_items.size(); ++i)
         {
-            if (m_items[i].getString() == itemName)
+            if (m_items[i] == itemName)
                 return removeItemByIndex(i);
         }
 
@@ -259,9 +295,9 @@ namespace tgui
         // Remove the item
         m_items.erase(m_items.begin() + index);
         m_itemIds.erase(m_itemIds.begin() + index);
+        itemsChanged();
 
         m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
-        setPosition(m_position);
 
         return true;
     }
@@ -277,6 +313,7 @@ namespace tgui
         // Clear the list, remove all items
         m_items.clear();
         m_itemIds.clear();
+        itemsChanged();
 
         m_scroll->setMaximum(0);
     }
@@ -288,7 +325,7 @@ namespace tgui
         for (std::size_t i = 0; i < m_itemIds.size(); ++i)
         {
             if (m_itemIds[i] == id)
-                return m_items[i].getString();
+                return m_items[i];
         }
 
         return "";
@@ -301,14 +338,14 @@ namespace tgui
         if (index >= m_items.size())
             return "";
 
-        return m_items[index].getString();
+        return m_items[index];
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::String ListBox::getSelectedItem() const
     {
-        return (m_selectedItem >= 0) ? m_items[m_selectedItem].getString() : "";
+        return (m_selectedItem >= 0) ? m_items[m_selectedItem] : "";
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -331,7 +368,7 @@ namespace tgui
     {
         for (std::size_t i = 0; i < m_items.size(); ++i)
         {
-            if (m_items[i].getString() == originalValue)
+            if (m_items[i] == originalValue)
                 return changeItemByIndex(i, newValue);
         }
 
@@ -358,7 +395,8 @@ namespace tgui
         if (index >= m_items.size())
             return false;
 
-        m_items[index].setString(newValue);
+        m_items[index] = newValue;
+        itemsChanged();
         return true;
     }
 
@@ -373,11 +411,7 @@ namespace tgui
 
     std::vector<sf::String> ListBox::getItems() const
     {
-        std::vector<sf::String> items;
-        for (const auto& item : m_items)
-            items.push_back(item.getString());
-
-        return items;
+        return m_items;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -394,15 +428,12 @@ namespace tgui
         // Set the new heights
         m_itemHeight = itemHeight;
         if (m_requestedTextSize == 0)
-        {
             m_textSize = Text::findBestTextSize(m_fontCached, itemHeight * 0.8f);
-            for (auto& item : m_items)
-                item.setCharacterSize(m_textSize);
-        }
 
         m_scroll->setScrollAmount(m_itemHeight);
         m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
-        setPosition(m_position);
+        m_visibleItemTextsOutdated = true;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -423,10 +454,8 @@ namespace tgui
         else
             m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
 
-        for (auto& item : m_items)
-            item.setCharacterSize(m_textSize);
-
-        setPosition(m_position);
+        m_visibleItemTextsOutdated = true;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -442,9 +471,9 @@ namespace tgui
             // Remove the items that passed the limitation
             m_items.erase(m_items.begin() + m_maxItems, m_items.end());
             m_itemIds.erase(m_itemIds.begin() + m_maxItems, m_itemIds.end());
+            itemsChanged();
 
             m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
-            setPosition(m_position);
         }
     }
 
@@ -473,7 +502,7 @@ namespace tgui
 
     bool ListBox::contains(const sf::String& item) const
     {
-        return std::find_if(m_items.begin(), m_items.end(), [item](const Text& text){ return text.getString() == item; }) != m_items.end();
+        return std::find(m_items.begin(), m_items.end(), item) != m_items.end();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -485,9 +514,59 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    int ListBox::findItemByPrefix(const sf::String& prefix) const
+    {
+        if (prefix.isEmpty())
+            return -1;
+
+        sf::String lowercasePrefix = prefix;
+        for (auto& c : lowercasePrefix)
+            c = listBoxCharToLower(c);
+
+        if (m_prefixIndexOutdated)
+        {
+            m_prefixIndex.resize(m_items.size());
+            for (std::size_t i = 0; i < m_prefixIndex.size(); ++i)
+                m_prefixIndex[i] = i;
+
+            std::stable_sort(m_prefixIndex.begin(), m_prefixIndex.end(),
+                             [this](std::size_t left, std::size_t right){ return lessListBoxItem(m_items[left], m_items[right]); });
+
+            m_prefixIndexOutdated = false;
+            m_prefixSearchText.clear();
+        }
+
+        // When the prefix extends the previous one, the matches can only lie within the matches of the previous search
+        auto first = m_prefixIndex.cbegin();
+        auto last = m_prefixIndex.cend();
+        if (!m_prefixSearchText.isEmpty() && (lowercasePrefix.getSize() >= m_prefixSearchText.getSize())
+         && (lowercasePrefix.substring(0, m_prefixSearchText.getSize()) == m_prefixSearchText))
+        {
+            first = m_prefixIndex.cbegin() + m_prefixSearchBegin;
+            last = m_prefixIndex.cbegin() + m_prefixSearchEnd;
+        }
+
+        first = std::lower_bound(first, last, lowercasePrefix,
+            [this](std::size_t item, const sf::String& value){ return compareListBoxItemWithPrefix(m_items[item], value) < 0; });
+        last = std::upper_bound(first, last, lowercasePrefix,
+            [this](const sf::String& value, std::size_t item){ return compareListBoxItemWithPrefix(m_items[item], value) > 0; });
+
+        m_prefixSearchText = lowercasePrefix;
+        m_prefixSearchBegin = static_cast<std::size_t>(first - m_prefixIndex.cbegin());
+        m_prefixSearchEnd = static_cast<std::size_t>(last - m_prefixIndex.cbegin());
+
+        if (first == last)
+            return -1;
+
+        return static_cast<int>(*std::min_element(first, last));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::setScrollbarValue(unsigned int value)
     {
         m_scroll->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -544,7 +623,7 @@ namespace tgui
 
                 // Call the MousePress event after the item has already been changed, so that selected item represents the clicked item
                 if (m_selectedItem >= 0)
-                    onMousePress.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem], m_selectedItem);
+                    onMousePress.emit(this, m_items[m_selectedItem], m_itemIds[m_selectedItem], m_selectedItem);
             }
         }
     }
@@ -556,7 +635,7 @@ namespace tgui
         if (m_mouseDown && !m_scroll->isMouseDown())
         {
             if (m_selectedItem >= 0)
-                onMouseRelease.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem], m_selectedItem);
+                onMouseRelease.emit(this, m_items[m_selectedItem], m_itemIds[m_selectedItem], m_selectedItem);
 
             // Check if you double-clicked
             if (m_possibleDoubleClick)
@@ -564,7 +643,7 @@ namespace tgui
                 m_possibleDoubleClick = false;
 
                 if (m_selectedItem >= 0)
-                    onDoubleClick.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem], m_selectedItem);
+                    onDoubleClick.emit(this, m_items[m_selectedItem], m_itemIds[m_selectedItem], m_selectedItem);
             }
             else // This is the first click
             {
@@ -660,6 +739,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListBox::textEntered(std::uint32_t key)
+    {
+        // Ignore control characters such as backspace and escape
+        if ((key < 32) || (key == 127))
+            return;
+
+        m_typedSearchText += key;
+        m_typedSearchTimeElapsed = {};
+
+        const int item = findItemByPrefix(m_typedSearchText);
+        if ((item >= 0) && (item != m_selectedItem))
+            setSelectedItemByIndex(static_cast<std::size_t>(item));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Signal& ListBox::getSignal(std::string signalName)
     {
         if (signalName == toLower(onItemSelect.getName()))
@@ -715,24 +810,12 @@ namespace tgui
         else if (property == "textstyle")
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
-
-            for (auto& item : m_items)
-                item.setStyle(m_textStyleCached);
-
-            if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
-                m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
+            updateItemColorsAndStyle();
         }
         else if (property == "selectedtextstyle")
         {
             m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
-
-            if (m_selectedItem >= 0)
-            {
-                if (m_selectedTextStyleCached.isSet())
-                    m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
-                else
-                    m_items[m_selectedItem].setStyle(m_textStyleCached);
-            }
+            updateItemColorsAndStyle();
         }
         else if (property == "scrollbar")
         {
@@ -777,25 +860,17 @@ namespace tgui
 
             m_scroll->setInheritedOpacity(m_opacityCached);
             m_spriteBackground.setOpacity(m_opacityCached);
-            for (auto& item : m_items)
-                item.setOpacity(m_opacityCached);
+            updateItemColorsAndStyle();
         }
         else if (property == "font")
         {
             Widget::rendererChanged(property);
 
-            for (auto& item : m_items)
-                item.setFont(m_fontCached);
-
             // Recalculate the text size with the new font
             if (m_requestedTextSize == 0)
-            {
                 m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
-                for (auto& item : m_items)
-                    item.setCharacterSize(m_textSize);
-            }
 
-            setPosition(m_position);
+            updateItemColorsAndStyle();
         }
         else
             Widget::rendererChanged(property);
@@ -903,37 +978,66 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::updateSelectedAndHoveringItemColorsAndStyle()
+    void ListBox::updateItemColorsAndStyle()
     {
-        if (m_selectedItem >= 0)
-        {
-            if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorHoverCached.isSet())
-                m_items[m_selectedItem].setColor(m_selectedTextColorHoverCached);
-            else if (m_selectedTextColorCached.isSet())
-                m_items[m_selectedItem].setColor(m_selectedTextColorCached);
+        m_visibleItemTextsOutdated = true;
+    }
 
-            if (m_selectedTextStyleCached.isSet())
-                m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updateVisibleItemTexts(std::size_t firstItem, std::size_t lastItem) const
+    {
+        // The text objects are reused, so scrolling only changes the strings of the few items that are on the screen
+        m_visibleItemTexts.resize(lastItem - firstItem);
+        m_firstVisibleItemText = firstItem;
+        m_visibleItemTextsOutdated = false;
 
-        if ((m_hoveringItem >= 0) && (m_selectedItem != m_hoveringItem))
+        for (std::size_t i = firstItem; i < lastItem; ++i)
         {
-            if (m_textColorHoverCached.isSet())
-                m_items[m_hoveringItem].setColor(m_textColorHoverCached);
+            Text& text = m_visibleItemTexts[i - firstItem];
+            text.setFont(m_fontCached);
+            text.setCharacterSize(m_textSize);
+            text.setOpacity(m_opacityCached);
+            text.setColor(getItemTextColor(i));
+
+            if ((static_cast<int>(i) == m_selectedItem) && m_selectedTextStyleCached.isSet())
+                text.setStyle(m_selectedTextStyleCached);
+            else
+                text.setStyle(m_textStyleCached);
+
+            text.setString(m_items[i]);
+            text.setPosition({0, (i * m_itemHeight) + ((m_itemHeight - text.getSize().y) / 2.0f)});
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::updateItemColorsAndStyle()
+    Color ListBox::getItemTextColor(std::size_t item) const
     {
-        for (auto& item : m_items)
+        const bool hover = (static_cast<int>(item) == m_hoveringItem);
+        if (static_cast<int>(item) == m_selectedItem)
         {
-            item.setColor(m_textColorCached);
-            item.setStyle(m_textStyleCached);
+            if (hover && m_selectedTextColorHoverCached.isSet())
+                return m_selectedTextColorHoverCached;
+            else if (m_selectedTextColorCached.isSet())
+                return m_selectedTextColorCached;
+            else
+                return m_textColorCached;
         }
 
-        updateSelectedAndHoveringItemColorsAndStyle();
+        if (hover && m_textColorHoverCached.isSet())
+            return m_textColorHoverCached;
+        else
+            return m_textColorCached;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::itemsChanged()
+    {
+        m_visibleItemTextsOutdated = true;
+        m_prefixIndexOutdated = true;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -942,17 +1046,9 @@ namespace tgui
     {
         if (m_hoveringItem != item)
         {
-            if (m_hoveringItem >= 0)
-            {
-                if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorCached.isSet())
-                    m_items[m_hoveringItem].setColor(m_selectedTextColorCached);
-                else
-                    m_items[m_hoveringItem].setColor(m_textColorCached);
-            }
-
             m_hoveringItem = item;
-
-            updateSelectedAndHoveringItemColorsAndStyle();
+            m_visibleItemTextsOutdated = true;
+            invalidate();
         }
     }
 
@@ -962,23 +1058,14 @@ namespace tgui
     {
         if (m_selectedItem != item)
         {
-            if (m_selectedItem >= 0)
-            {
-                if ((m_selectedItem == m_hoveringItem) && m_textColorHoverCached.isSet())
-                    m_items[m_selectedItem].setColor(m_textColorHoverCached);
-                else
-                    m_items[m_selectedItem].setColor(m_textColorCached);
-
-                m_items[m_selectedItem].setStyle(m_textStyleCached);
-            }
-
             m_selectedItem = item;
+            m_visibleItemTextsOutdated = true;
+            invalidate();
+
             if (m_selectedItem >= 0)
-                onItemSelect.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem], m_selectedItem);
+                onItemSelect.emit(this, m_items[m_selectedItem], m_itemIds[m_selectedItem], m_selectedItem);
             else
                 onItemSelect.emit(this, "", "", m_selectedItem);
-
-            updateSelectedAndHoveringItemColorsAndStyle();
         }
     }
 
@@ -993,6 +1080,13 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = false;
         }
+
+        if (!m_typedSearchText.isEmpty())
+        {
+            m_typedSearchTimeElapsed += elapsedTime;
+            if (m_typedSearchTimeElapsed >= typeToSearchTimeout)
+                m_typedSearchText.clear();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1034,8 +1128,13 @@ namespace tgui
                 // Show another item when the scrollbar is standing between two items
                 if ((m_scroll->getValue() + m_scroll->getViewportSize()) % m_itemHeight != 0)
                     ++lastItem;
+
+                lastItem = std::min(lastItem, m_items.size());
             }
 
+            if (m_visibleItemTextsOutdated || (firstItem != m_firstVisibleItemText) || (lastItem - firstItem != m_visibleItemTexts.size()))
+                updateVisibleItemTexts(firstItem, lastItem);
+
             states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop() - m_scroll->getValue()});
 
             // Draw the background of the selected item
@@ -1062,8 +1161,8 @@ namespace tgui
 
             // Draw the items
             states.transform.translate({Text::getExtraHorizontalPadding(m_fontCached, m_textSize, m_textStyleCached), 0});
-            for (std::size_t i = firstItem; i < lastItem; ++i)
-                m_items[i].draw(target, states);
+            for (const auto& text : m_visibleItemTexts)
+                text.draw(target, states);
         }
 
         // Draw the scrollbar
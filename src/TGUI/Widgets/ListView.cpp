@@ -25,12 +25,48 @@
 
 #include <TGUI/Widgets/ListView.hpp>
 #include <TGUI/Clipping.hpp>
+#include <cassert>
 #include <cmath>
+#include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        const sf::String& getListViewCellString(const ListView::Item& item, std::size_t column)
+        {
+            static const sf::String emptyString;
+            if (column < item.texts.size())
+                return item.texts[column].getString();
+            else
+                return emptyString;
+        }
+
+        // Returns the number at the start of the text, or infinity when the text doesn't start with a number so that those
+        // texts are placed behind the numbers when sorting in ascending order
+        float parseListViewNumber(const sf::String& str)
+        {
+            char buffer[64];
+            std::size_t length = 0;
+            for (const std::uint32_t c : str)
+            {
+                if ((c >= 128) || (length == sizeof(buffer)))
+                    break;
+
+                buffer[length++] = static_cast<char>(c);
+            }
+
+            float value;
+            if (priv::parseFloat(buffer, buffer + length, value) && !std::isnan(value))
+                return value;
+            else
+                return std::numeric_limits<float>::infinity();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     ListView::ListView()
@@ -240,7 +276,10 @@ namespace tgui
     void ListView::setColumnAlignment(std::size_t columnIndex, ColumnAlignment alignment)
     {
         if (columnIndex < m_columns.size())
+        {
             m_columns[columnIndex].alignment = alignment;
+            invalidate();
+        }
         else
         {
             TGUI_PRINT_WARNING("setColumnAlignment called with invalid columnIndex.");
@@ -283,11 +322,10 @@ namespace tgui
         item.texts.push_back(createText(text));
         item.icon.setOpacity(m_opacityCached);
 
-        updateVerticalScrollbarMaximum();
+        if (m_rowOrderUsed)
+            updateRowOfItem(m_items.size() - 1, true);
 
-        // Scroll down when auto-scrolling is enabled
-        if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
-            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+        updateAfterAddingItems();
 
         return m_items.size()-1;
     }
@@ -303,11 +341,10 @@ namespace tgui
 
         item.icon.setOpacity(m_opacityCached);
 
-        updateVerticalScrollbarMaximum();
+        if (m_rowOrderUsed)
+            updateRowOfItem(m_items.size() - 1, true);
 
-        // Scroll down when auto-scrolling is enabled
-        if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
-            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+        updateAfterAddingItems();
 
         return m_items.size()-1;
     }
@@ -326,11 +363,10 @@ namespace tgui
             item.icon.setOpacity(m_opacityCached);
         }
 
-        updateVerticalScrollbarMaximum();
+        if (m_rowOrderUsed)
+            updateRowOrder();
 
-        // Scroll down when auto-scrolling is enabled
-        if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
-            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+        updateAfterAddingItems();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -340,12 +376,32 @@ namespace tgui
         if (index >= m_items.size())
             return false;
 
+        // Reuse the existing texts, so that only their strings have to be replaced
         Item& item = m_items[index];
-        item.texts.clear();
-        item.texts.reserve(itemTexts.size());
-        for (const auto& text : itemTexts)
-            item.texts.push_back(createText(text));
+        const std::size_t reusedTexts = std::min(item.texts.size(), itemTexts.size());
+        for (std::size_t i = 0; i < reusedTexts; ++i)
+            item.texts[i].setString(itemTexts[i]);
+
+        if (item.texts.size() > itemTexts.size())
+            item.texts.erase(item.texts.begin() + itemTexts.size(), item.texts.end());
+        else if (item.texts.size() < itemTexts.size())
+        {
+            item.texts.reserve(itemTexts.size());
+            for (std::size_t i = reusedTexts; i < itemTexts.size(); ++i)
+                item.texts.push_back(createText(itemTexts[i]));
+
+            // The new texts were given the default color
+            if ((m_selectedItems.count(index) > 0) || (m_hoveredItem == static_cast<int>(index)))
+                updateSelectedAndhoveredItemColors();
+        }
 
+        if (m_rowOrderUsed)
+        {
+            updateRowOfItem(index);
+            updateVerticalScrollbarMaximum();
+        }
+
+        invalidate();
         return true;
     }
 
@@ -357,10 +413,25 @@ namespace tgui
             return false;
 
         Item& item = m_items[index];
-        if (column >= item.texts.size())
-            item.texts.resize(column + 1);
+        if (column < item.texts.size())
+            item.texts[column].setString(itemText);
+        else
+        {
+            while (item.texts.size() <= column)
+                item.texts.push_back(createText(item.texts.size() == column ? itemText : sf::String{}));
+
+            // The new texts were given the default color
+            if ((m_selectedItems.count(index) > 0) || (m_hoveredItem == static_cast<int>(index)))
+                updateSelectedAndhoveredItemColors();
+        }
+
+        if (m_rowOrderUsed)
+        {
+            updateRowOfItem(index);
+            updateVerticalScrollbarMaximum();
+        }
 
-        item.texts[column] = createText(itemText);
+        invalidate();
         return true;
     }
 
@@ -411,25 +482,27 @@ namespace tgui
         const bool wasIconSet = m_items[index].icon.isSet();
         m_items.erase(m_items.begin() + index);
 
-        if (wasIconSet)
+        if (m_rowOrderUsed && (m_batchUpdateDepth > 0))
+            m_rowOrderUpdatePending = true;
+        else if (m_rowOrderUsed)
         {
-            --m_iconCount;
-
-            const float oldMaxIconWidth = m_maxIconWidth;
-            m_maxIconWidth = 0;
-            if (m_iconCount > 0)
+            // Remove the row of the item and let the rows below it refer to the shifted item indices
+            std::size_t rowCount = 0;
+            for (const std::size_t item : m_rowOrder)
             {
-                // Rescan all items to find the largest icon
-                for (const auto& item : m_items)
-                {
-                    if (!item.icon.isSet())
-                        continue;
-
-                    m_maxIconWidth = std::max(m_maxIconWidth, item.icon.getSize().x);
-                    if (m_maxIconWidth == oldMaxIconWidth)
-                        break;
-                }
+                if (item != index)
+                    m_rowOrder[rowCount++] = (item > index) ? item - 1 : item;
             }
+            m_rowOrder.resize(rowCount);
+
+            m_rowOfItem.assign(m_items.size(), -1);
+            updateRowsOfItems(0, m_rowOrder.size());
+        }
+
+        if (wasIconSet)
+        {
+            --m_iconCount;
+            updateMaxIconWidth();
         }
 
         updateVerticalScrollbarMaximum();
@@ -444,6 +517,8 @@ namespace tgui
         updateHoveredItem(-1);
 
         m_items.clear();
+        m_rowOrder.clear();
+        m_rowOfItem.clear();
 
         m_iconCount = 0;
         m_maxIconWidth = 0;
@@ -453,6 +528,50 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::beginBatchUpdate()
+    {
+        ++m_batchUpdateDepth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::endBatchUpdate()
+    {
+        assert(m_batchUpdateDepth > 0);
+        if (m_batchUpdateDepth == 0)
+            return;
+
+        --m_batchUpdateDepth;
+        if (m_batchUpdateDepth > 0)
+            return;
+
+        if (m_iconWidthUpdatePending)
+        {
+            m_iconWidthUpdatePending = false;
+            updateMaxIconWidth();
+        }
+
+        if (m_rowOrderUpdatePending)
+        {
+            m_rowOrderUpdatePending = false;
+            updateRowOrder();
+        }
+
+        if (m_scrollbarUpdatePending)
+        {
+            m_scrollbarUpdatePending = false;
+            updateVerticalScrollbarMaximum();
+        }
+
+        if (m_itemsAddedDuringBatch)
+        {
+            m_itemsAddedDuringBatch = false;
+            updateAfterAddingItems();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::setSelectedItem(std::size_t index)
     {
         if (index >= m_items.size())
@@ -464,10 +583,15 @@ namespace tgui
         updateSelectedItem(static_cast<int>(index));
 
         // Move the scrollbar
-        if (index * getItemHeight() < m_verticalScrollbar->getValue())
-            m_verticalScrollbar->setValue(static_cast<unsigned int>(index * getItemHeight()));
-        else if (static_cast<unsigned int>(index + 1) * getItemHeight() > m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize())
-            m_verticalScrollbar->setValue(static_cast<unsigned int>(index + 1) * getItemHeight() - m_verticalScrollbar->getViewportSize());
+        const int row = getRowOfItem(index);
+        if (row < 0)
+            return;
+
+        const std::size_t rowIndex = static_cast<std::size_t>(row);
+        if (rowIndex * getItemHeight() < m_verticalScrollbar->getValue())
+            m_verticalScrollbar->setValue(static_cast<unsigned int>(rowIndex * getItemHeight()));
+        else if (static_cast<unsigned int>(rowIndex + 1) * getItemHeight() > m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize())
+            m_verticalScrollbar->setValue(static_cast<unsigned int>(rowIndex + 1) * getItemHeight() - m_verticalScrollbar->getViewportSize());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -562,23 +686,10 @@ namespace tgui
         else if (wasIconSet)
         {
             --m_iconCount;
-
-            const float oldMaxIconWidth = m_maxIconWidth;
-            m_maxIconWidth = 0;
-            if (m_iconCount > 0)
-            {
-                // Rescan all items to find the largest icon
-                for (const auto& item : m_items)
-                {
-                    if (!item.icon.isSet())
-                        continue;
-
-                    m_maxIconWidth = std::max(m_maxIconWidth, item.icon.getSize().x);
-                    if (m_maxIconWidth == oldMaxIconWidth)
-                        break;
-                }
-            }
+            updateMaxIconWidth();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -665,6 +776,118 @@ namespace tgui
 
                 return cmp(s1, s2);
             });
+
+        if (m_rowOrderUsed)
+            updateRowOrder();
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setColumnSortType(std::size_t column, ColumnSortType type)
+    {
+        if (column >= m_columns.size())
+            return;
+
+        m_columns[column].sortType = type;
+        if (m_sortColumn == static_cast<int>(column))
+            updateRowOrder();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ListView::ColumnSortType ListView::getColumnSortType(std::size_t column) const
+    {
+        if (column < m_columns.size())
+            return m_columns[column].sortType;
+        else
+            return ColumnSortType::String;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setColumnSortComparator(std::size_t column, const std::function<bool(const sf::String&, const sf::String&)>& comparator)
+    {
+        if (column >= m_columns.size())
+            return;
+
+        m_columns[column].sortComparator = comparator;
+        setColumnSortType(column, ColumnSortType::Custom);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::sortByColumn(std::size_t column, bool ascending)
+    {
+        m_sortColumn = static_cast<int>(column);
+        m_sortAscending = ascending;
+        updateRowOrder();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::clearSorting()
+    {
+        if (m_sortColumn < 0)
+            return;
+
+        m_sortColumn = -1;
+        m_sortAscending = true;
+        updateRowOrder();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListView::getSortColumn() const
+    {
+        return m_sortColumn;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::getSortAscending() const
+    {
+        return m_sortAscending;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setSortOnHeaderClick(bool sortOnHeaderClick)
+    {
+        m_sortOnHeaderClick = sortOnHeaderClick;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::getSortOnHeaderClick() const
+    {
+        return m_sortOnHeaderClick;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setFilter(const std::function<bool(std::size_t)>& filter)
+    {
+        m_filter = filter;
+        updateRowOrder();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListView::getDisplayedItemCount() const
+    {
+        return getRowCount();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListView::getDisplayedItemIndex(std::size_t row) const
+    {
+        if (row < getRowCount())
+            return static_cast<int>(getItemAtRow(row));
+        else
+            return -1;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -746,6 +969,7 @@ namespace tgui
             column.text.setCharacterSize(headerTextSize);
 
         m_horizontalScrollbar->setScrollAmount(m_textSize);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -871,6 +1095,7 @@ namespace tgui
     void ListView::setExpandLastColumn(bool expand)
     {
         m_expandLastColumn = expand;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -947,6 +1172,7 @@ namespace tgui
     void ListView::setVerticalScrollbarValue(unsigned int value)
     {
         m_verticalScrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -961,6 +1187,7 @@ namespace tgui
     void ListView::setHorizontalScrollbarValue(unsigned int value)
     {
         m_horizontalScrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1017,13 +1244,7 @@ namespace tgui
                 if (m_lastMouseDownItem < 0)
                     m_lastMouseDownItem = m_hoveredItem;
 
-                std::set<std::size_t> selectedItems;
-                const std::size_t rangeStart = static_cast<std::size_t>(std::min(m_lastMouseDownItem, m_hoveredItem));
-                const std::size_t rangeEnd = static_cast<std::size_t>(std::max(m_lastMouseDownItem, m_hoveredItem));
-                for (std::size_t i = rangeStart; i <= rangeEnd; ++i)
-                    selectedItems.insert(i);
-
-                setSelectedItems(selectedItems);
+                setSelectedItems(getItemsBetween(m_lastMouseDownItem, m_hoveredItem));
             }
             else
             {
@@ -1073,7 +1294,17 @@ namespace tgui
                            getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(), getCurrentHeaderHeight()}.contains(pos))
             {
                 if (m_mouseOnHeaderIndex == getColumnIndexBelowMouse(pos.x))
+                {
+                    if (m_sortOnHeaderClick)
+                    {
+                        if (m_sortColumn == m_mouseOnHeaderIndex)
+                            sortByColumn(static_cast<std::size_t>(m_mouseOnHeaderIndex), !m_sortAscending);
+                        else
+                            sortByColumn(static_cast<std::size_t>(m_mouseOnHeaderIndex), true);
+                    }
+
                     onHeaderClick.emit(this, m_mouseOnHeaderIndex);
+                }
             }
 
             m_mouseOnHeaderIndex = -1;
@@ -1157,13 +1388,7 @@ namespace tgui
                                 if (m_lastMouseDownItem < 0)
                                     m_lastMouseDownItem = m_hoveredItem;
 
-                                std::set<std::size_t> selectedItems;
-                                const std::size_t rangeStart = static_cast<std::size_t>(std::min(m_lastMouseDownItem, m_hoveredItem));
-                                const std::size_t rangeEnd = static_cast<std::size_t>(std::max(m_lastMouseDownItem, m_hoveredItem));
-                                for (std::size_t i = rangeStart; i <= rangeEnd; ++i)
-                                    selectedItems.insert(i);
-
-                                setSelectedItems(selectedItems);
+                                setSelectedItems(getItemsBetween(m_lastMouseDownItem, m_hoveredItem));
                             }
                         }
                     }
@@ -1678,6 +1903,8 @@ namespace tgui
             if (m_textColorHoverCached.isSet())
                 setItemColor(m_hoveredItem, m_textColorHoverCached);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1789,6 +2016,8 @@ namespace tgui
             setItemColor(item, m_textColorHoverCached);
         else
             setItemColor(item, m_textColorCached);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1803,8 +2032,8 @@ namespace tgui
         else
             hoveredItem = static_cast<int>(std::ceil((mousePos.y + m_verticalScrollbar->getValue() - m_itemHeight + 1) / m_itemHeight));
 
-        if ((hoveredItem >= 0) && (hoveredItem < static_cast<int>(m_items.size())))
-            updateHoveredItem(hoveredItem);
+        if ((hoveredItem >= 0) && (hoveredItem < static_cast<int>(getRowCount())))
+            updateHoveredItem(static_cast<int>(getItemAtRow(static_cast<std::size_t>(hoveredItem))));
         else
             updateHoveredItem(-1);
     }
@@ -1851,6 +2080,259 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t ListView::getRowCount() const
+    {
+        return (m_rowOrderUsed && !m_rowOrderUpdatePending) ? m_rowOrder.size() : m_items.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListView::getItemAtRow(std::size_t row) const
+    {
+        return (m_rowOrderUsed && !m_rowOrderUpdatePending) ? m_rowOrder[row] : row;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListView::getRowOfItem(std::size_t item) const
+    {
+        if (!m_rowOrderUsed || m_rowOrderUpdatePending)
+            return (item < m_items.size()) ? static_cast<int>(item) : -1;
+
+        return (item < m_rowOfItem.size()) ? m_rowOfItem[item] : -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::set<std::size_t> ListView::getItemsBetween(int firstItem, int lastItem) const
+    {
+        std::set<std::size_t> items;
+
+        int firstRow = getRowOfItem(static_cast<std::size_t>(firstItem));
+        const int lastRow = getRowOfItem(static_cast<std::size_t>(lastItem));
+        if (lastRow < 0)
+            return items;
+        if (firstRow < 0)
+            firstRow = lastRow;
+
+        const std::size_t rangeStart = static_cast<std::size_t>(std::min(firstRow, lastRow));
+        const std::size_t rangeEnd = static_cast<std::size_t>(std::max(firstRow, lastRow));
+        for (std::size_t row = rangeStart; row <= rangeEnd; ++row)
+            items.insert(getItemAtRow(row));
+
+        return items;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::isItemSortedBefore(std::size_t item, std::size_t otherItem) const
+    {
+        const std::size_t column = static_cast<std::size_t>(m_sortColumn);
+        const sf::String& left = getListViewCellString(m_items[m_sortAscending ? item : otherItem], column);
+        const sf::String& right = getListViewCellString(m_items[m_sortAscending ? otherItem : item], column);
+
+        switch (getColumnSortType(column))
+        {
+        case ColumnSortType::Numeric:
+            return parseListViewNumber(left) < parseListViewNumber(right);
+        case ColumnSortType::Custom:
+            if (m_columns[column].sortComparator)
+                return m_columns[column].sortComparator(left, right);
+            break;
+        case ColumnSortType::String:
+            break;
+        }
+
+        return left < right;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateRowOrder()
+    {
+        m_rowOrderUsed = (m_sortColumn >= 0) || m_filter;
+        if (m_rowOrderUsed && (m_batchUpdateDepth > 0))
+        {
+            m_rowOrderUpdatePending = true;
+            return;
+        }
+
+        if (!m_rowOrderUsed)
+        {
+            m_rowOrder.clear();
+            m_rowOrder.shrink_to_fit();
+            m_rowOfItem.clear();
+            m_rowOfItem.shrink_to_fit();
+        }
+        else
+        {
+            m_rowOrder.clear();
+            m_rowOrder.reserve(m_items.size());
+            for (std::size_t i = 0; i < m_items.size(); ++i)
+            {
+                if (!m_filter || m_filter(i))
+                    m_rowOrder.push_back(i);
+            }
+
+            if (m_sortColumn >= 0)
+            {
+                const std::size_t column = static_cast<std::size_t>(m_sortColumn);
+                if (getColumnSortType(column) == ColumnSortType::Numeric)
+                {
+                    // Parse every number only once instead of twice in every comparison
+                    std::vector<float> numbers(m_items.size());
+                    for (const std::size_t item : m_rowOrder)
+                        numbers[item] = parseListViewNumber(getListViewCellString(m_items[item], column));
+
+                    if (m_sortAscending)
+                        std::stable_sort(m_rowOrder.begin(), m_rowOrder.end(), [&](std::size_t left, std::size_t right){ return numbers[left] < numbers[right]; });
+                    else
+                        std::stable_sort(m_rowOrder.begin(), m_rowOrder.end(), [&](std::size_t left, std::size_t right){ return numbers[right] < numbers[left]; });
+                }
+                else
+                    std::stable_sort(m_rowOrder.begin(), m_rowOrder.end(), [this](std::size_t left, std::size_t right){ return isItemSortedBefore(left, right); });
+            }
+
+            m_rowOfItem.assign(m_items.size(), -1);
+            updateRowsOfItems(0, m_rowOrder.size());
+
+            // Items that are no longer displayed can't remain selected
+            if (m_filter && !m_selectedItems.empty())
+            {
+                const std::set<std::size_t> selectedItems = m_selectedItems;
+                for (const std::size_t item : selectedItems)
+                {
+                    if (m_filter(item))
+                        continue;
+
+                    if (m_multiSelect)
+                        removeSelectedItem(item);
+                    else
+                        updateSelectedItem(-1);
+                }
+            }
+        }
+
+        // The rows have moved, so the mouse is no longer on top of the same item
+        updateHoveredItem(-1);
+        updateVerticalScrollbarMaximum();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateRowOfItem(std::size_t item, bool newItem)
+    {
+        if (m_batchUpdateDepth > 0)
+        {
+            m_rowOrderUpdatePending = true;
+            return;
+        }
+
+        // Remove the item from its old row, the rows below it move up
+        const int oldRow = newItem ? -1 : m_rowOfItem[item];
+        if (newItem)
+            m_rowOfItem.resize(m_items.size(), -1);
+        else if (oldRow >= 0)
+        {
+            m_rowOrder.erase(m_rowOrder.begin() + oldRow);
+            m_rowOfItem[item] = -1;
+        }
+
+        if (m_filter && !m_filter(item))
+        {
+            if (oldRow >= 0)
+                updateRowsOfItems(static_cast<std::size_t>(oldRow), m_rowOrder.size());
+
+            if (m_selectedItems.count(item))
+            {
+                if (m_multiSelect)
+                    removeSelectedItem(item);
+                else
+                    updateSelectedItem(-1);
+            }
+            return;
+        }
+
+        // Items with equal values are kept in the order in which they were added, like with the stable sort in updateRowOrder
+        const auto position = std::lower_bound(m_rowOrder.begin(), m_rowOrder.end(), item,
+            [this](std::size_t rowItem, std::size_t insertedItem)
+            {
+                if (m_sortColumn < 0)
+                    return rowItem < insertedItem;
+                else if (isItemSortedBefore(rowItem, insertedItem))
+                    return true;
+                else if (isItemSortedBefore(insertedItem, rowItem))
+                    return false;
+                else
+                    return rowItem < insertedItem;
+            });
+        const std::size_t newRow = static_cast<std::size_t>(position - m_rowOrder.begin());
+        m_rowOrder.insert(position, item);
+
+        // Only the rows between the old and new position of the item changed, unless the item wasn't shown before
+        if (oldRow >= 0)
+            updateRowsOfItems(std::min(newRow, static_cast<std::size_t>(oldRow)), std::max(newRow, static_cast<std::size_t>(oldRow)) + 1);
+        else
+            updateRowsOfItems(newRow, m_rowOrder.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateRowsOfItems(std::size_t firstRow, std::size_t lastRow)
+    {
+        for (std::size_t row = firstRow; row < lastRow; ++row)
+            m_rowOfItem[m_rowOrder[row]] = static_cast<int>(row);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateAfterAddingItems()
+    {
+        if (m_batchUpdateDepth > 0)
+        {
+            m_itemsAddedDuringBatch = true;
+            return;
+        }
+
+        updateVerticalScrollbarMaximum();
+
+        // Scroll down when auto-scrolling is enabled
+        if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
+            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateMaxIconWidth()
+    {
+        if (m_batchUpdateDepth > 0)
+        {
+            m_iconWidthUpdatePending = true;
+            return;
+        }
+
+        // The old maximum is still an upper bound, so the scan can stop as soon as an icon with that width is found
+        const float oldMaxIconWidth = m_maxIconWidth;
+        m_maxIconWidth = 0;
+        if (m_iconCount > 0)
+        {
+            // Rescan all items to find the largest icon
+            for (const auto& item : m_items)
+            {
+                if (!item.icon.isSet())
+                    continue;
+
+                m_maxIconWidth = std::max(m_maxIconWidth, item.icon.getSize().x);
+                if (m_maxIconWidth == oldMaxIconWidth)
+                    break;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::updateScrollbars()
     {
         const bool verticalScrollbarAtBottom = (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() >= m_verticalScrollbar->getMaximum());
@@ -1887,17 +2369,26 @@ namespace tgui
         // If the scrollbar was at the bottom then keep it at the bottom if it changes due to a different viewport size
         if (verticalScrollbarAtBottom && (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
             m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ListView::updateVerticalScrollbarMaximum()
     {
+        if (m_batchUpdateDepth > 0)
+        {
+            m_scrollbarUpdatePending = true;
+            return;
+        }
+
         const bool verticalScrollbarAtBottom = (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() >= m_verticalScrollbar->getMaximum());
 
-        unsigned int maximum = static_cast<unsigned int>(m_items.size() * m_itemHeight);
-        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
-            maximum += static_cast<unsigned int>((m_items.size() - 1) * m_gridLinesWidth);
+        const std::size_t rowCount = getRowCount();
+        unsigned int maximum = static_cast<unsigned int>(rowCount * m_itemHeight);
+        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (rowCount > 0))
+            maximum += static_cast<unsigned int>((rowCount - 1) * m_gridLinesWidth);
 
         m_verticalScrollbar->setMaximum(maximum);
         updateScrollbars();
@@ -1978,18 +2469,19 @@ namespace tgui
 
             states.transform.translate({0, (requiredItemHeight * firstItem) - static_cast<float>(m_verticalScrollbar->getValue())});
 
-            for (std::size_t i = firstItem; i < lastItem; ++i)
+            for (std::size_t row = firstItem; row < lastItem; ++row)
             {
-                if (!m_items[i].icon.isSet())
+                const Item& item = m_items[getItemAtRow(row)];
+                if (!item.icon.isSet())
                 {
                     states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                     continue;
                 }
 
-                const float verticalIconOffset = (m_itemHeight - m_items[i].icon.getSize().y) / 2.f;
+                const float verticalIconOffset = (m_itemHeight - item.icon.getSize().y) / 2.f;
 
                 states.transform.translate({textPadding, verticalIconOffset});
-                m_items[i].icon.draw(target, states);
+                item.icon.draw(target, states);
                 states.transform.translate({-textPadding, static_cast<float>(requiredItemHeight) - verticalIconOffset});
             }
 
@@ -2003,9 +2495,10 @@ namespace tgui
         const Clipping clipping{target, states, {textPadding, 0}, {columnWidth - (2 * textPadding), columnHeight}};
 
         states.transform.translate({0, (requiredItemHeight * firstItem) - static_cast<float>(m_verticalScrollbar->getValue())});
-        for (std::size_t i = firstItem; i < lastItem; ++i)
+        for (std::size_t row = firstItem; row < lastItem; ++row)
         {
-            if (column >= m_items[i].texts.size())
+            const Item& item = m_items[getItemAtRow(row)];
+            if (column >= item.texts.size())
             {
                 states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                 continue;
@@ -2015,12 +2508,12 @@ namespace tgui
             if ((column >= m_columns.size()) || (m_columns[column].alignment == ColumnAlignment::Left))
                 translateX = textPadding;
             else if (m_columns[column].alignment == ColumnAlignment::Center)
-                translateX = (columnWidth - m_items[i].texts[column].getSize().x) / 2.f;
+                translateX = (columnWidth - item.texts[column].getSize().x) / 2.f;
             else // if (m_columns[column].alignment == ColumnAlignment::Right)
-                translateX = columnWidth - textPadding - m_items[i].texts[column].getSize().x;
+                translateX = columnWidth - textPadding - item.texts[column].getSize().x;
 
             states.transform.translate({translateX, verticalTextOffset});
-            m_items[i].texts[column].draw(target, states);
+            item.texts[column].draw(target, states);
             states.transform.translate({-translateX, static_cast<float>(requiredItemHeight) - verticalTextOffset});
         }
     }
@@ -2057,15 +2550,16 @@ namespace tgui
 
         const unsigned int totalItemHeight = m_itemHeight + (m_showHorizontalGridLines ? m_gridLinesWidth : 0);
 
-        // Find out which items are visible
+        // Find out which rows are visible
+        const std::size_t rowCount = getRowCount();
         std::size_t firstItem = 0;
-        std::size_t lastItem = m_items.size();
+        std::size_t lastItem = rowCount;
         if (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum())
         {
             firstItem = m_verticalScrollbar->getValue() / totalItemHeight;
             lastItem = ((static_cast<std::size_t>(m_verticalScrollbar->getValue()) + m_verticalScrollbar->getViewportSize()) / totalItemHeight) + 1;
-            if (lastItem > m_items.size())
-                lastItem = m_items.size();
+            if (lastItem > rowCount)
+                lastItem = rowCount;
         }
 
         states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop()});
@@ -2110,7 +2604,7 @@ namespace tgui
             const Clipping clipping{target, states, {}, {availableWidth, innerHeight - totalHeaderHeight}};
 
             // Draw the horizontal grid lines
-            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
+            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (rowCount > 0))
             {
                 sf::Transform transformBeforeGridLines = states.transform;
 
@@ -2126,30 +2620,32 @@ namespace tgui
                 states.transform = transformBeforeGridLines;
             }
 
-            // Draw the background of the selected item
-            if (!m_selectedItems.empty())
+            // Draw the background of the selected items and of the item on which the mouse is standing.
+            // Only the visible rows are checked, as the rows in which the items are displayed depend on the sorting.
+            if (!m_selectedItems.empty() || ((m_hoveredItem >= 0) && m_backgroundColorHoverCached.isSet()))
             {
-                for(const std::size_t selectedItem : m_selectedItems)
+                for (std::size_t row = firstItem; row < lastItem; ++row)
                 {
-                    states.transform.translate({0, selectedItem * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
-
-                    if ((static_cast<int>(selectedItem) == m_hoveredItem) && m_selectedBackgroundColorHoverCached.isSet())
-                        drawRectangleShape(target, states, {availableWidth, static_cast<float>(m_itemHeight)}, m_selectedBackgroundColorHoverCached);
+                    const std::size_t item = getItemAtRow(row);
+                    const bool selected = (m_selectedItems.find(item) != m_selectedItems.end());
+                    const bool hovered = (static_cast<int>(item) == m_hoveredItem);
+
+                    const Color* backgroundColor = nullptr;
+                    if (selected && hovered && m_selectedBackgroundColorHoverCached.isSet())
+                        backgroundColor = &m_selectedBackgroundColorHoverCached;
+                    else if (selected)
+                        backgroundColor = &m_selectedBackgroundColorCached;
+                    else if (hovered && m_backgroundColorHoverCached.isSet())
+                        backgroundColor = &m_backgroundColorHoverCached;
                     else
-                        drawRectangleShape(target, states, {availableWidth, static_cast<float>(m_itemHeight)}, m_selectedBackgroundColorCached);
+                        continue;
 
-                    states.transform.translate({0, -static_cast<int>(selectedItem) * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
+                    states.transform.translate({0, row * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
+                    drawRectangleShape(target, states, {availableWidth, static_cast<float>(m_itemHeight)}, *backgroundColor);
+                    states.transform.translate({0, -static_cast<float>(row) * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
                 }
             }
 
-            // Draw the background of the item on which the mouse is standing
-            if ((m_hoveredItem >= 0) && (m_selectedItems.find(m_hoveredItem) == m_selectedItems.end()) && m_backgroundColorHoverCached.isSet())
-            {
-                states.transform.translate({0, m_hoveredItem * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
-                drawRectangleShape(target, states, {availableWidth, static_cast<float>(m_itemHeight)}, m_backgroundColorHoverCached);
-                states.transform.translate({0, -m_hoveredItem * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
-            }
-
             // We haven't drawn the header yet, so move back up
             states.transform.translate({0, -totalHeaderHeight});
         }
@@ -34,60 +34,108 @@ namespace tgui
 {
     namespace
     {
-        bool removeMenuImpl(const std::vector<sf::String>& hierarchy, bool removeParentsWhenEmpty, unsigned int parentIndex, std::vector<MenuBar::Menu>& menus)
+        // Menus with less items than this are searched linearly, larger menus use a hash index
+        const std::size_t minimumIndexedMenuItems = 16;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t hashMenuText(const sf::String& text)
         {
-            for (auto it = menus.begin(); it != menus.end(); ++it)
+            // FNV-1a hash of the code points
+            std::size_t hash = 2166136261u;
+            for (std::size_t i = 0; i < text.getSize(); ++i)
             {
-                if (it->text.getString() != hierarchy[parentIndex])
-                    continue;
-
-                if (parentIndex + 1 == hierarchy.size())
-                {
-                    menus.erase(it);
-                    return true;
-                }
-                else
-                {
-                    // Return false if some menu in the hierarchy couldn't be found
-                    if (!removeMenuImpl(hierarchy, removeParentsWhenEmpty, parentIndex + 1, it->menuItems))
-                        return false;
+                hash ^= static_cast<std::size_t>(text[i]);
+                hash *= 16777619u;
+            }
 
-                    // If parents don't have to be removed as well then we are done
-                    if (!removeParentsWhenEmpty)
-                        return true;
+            return hash;
+        }
 
-                    // Also delete the parent if empty
-                    if (it->menuItems.empty())
-                        menus.erase(it);
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                    return true;
-                }
+        int findMenuIndex(const std::vector<MenuBar::Menu>& menus, const sf::String& text, std::size_t textHash)
+        {
+            for (std::size_t i = 0; i < menus.size(); ++i)
+            {
+                if ((menus[i].textHash == textHash) && (menus[i].text == text))
+                    return static_cast<int>(i);
             }
 
-            // The hierarchy doesn't exist
-            return false;
+            return -1;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        bool removeSubMenusImpl(const std::vector<sf::String>& hierarchy, unsigned int parentIndex, std::vector<MenuBar::Menu>& menus)
+        int findMenuItemIndex(const MenuBar::Menu& menu, const sf::String& text)
         {
-            for (auto it = menus.begin(); it != menus.end(); ++it)
+            const std::size_t textHash = hashMenuText(text);
+            if (menu.menuItems.size() < minimumIndexedMenuItems)
+                return findMenuIndex(menu.menuItems, text, textHash);
+
+            // Add the items that were added since the last search to the index. Items are only appended to the index,
+            // so it always refers to the first item with a certain text.
+            for (std::size_t i = menu.menuItemIndexSize; i < menu.menuItems.size(); ++i)
+                menu.menuItemIndex.emplace(menu.menuItems[i].textHash, i);
+            menu.menuItemIndexSize = menu.menuItems.size();
+
+            const auto it = menu.menuItemIndex.find(textHash);
+            if (it == menu.menuItemIndex.end())
+                return -1;
+
+            if (menu.menuItems[it->second].text == text)
+                return static_cast<int>(it->second);
+
+            // The hash of a different text is the same, so we have to compare the texts themselves
+            return findMenuIndex(menu.menuItems, text, textHash);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void resetMenuItemIndex(MenuBar::Menu& menu)
+        {
+            // The index has to be rebuilt when items are removed as the indices of the items after it change
+            menu.menuItemIndex.clear();
+            menu.menuItemIndexSize = 0;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool removeMenuImpl(const std::vector<sf::String>& hierarchy, bool removeParentsWhenEmpty, unsigned int parentIndex, std::vector<MenuBar::Menu>& menus, MenuBar::Menu* parentMenu)
+        {
+            const int index = parentMenu ? findMenuItemIndex(*parentMenu, hierarchy[parentIndex]) : findMenuIndex(menus, hierarchy[parentIndex], hashMenuText(hierarchy[parentIndex]));
+            if (index < 0)
+                return false; // The hierarchy doesn't exist
+
+            const auto it = menus.begin() + index;
+            if (parentIndex + 1 == hierarchy.size())
             {
-                if (it->text.getString() != hierarchy[parentIndex])
-                    continue;
+                menus.erase(it);
+                if (parentMenu)
+                    resetMenuItemIndex(*parentMenu);
 
-                if (parentIndex + 1 == hierarchy.size())
-                {
-                    it->menuItems.clear();
+                return true;
+            }
+            else
+            {
+                // Return false if some menu in the hierarchy couldn't be found
+                if (!removeMenuImpl(hierarchy, removeParentsWhenEmpty, parentIndex + 1, it->menuItems, &*it))
+                    return false;
+
+                // If parents don't have to be removed as well then we are done
+                if (!removeParentsWhenEmpty)
                     return true;
+
+                // Also delete the parent if empty
+                if (it->menuItems.empty())
+                {
+                    menus.erase(it);
+                    if (parentMenu)
+                        resetMenuItemIndex(*parentMenu);
                 }
-                else
-                    return removeSubMenusImpl(hierarchy, parentIndex + 1, it->menuItems);
-            }
 
-            // The hierarchy doesn't exist
-            return false;
+                return true;
+            }
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -96,7 +144,10 @@ namespace tgui
         {
             for (auto& menu : menus)
             {
-                menu.text.setCharacterSize(textSize);
+                // Texts that weren't created yet will get the new size when they are created
+                if (menu.textCache)
+                    menu.textCache->setCharacterSize(textSize);
+
                 if (!menu.menuItems.empty())
                     setTextSizeImpl(menu.menuItems, textSize);
             }
@@ -111,7 +162,7 @@ namespace tgui
             for (const auto& menu : menus)
             {
                 menuElements.emplace_back(std::make_unique<MenuBar::GetAllMenusElement>());
-                menuElements.back()->text = menu.text.getString();
+                menuElements.back()->text = menu.text;
                 menuElements.back()->enabled = menu.enabled;
                 if (!menu.menuItems.empty())
                     menuElements.back()->menuItems = getAllMenusImpl(menu.menuItems);
@@ -129,7 +180,7 @@ namespace tgui
             for (const auto& menu : menus)
             {
                 TGUI_EMPLACE_BACK(element, menuElements)
-                element.text = menu.text.getString();
+                element.text = menu.text;
                 element.enabled = menu.enabled;
                 if (!menu.menuItems.empty())
                     element.menuItems = getMenuListImpl(menu.menuItems);
@@ -147,7 +198,7 @@ namespace tgui
                 auto menuNode = std::make_unique<DataIO::Node>();
                 menuNode->name = "Menu";
 
-                menuNode->propertyValuePairs["Text"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(menu.text.getString()));
+                menuNode->propertyValuePairs["Text"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(menu.text));
                 if (!menu.enabled)
                     menuNode->propertyValuePairs["Enabled"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(menu.enabled));
 
@@ -168,9 +219,9 @@ namespace tgui
                         saveMenus(menuNode, menu.menuItems);
                     else
                     {
-                        std::string itemList = "[" + Serializer::serialize(menu.menuItems[0].text.getString());
+                        std::string itemList = "[" + Serializer::serialize(menu.menuItems[0].text);
                         for (std::size_t i = 1; i < menu.menuItems.size(); ++i)
-                            itemList += ", " + Serializer::serialize(menu.menuItems[i].text.getString());
+                            itemList += ", " + Serializer::serialize(menu.menuItems[i].text);
                         itemList += "]";
 
                         menuNode->propertyValuePairs["Items"] = std::make_unique<DataIO::ValueNode>(itemList);
@@ -278,7 +329,7 @@ namespace tgui
     bool MenuBar::addMenuItem(const sf::String& text)
     {
         if (!m_menus.empty())
-            return addMenuItem(m_menus.back().text.getString(), text);
+            return addMenuItem(m_menus.back().text, text);
         else
             return false;
     }
@@ -297,7 +348,7 @@ namespace tgui
         if (hierarchy.size() < 2)
             return false;
 
-        auto* menu = findMenu(hierarchy, 0, m_menus, createParents);
+        auto* menu = findMenu(hierarchy, hierarchy.size() - 1, createParents);
         if (!menu)
             return false;
 
@@ -307,6 +358,49 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool MenuBar::addMenuItems(const std::vector<sf::String>& hierarchy, const std::vector<sf::String>& menuItems, bool createParents)
+    {
+        if (hierarchy.empty())
+            return false;
+
+        auto* menu = findMenu(hierarchy, hierarchy.size(), createParents);
+        if (!menu)
+            return false;
+
+        menu->menuItems.reserve(menu->menuItems.size() + menuItems.size());
+        for (const auto& menuItem : menuItems)
+            createMenu(menu->menuItems, menuItem);
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MenuBar::setMenuItems(const std::vector<sf::String>& hierarchy, const std::vector<sf::String>& menuItems, bool createParents)
+    {
+        if (hierarchy.empty())
+            return false;
+
+        auto* menu = findMenu(hierarchy, hierarchy.size(), createParents);
+        if (!menu)
+            return false;
+
+        // Close the open submenu, the selected item may no longer exist
+        if (menu->selectedMenuItem != -1)
+            closeSubMenus(menu->menuItems, menu->selectedMenuItem);
+
+        menu->menuItems.clear();
+        resetMenuItemIndex(*menu);
+
+        menu->menuItems.reserve(menuItems.size());
+        for (const auto& menuItem : menuItems)
+            createMenu(menu->menuItems, menuItem);
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void MenuBar::removeAllMenus()
     {
         m_menus.clear();
@@ -316,22 +410,19 @@ namespace tgui
 
     bool MenuBar::removeMenu(const sf::String& menu)
     {
-        for (std::size_t i = 0; i < m_menus.size(); ++i)
-        {
-            if (m_menus[i].text.getString() != menu)
-                continue;
-
-            m_menus.erase(m_menus.begin() + i);
+        const int index = findMenuIndex(m_menus, menu, hashMenuText(menu));
+        if (index < 0)
+            return false;
 
-            // The menu was removed, so it can't remain open
-            if (m_visibleMenu == static_cast<int>(i))
-                m_visibleMenu = -1;
+        m_menus.erase(m_menus.begin() + index);
 
-            return true;
-        }
+        // The menu was removed, so it can't remain open
+        if (m_visibleMenu == index)
+            m_visibleMenu = -1;
+        else if (m_visibleMenu > index)
+            m_visibleMenu--;
 
-        // could not find the menu
-        return false;
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -348,7 +439,7 @@ namespace tgui
         if (hierarchy.size() < 2)
             return false;
 
-        return removeMenuImpl(hierarchy, removeParentsWhenEmpty, 0, m_menus);
+        return removeMenuImpl(hierarchy, removeParentsWhenEmpty, 0, m_menus, nullptr);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -365,40 +456,44 @@ namespace tgui
         if (hierarchy.empty())
             return false;
 
-        return removeSubMenusImpl(hierarchy, 0, m_menus);
+        auto* menu = findMenu(hierarchy, hierarchy.size(), false);
+        if (!menu)
+            return false;
+
+        // Close the open submenu, the selected item no longer exists
+        if (menu->selectedMenuItem != -1)
+            closeSubMenus(menu->menuItems, menu->selectedMenuItem);
+
+        menu->menuItems.clear();
+        resetMenuItemIndex(*menu);
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool MenuBar::setMenuEnabled(const sf::String& menu, bool enabled)
     {
-        for (std::size_t i = 0; i < m_menus.size(); ++i)
-        {
-            if (m_menus[i].text.getString() != menu)
-                continue;
-
-            if (!enabled && (m_visibleMenu == static_cast<int>(i)))
-                closeMenu();
+        const int index = findMenuIndex(m_menus, menu, hashMenuText(menu));
+        if (index < 0)
+            return false;
 
-            m_menus[i].enabled = enabled;
-            updateMenuTextColor(m_menus[i], (m_visibleMenu == static_cast<int>(i)));
-            return true;
-        }
+        if (!enabled && (m_visibleMenu == index))
+            closeMenu();
 
-        return false;
+        m_menus[index].enabled = enabled;
+        updateMenuTextColor(m_menus[index], (m_visibleMenu == index));
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool MenuBar::getMenuEnabled(const sf::String& menuText) const
     {
-        for (auto& menu : m_menus)
-        {
-            if (menu.text.getString() == menuText)
-                return menu.enabled;
-        }
+        const int index = findMenuIndex(m_menus, menuText, hashMenuText(menuText));
+        if (index < 0)
+            return false;
 
-        return false;
+        return m_menus[index].enabled;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -415,25 +510,21 @@ namespace tgui
         if (hierarchy.size() < 2)
             return false;
 
-        auto* menu = findMenu(hierarchy, 0, m_menus, false);
+        auto* menu = findMenu(hierarchy, hierarchy.size() - 1, false);
         if (!menu)
             return false;
 
-        for (unsigned int j = 0; j < menu->menuItems.size(); ++j)
-        {
-            auto& menuItem = menu->menuItems[j];
-            if (menuItem.text.getString() != hierarchy.back())
-                continue;
+        const int index = findMenuItemIndex(*menu, hierarchy.back());
+        if (index < 0)
+            return false;
 
-            if (!enabled && (menu->selectedMenuItem == static_cast<int>(j)))
-                menu->selectedMenuItem = -1;
+        if (!enabled && (menu->selectedMenuItem == index))
+            menu->selectedMenuItem = -1;
 
-            menuItem.enabled = enabled;
-            updateMenuTextColor(menuItem, (menu->selectedMenuItem == static_cast<int>(j)));
-            return true;
-        }
-
-        return false;
+        auto& menuItem = menu->menuItems[index];
+        menuItem.enabled = enabled;
+        updateMenuTextColor(menuItem, (menu->selectedMenuItem == index));
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -504,9 +595,9 @@ namespace tgui
         {
             std::vector<sf::String> items;
             for (const auto& item : menu.menuItems)
-                items.push_back(item.text.getString());
+                items.push_back(item.text);
 
-            menus.emplace_back(menu.text.getString(), std::move(items));
+            menus.emplace_back(menu.text, std::move(items));
         }
 
         return menus;
@@ -545,7 +636,7 @@ namespace tgui
         {
             Vector2f menuPos = getPosition();
             for (int i = 0; i < m_visibleMenu; ++i)
-                menuPos.x += m_menus[i].text.getSize().x + (2 * m_distanceToSideCached);
+                menuPos.x += getMenuText(m_menus[i]).getSize().x + (2 * m_distanceToSideCached);
 
             if (m_invertedMenuDirection)
                 menuPos.y -= getSize().y * m_menus[m_visibleMenu].menuItems.size();
@@ -579,7 +670,7 @@ namespace tgui
             float menuWidth = 0;
             for (std::size_t i = 0; i < m_menus.size(); ++i)
             {
-                menuWidth += m_menus[i].text.getSize().x + (2 * m_distanceToSideCached);
+                menuWidth += getMenuText(m_menus[i]).getSize().x + (2 * m_distanceToSideCached);
                 if (pos.x >= menuWidth)
                     continue;
 
@@ -617,14 +708,14 @@ namespace tgui
             float menuWidth = 0;
             for (std::size_t i = 0; i < m_menus.size(); ++i)
             {
-                menuWidth += m_menus[i].text.getSize().x + (2 * m_distanceToSideCached);
+                menuWidth += getMenuText(m_menus[i]).getSize().x + (2 * m_distanceToSideCached);
                 if (pos.x >= menuWidth)
                     continue;
 
                 // If a menu is clicked that has no menu items then also emit a signal
                 if (m_menus[i].menuItems.empty())
                 {
-                    onMenuItemClick.emit(this, m_menus[i].text.getString(), std::vector<sf::String>(1, m_menus[i].text.getString()));
+                    onMenuItemClick.emit(this, m_menus[i].text, std::vector<sf::String>(1, m_menus[i].text));
                     closeMenu();
                 }
 
@@ -637,14 +728,14 @@ namespace tgui
 
         auto* menu = &m_menus[m_visibleMenu];
         std::vector<sf::String> hierarchy;
-        hierarchy.push_back(m_menus[m_visibleMenu].text.getString());
+        hierarchy.push_back(m_menus[m_visibleMenu].text);
         while (menu->selectedMenuItem != -1)
         {
             auto& menuItem = menu->menuItems[menu->selectedMenuItem];
-            hierarchy.push_back(menuItem.text.getString());
+            hierarchy.push_back(menuItem.text);
             if (menuItem.menuItems.empty())
             {
-                onMenuItemClick.emit(this, menuItem.text.getString(), hierarchy);
+                onMenuItemClick.emit(this, menuItem.text, hierarchy);
                 closeMenu();
                 break;
             }
@@ -674,7 +765,7 @@ namespace tgui
             float menuWidth = 0;
             for (std::size_t i = 0; i < m_menus.size(); ++i)
             {
-                menuWidth += m_menus[i].text.getSize().x + (2 * m_distanceToSideCached);
+                menuWidth += getMenuText(m_menus[i]).getSize().x + (2 * m_distanceToSideCached);
                 if (pos.x >= menuWidth)
                     continue;
 
@@ -713,7 +804,7 @@ namespace tgui
         {
             Vector2f menuPos = getPosition();
             for (int i = 0; i < m_visibleMenu; ++i)
-                menuPos.x += m_menus[i].text.getSize().x + (2 * m_distanceToSideCached);
+                menuPos.x += getMenuText(m_menus[i]).getSize().x + (2 * m_distanceToSideCached);
 
             if (m_invertedMenuDirection)
                 menuPos.y -= getSize().y * m_menus[m_visibleMenu].menuItems.size();
@@ -889,6 +980,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool MenuBar::isDrawnInsideBounds() const
+    {
+        return (m_visibleMenu < 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void MenuBar::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
@@ -911,7 +1009,7 @@ namespace tgui
             // Find the position of the menu
             float leftOffset = 0;
             for (int i = 0; i < m_visibleMenu; ++i)
-                leftOffset += m_menus[i].text.getSize().x + (2 * m_distanceToSideCached);
+                leftOffset += getMenuText(m_menus[i]).getSize().x + (2 * m_distanceToSideCached);
 
             // Move the menu to the left if it otherwise falls off the screen
             bool openSubMenuToRight = true;
@@ -935,58 +1033,65 @@ namespace tgui
 
     void MenuBar::createMenu(std::vector<Menu>& menus, const sf::String& text)
     {
+        // The Text object isn't created yet, that only happens when the menu becomes visible
         Menu newMenu;
-        newMenu.text.setFont(m_fontCached);
-        newMenu.text.setColor(m_textColorCached);
-        newMenu.text.setOpacity(m_opacityCached);
-        newMenu.text.setCharacterSize(m_textSize);
-        newMenu.text.setString(text);
+        newMenu.text = text;
+        newMenu.textHash = hashMenuText(text);
         menus.push_back(std::move(newMenu));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    MenuBar::Menu* MenuBar::findMenu(const std::vector<sf::String>& hierarchy, unsigned int parentIndex, std::vector<Menu>& menus, bool createParents)
+    MenuBar::Menu* MenuBar::findMenu(const std::vector<sf::String>& hierarchy, std::size_t menuDepth, bool createParents)
     {
-        for (auto& menu : menus)
+        int index = findMenuIndex(m_menus, hierarchy[0], hashMenuText(hierarchy[0]));
+        if (index < 0)
         {
-            if (menu.text.getString() != hierarchy[parentIndex])
-                continue;
+            if (!createParents)
+                return nullptr;
 
-            if (parentIndex + 2 == hierarchy.size())
-                return &menu;
-            else
-                return findMenu(hierarchy, parentIndex + 1, menu.menuItems, createParents);
+            createMenu(m_menus, hierarchy[0]);
+            index = static_cast<int>(m_menus.size() - 1);
         }
 
-        if (createParents)
+        Menu* menu = &m_menus[index];
+        for (std::size_t i = 1; i < menuDepth; ++i)
         {
-            createMenu(menus, hierarchy[parentIndex]);
-            if (parentIndex + 2 == hierarchy.size())
-                return &menus.back();
-            else
-                return findMenu(hierarchy, parentIndex + 1, menus.back().menuItems, createParents);
+            index = findMenuItemIndex(*menu, hierarchy[i]);
+            if (index < 0)
+            {
+                if (!createParents)
+                    return nullptr;
+
+                createMenu(menu->menuItems, hierarchy[i]);
+                index = static_cast<int>(menu->menuItems.size() - 1);
+            }
+
+            menu = &menu->menuItems[index];
         }
 
-        return nullptr;
+        return menu;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const MenuBar::Menu* MenuBar::findMenu(const std::vector<sf::String>& hierarchy, unsigned int parentIndex, const std::vector<Menu>& menus) const
+    const MenuBar::Menu* MenuBar::findMenu(const std::vector<sf::String>& hierarchy, std::size_t menuDepth) const
     {
-        for (auto& menu : menus)
+        int index = findMenuIndex(m_menus, hierarchy[0], hashMenuText(hierarchy[0]));
+        if (index < 0)
+            return nullptr;
+
+        const Menu* menu = &m_menus[index];
+        for (std::size_t i = 1; i < menuDepth; ++i)
         {
-            if (menu.text.getString() != hierarchy[parentIndex])
-                continue;
+            index = findMenuItemIndex(*menu, hierarchy[i]);
+            if (index < 0)
+                return nullptr;
 
-            if (parentIndex + 2 == hierarchy.size())
-                return &menu;
-            else
-                return findMenu(hierarchy, parentIndex + 1, menu.menuItems);
+            menu = &menu->menuItems[index];
         }
 
-        return nullptr;
+        return menu;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -996,19 +1101,15 @@ namespace tgui
         if (hierarchy.size() < 2)
             return nullptr;
 
-        const auto* menu = findMenu(hierarchy, 0, m_menus);
+        const auto* menu = findMenu(hierarchy, hierarchy.size() - 1);
         if (!menu)
             return nullptr;
 
-        for (auto& menuItem : menu->menuItems)
-        {
-            if (menuItem.text.getString() != hierarchy.back())
-                continue;
-
-            return &menuItem;
-        }
+        const int index = findMenuItemIndex(*menu, hierarchy.back());
+        if (index < 0)
+            return nullptr;
 
-        return nullptr;
+        return &menu->menuItems[index];
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1105,14 +1206,45 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    const Text& MenuBar::getMenuText(const Menu& menu) const
+    {
+        if (!menu.textCache)
+        {
+            menu.textCache = aurora::makeCopied<Text>();
+            menu.textCache->setFont(m_fontCached);
+            menu.textCache->setOpacity(m_opacityCached);
+            menu.textCache->setCharacterSize(m_textSize);
+            menu.textCache->setString(menu.text);
+
+            // A menu item is never selected before its text is needed, so the text gets the normal or disabled color
+            if ((!m_enabled || !menu.enabled) && m_textColorDisabledCached.isSet())
+                menu.textCache->setColor(m_textColorDisabledCached);
+            else
+                menu.textCache->setColor(m_textColorCached);
+        }
+
+        return *menu.textCache;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void MenuBar::updateMenuTextColor(Menu& menu, bool selected)
     {
+        // A text that doesn't exist yet will get the correct color when it is created
+        if (!menu.textCache)
+        {
+            if (!selected)
+                return;
+
+            getMenuText(menu);
+        }
+
         if ((!m_enabled || !menu.enabled) && m_textColorDisabledCached.isSet())
-            menu.text.setColor(m_textColorDisabledCached);
+            menu.textCache->setColor(m_textColorDisabledCached);
         else if (selected && m_selectedTextColorCached.isSet())
-            menu.text.setColor(m_selectedTextColorCached);
+            menu.textCache->setColor(m_selectedTextColorCached);
         else
-            menu.text.setColor(m_textColorCached);
+            menu.textCache->setColor(m_textColorCached);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1132,7 +1264,9 @@ namespace tgui
     {
         for (auto& menu : menus)
         {
-            menu.text.setOpacity(m_opacityCached);
+            if (menu.textCache)
+                menu.textCache->setOpacity(m_opacityCached);
+
             updateTextOpacity(menu.menuItems);
         }
     }
@@ -1143,7 +1277,9 @@ namespace tgui
     {
         for (auto& menu : menus)
         {
-            menu.text.setFont(m_fontCached);
+            if (menu.textCache)
+                menu.textCache->setFont(m_fontCached);
+
             updateTextFont(menu.menuItems);
         }
     }
@@ -1155,7 +1291,7 @@ namespace tgui
         float maxWidth = m_minimumSubMenuWidth;
         for (const auto& item : menu.menuItems)
         {
-            float width = item.text.getSize().x + (2.f * m_distanceToSideCached);
+            float width = getMenuText(item).getSize().x + (2.f * m_distanceToSideCached);
 
             // Reserve space for an arrow if there are submenus
             if (!item.menuItems.empty())
@@ -1259,7 +1395,7 @@ namespace tgui
         for (std::size_t i = 0; i < m_menus.size(); ++i)
         {
             const bool isMenuOpen = (m_visibleMenu == static_cast<int>(i));
-            const float width = m_menus[i].text.getSize().x + (2 * m_distanceToSideCached);
+            const float width = getMenuText(m_menus[i]).getSize().x + (2 * m_distanceToSideCached);
             if (backgroundSprite.isSet())
             {
                 if (isMenuOpen && m_spriteSelectedItemBackground.isSet())
@@ -1286,13 +1422,13 @@ namespace tgui
         states.transform = oldTransform;
 
         // Draw the texts
-        const float textHeight = m_menus[0].text.getSize().y;
+        const float textHeight = getMenuText(m_menus[0]).getSize().y;
         states.transform.translate({m_distanceToSideCached, (getSize().y - textHeight) / 2.f});
         for (std::size_t i = 0; i < m_menus.size(); ++i)
         {
-            m_menus[i].text.draw(target, states);
+            getMenuText(m_menus[i]).draw(target, states);
 
-            const float width = m_menus[i].text.getSize().x + (2 * m_distanceToSideCached);
+            const float width = getMenuText(m_menus[i]).getSize().x + (2 * m_distanceToSideCached);
             states.transform.translate({width, 0});
         }
     }
@@ -1345,10 +1481,10 @@ namespace tgui
         }
 
         // Draw the texts (and arrows when there are submenus)
-        states.transform.translate({m_distanceToSideCached, (getSize().y - menu.text.getSize().y) / 2.f});
+        states.transform.translate({m_distanceToSideCached, (getSize().y - getMenuText(menu).getSize().y) / 2.f});
         for (std::size_t j = 0; j < menu.menuItems.size(); ++j)
         {
-            menu.menuItems[j].text.draw(target, states);
+            getMenuText(menu.menuItems[j]).draw(target, states);
 
             // Draw an arrow next to the text if there is a submenu
             if (!menu.menuItems[j].menuItems.empty())
@@ -1357,7 +1493,7 @@ namespace tgui
                 const float arrowHeight = getSize().y / 2.f;
                 const float arrowWidth = arrowHeight / 2.f;
                 states.transform.translate({menuWidth - 2*m_distanceToSideCached - arrowWidth, // 2x m_distanceToSideCached because we already translated once
-                                            (menu.menuItems[j].text.getSize().y - arrowHeight) / 2.f});
+                                            (getMenuText(menu.menuItems[j]).getSize().y - arrowHeight) / 2.f});
 
                 sf::ConvexShape arrow{3};
                 arrow.setPoint(0, {0, 0});
@@ -182,6 +182,7 @@ namespace tgui
 
             // Recalculate the size of the front image (the size of the part that will be drawn)
             recalculateFillSize();
+            invalidate();
         }
     }
 
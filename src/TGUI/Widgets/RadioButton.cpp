@@ -153,6 +153,8 @@ namespace tgui
             m_text.setStyle(m_textStyleCheckedCached);
         else
             m_text.setStyle(m_textStyleCached);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -167,6 +169,8 @@ namespace tgui
             m_text.setCharacterSize(Text::findBestTextSize(m_fontCached, getSize().y * 0.8f));
         else
             m_text.setCharacterSize(m_textSize);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
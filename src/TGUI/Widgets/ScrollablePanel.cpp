@@ -584,8 +584,7 @@ namespace tgui
                     return toolTip;
             }
 
-            if (m_toolTip)
-                return getToolTip();
+            return getToolTip();
         }
 
         return nullptr;
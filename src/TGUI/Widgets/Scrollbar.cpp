@@ -118,6 +118,7 @@ namespace tgui
 
         // Recalculate the size and position of the thumb image
         updateSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -145,6 +146,7 @@ namespace tgui
 
             // Recalculate the size and position of the thumb image
             updateSize();
+            invalidate();
         }
     }
 
@@ -170,6 +172,7 @@ namespace tgui
 
         // Recalculate the size and position of the thumb image
         updateSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -198,6 +201,7 @@ namespace tgui
     void Scrollbar::setAutoHide(bool autoHide)
     {
         m_autoHide = autoHide;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
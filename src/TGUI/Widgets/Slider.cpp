@@ -261,6 +261,7 @@ namespace tgui
             onValueChange.emit(this, m_value);
 
             updateThumbPosition();
+            invalidate();
         }
     }
 
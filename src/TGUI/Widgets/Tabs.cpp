@@ -231,6 +231,7 @@ namespace tgui
         // Select the tab
         m_selectedTab = static_cast<int>(index);
         m_tabs[m_selectedTab].text.setColor(m_selectedTextColorCached);
+        invalidate();
 
         // Send the callback
         onTabSelect.emit(this, m_tabs[index].text.getString());
@@ -245,6 +246,7 @@ namespace tgui
         {
             m_tabs[m_selectedTab].text.setColor(m_textColorCached);
             m_selectedTab = -1;
+            invalidate();
         }
     }
 
@@ -280,6 +282,7 @@ namespace tgui
 
         // New hovered tab depends on several factors, we keep it simple and just remove the hover state
         m_hoveringTab = -1;
+        invalidate();
         return true;
     }
 
@@ -341,6 +344,7 @@ namespace tgui
 
         m_tabs[index].enabled = enabled;
         updateTextColors();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -538,6 +542,7 @@ namespace tgui
         }
 
         m_bordersCached.updateParentSize(getSize());
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
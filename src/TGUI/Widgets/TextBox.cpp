@@ -28,6 +28,7 @@
 #include <TGUI/Widgets/TextBox.hpp>
 #include <TGUI/Clipping.hpp>
 
+#include <algorithm>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -40,11 +41,6 @@ namespace tgui
     {
         m_type = "TextBox";
         m_draggableWidget = true;
-        m_textBeforeSelection.setFont(m_fontCached);
-        m_textSelection1.setFont(m_fontCached);
-        m_textSelection2.setFont(m_fontCached);
-        m_textAfterSelection1.setFont(m_fontCached);
-        m_textAfterSelection2.setFont(m_fontCached);
         m_defaultText.setFont(m_fontCached);
 
         m_horizontalScrollbar->setSize(m_horizontalScrollbar->getSize().y, m_horizontalScrollbar->getSize().x);
@@ -131,24 +127,41 @@ namespace tgui
     {
         // Remove all the excess characters when a character limit is set
         if ((m_maxChars > 0) && (text.getSize() > m_maxChars))
-            m_text = text.substring(0, m_maxChars);
+            m_textBuffer.setText(text.substring(0, m_maxChars));
         else
-            m_text = text;
+            m_textBuffer.setText(text);
+
+        m_text = sf::String{};
+        m_textOutdated = true;
 
         rearrangeText(false);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::addText(const sf::String& text)
     {
-        setText(m_text + text);
+        // Only the part of the text that fits within the character limit is added
+        const std::size_t oldSize = m_textBuffer.getSize();
+        if ((m_maxChars > 0) && (oldSize + text.getSize() > m_maxChars))
+            replaceText(oldSize, 0, text.substring(0, (oldSize < m_maxChars) ? m_maxChars - oldSize : 0));
+        else
+            replaceText(oldSize, 0, text);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     const sf::String& TextBox::getText() const
     {
+        if (m_textOutdated)
+        {
+            m_text = m_textBuffer.getText();
+            m_textOutdated = false;
+        }
+
         return m_text;
     }
 
@@ -174,7 +187,7 @@ namespace tgui
         sf::Vector2<std::size_t> selEnd = m_selEnd;
         setCaretPosition(selectionStartIndex);
         m_selEnd = selEnd;
-        updateSelectionTexts();
+        updateSelection();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -184,9 +197,9 @@ namespace tgui
         const std::size_t selStart = getSelectionStart();
         const std::size_t selEnd = getSelectionEnd();
         if (selStart <= selEnd)
-            return m_text.substring(selStart, selEnd - selStart);
+            return m_textBuffer.getSubstring(selStart, selEnd - selStart);
         else
-            return m_text.substring(selEnd, selStart - selEnd);
+            return m_textBuffer.getSubstring(selEnd, selStart - selEnd);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -213,11 +226,6 @@ namespace tgui
             m_textSize = 1;
 
         // Change the text size
-        m_textBeforeSelection.setCharacterSize(m_textSize);
-        m_textSelection1.setCharacterSize(m_textSize);
-        m_textSelection2.setCharacterSize(m_textSize);
-        m_textAfterSelection1.setCharacterSize(m_textSize);
-        m_textAfterSelection2.setCharacterSize(m_textSize);
         m_defaultText.setCharacterSize(m_textSize);
 
         // Calculate the height of one line
@@ -237,11 +245,10 @@ namespace tgui
         m_maxChars = maxChars;
 
         // If there is a character limit then check if it is exceeded
-        if ((m_maxChars > 0) && (m_text.getSize() > m_maxChars))
+        if ((m_maxChars > 0) && (m_textBuffer.getSize() > m_maxChars))
         {
             // Remove all the excess characters
-            m_text.erase(m_maxChars, sf::String::InvalidPos);
-            rearrangeText(false);
+            replaceText(m_maxChars, m_textBuffer.getSize() - m_maxChars, "");
         }
     }
 
@@ -348,29 +355,16 @@ namespace tgui
     void TextBox::setCaretPosition(std::size_t charactersBeforeCaret)
     {
         // The caret position has to stay inside the string
-        if (charactersBeforeCaret > m_text.getSize())
-            charactersBeforeCaret = m_text.getSize();
+        if (charactersBeforeCaret > m_textBuffer.getSize())
+            charactersBeforeCaret = m_textBuffer.getSize();
 
-        // Find the line and position on that line on which the caret is located
-        std::size_t count = 0;
-        for (std::size_t i = 0; i < m_lines.size(); ++i)
-        {
-            if (count + m_lines[i].getSize() < charactersBeforeCaret)
-            {
-                count += m_lines[i].getSize();
-                if ((count < m_text.getSize()) && (m_text[count] == '\n'))
-                    count += 1;
-            }
-            else
-            {
-                m_selStart.y = i;
-                m_selStart.x = charactersBeforeCaret - count;
+        if (m_lines.empty())
+            return;
 
-                m_selEnd = m_selStart;
-                updateSelectionTexts();
-                break;
-            }
-        }
+        // Find the line and position on that line on which the caret is located
+        m_selStart = getSelectionPosOfIndex(charactersBeforeCaret);
+        m_selEnd = m_selStart;
+        updateSelection();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -416,7 +410,7 @@ namespace tgui
             if (m_selStart != m_selEnd)
             {
                 m_selStart = m_selEnd;
-                updateSelectionTexts();
+                updateSelection();
             }
         }
 
@@ -508,15 +502,17 @@ namespace tgui
                 // The next click is going to be a normal one again
                 m_possibleDoubleClick = false;
 
+                const sf::String line = getLineText(m_selStart.y);
+
                 // If the click was to the right of the end of line then make sure to select the word on the left
-                if (m_lines[m_selStart.y].getSize() > 1 && (m_selStart.x == (m_lines[m_selStart.y].getSize()-1) || m_selStart.x == m_lines[m_selStart.y].getSize()))
+                if (line.getSize() > 1 && (m_selStart.x == (line.getSize()-1) || m_selStart.x == line.getSize()))
                 {
                     m_selStart.x--;
                     m_selEnd.x = m_selStart.x;
                 }
 
                 bool selectingWhitespace;
-                if (isWhitespace(m_lines[m_selStart.y][m_selStart.x]))
+                if (isWhitespace(line[m_selStart.x]))
                     selectingWhitespace = true;
                 else
                     selectingWhitespace = false;
@@ -524,7 +520,7 @@ namespace tgui
                 // Move start pointer to the beginning of the word/whitespace
                 for (std::size_t i = m_selStart.x; i > 0; --i)
                 {
-                    if (selectingWhitespace != isWhitespace(m_lines[m_selStart.y][i-1]))
+                    if (selectingWhitespace != isWhitespace(line[i-1]))
                     {
                         m_selStart.x = i;
                         break;
@@ -534,15 +530,15 @@ namespace tgui
                 }
 
                 // Move end pointer to the end of the word/whitespace
-                for (std::size_t i = m_selEnd.x; i < m_lines[m_selEnd.y].getSize(); ++i)
+                for (std::size_t i = m_selEnd.x; i < line.getSize(); ++i)
                 {
-                    if (selectingWhitespace != isWhitespace(m_lines[m_selEnd.y][i]))
+                    if (selectingWhitespace != isWhitespace(line[i]))
                     {
                         m_selEnd.x = i;
                         break;
                     }
                     else
-                        m_selEnd.x = m_lines[m_selEnd.y].getSize();
+                        m_selEnd.x = line.getSize();
                 }
             }
             else // No double clicking
@@ -557,7 +553,7 @@ namespace tgui
             }
 
             // Update the texts
-            updateSelectionTexts();
+            updateSelection();
 
             // The caret should be visible
             m_caretVisible = true;
@@ -619,7 +615,7 @@ namespace tgui
             if (caretPosition != m_selEnd)
             {
                 m_selEnd = caretPosition;
-                updateSelectionTexts();
+                updateSelection();
             }
 
             // Check if the caret is located above or below the view
@@ -682,7 +678,7 @@ namespace tgui
                 if (!event.shift)
                     m_selStart = m_selEnd;
 
-                updateSelectionTexts();
+                updateSelection();
                 break;
             }
 
@@ -693,7 +689,7 @@ namespace tgui
                 if (!event.shift)
                     m_selStart = m_selEnd;
 
-                updateSelectionTexts();
+                updateSelection();
                 break;
             }
 
@@ -706,11 +702,12 @@ namespace tgui
                     bool done = false;
                     for (std::size_t j = m_selEnd.y + 1; j > 0; --j)
                     {
+                        const sf::String line = getLineText(m_selEnd.y);
                         for (std::size_t i = m_selEnd.x; i > 0; --i)
                         {
                             if (skippedWhitespace)
                             {
-                                if (isWhitespace(m_lines[m_selEnd.y][i-1]))
+                                if (isWhitespace(line[i-1]))
                                 {
                                     m_selEnd.x = i;
                                     done = true;
@@ -719,7 +716,7 @@ namespace tgui
                             }
                             else
                             {
-                                if (!isWhitespace(m_lines[m_selEnd.y][i-1]))
+                                if (!isWhitespace(line[i-1]))
                                     skippedWhitespace = true;
                             }
                         }
@@ -731,7 +728,7 @@ namespace tgui
                                 if (m_selEnd.y > 0)
                                 {
                                     m_selEnd.y--;
-                                    m_selEnd.x = m_lines[m_selEnd.y].getSize();
+                                    m_selEnd.x = m_lines[m_selEnd.y].length;
                                 }
                             }
                             else
@@ -759,7 +756,7 @@ namespace tgui
                         if (m_selEnd.y > 0)
                         {
                             m_selEnd.y--;
-                            m_selEnd.x = m_lines[m_selEnd.y].getSize();
+                            m_selEnd.x = m_lines[m_selEnd.y].length;
                         }
                     }
                 }
@@ -767,7 +764,7 @@ namespace tgui
                 if (!event.shift)
                     m_selStart = m_selEnd;
 
-                updateSelectionTexts();
+                updateSelection();
                 break;
             }
 
@@ -780,11 +777,12 @@ namespace tgui
                     bool done = false;
                     for (std::size_t j = m_selEnd.y; j < m_lines.size(); ++j)
                     {
-                        for (std::size_t i = m_selEnd.x; i < m_lines[m_selEnd.y].getSize(); ++i)
+                        const sf::String line = getLineText(m_selEnd.y);
+                        for (std::size_t i = m_selEnd.x; i < line.getSize(); ++i)
                         {
                             if (skippedWhitespace)
                             {
-                                if (isWhitespace(m_lines[m_selEnd.y][i]))
+                                if (isWhitespace(line[i]))
                                 {
                                     m_selEnd.x = i;
                                     done = true;
@@ -793,7 +791,7 @@ namespace tgui
                             }
                             else
                             {
-                                if (!isWhitespace(m_lines[m_selEnd.y][i]))
+                                if (!isWhitespace(line[i]))
                                     skippedWhitespace = true;
                             }
                         }
@@ -810,7 +808,7 @@ namespace tgui
                             }
                             else
                             {
-                                m_selEnd.x = m_lines[m_selEnd.y].getSize();
+                                m_selEnd.x = line.getSize();
                                 break;
                             }
                         }
@@ -828,7 +826,7 @@ namespace tgui
                     else
                     {
                         // Move to the next line if you are at the end of the line
-                        if (m_selEnd.x == m_lines[m_selEnd.y].getSize())
+                        if (m_selEnd.x == m_lines[m_selEnd.y].length)
                         {
                             if (m_selEnd.y + 1 < m_lines.size())
                             {
@@ -844,7 +842,7 @@ namespace tgui
                 if (!event.shift)
                     m_selStart = m_selEnd;
 
-                updateSelectionTexts();
+                updateSelection();
                 break;
             }
 
@@ -858,21 +856,21 @@ namespace tgui
                 if (!event.shift)
                     m_selStart = m_selEnd;
 
-                updateSelectionTexts();
+                updateSelection();
                 break;
             }
 
             case sf::Keyboard::End:
             {
                 if (event.control)
-                    m_selEnd = {m_lines[m_lines.size()-1].getSize(), m_lines.size()-1};
+                    m_selEnd = {m_lines[m_lines.size()-1].length, m_lines.size()-1};
                 else
-                    m_selEnd.x = m_lines[m_selEnd.y].getSize();
+                    m_selEnd.x = m_lines[m_selEnd.y].length;
 
                 if (!event.shift)
                     m_selStart = m_selEnd;
 
-                updateSelectionTexts();
+                updateSelection();
                 break;
             }
 
@@ -896,7 +894,7 @@ namespace tgui
                 if (!event.shift)
                     m_selStart = m_selEnd;
 
-                updateSelectionTexts();
+                updateSelection();
                 break;
             }
 
@@ -917,12 +915,12 @@ namespace tgui
                         m_selEnd.y = m_selEnd.y + visibleLines - 2;
                 }
 
-                m_selEnd.x = m_lines[m_selEnd.y].getSize();
+                m_selEnd.x = m_lines[m_selEnd.y].length;
 
                 if (!event.shift)
                     m_selStart = m_selEnd;
 
-                updateSelectionTexts();
+                updateSelection();
                 break;
             }
 
@@ -946,39 +944,11 @@ namespace tgui
                 // Check that we did not select any characters
                 if (m_selStart == m_selEnd)
                 {
+                    // The caret ends up at the end of the line above when the removed character was the only one on a line
+                    // that was created by word wrap, which is where the index of the caret is mapped to
                     const std::size_t pos = getSelectionEnd();
                     if (pos > 0)
-                    {
-                        if (m_selEnd.x > 0)
-                        {
-                            // There is a specific case that we have to watch out for. When we are removing the last character on
-                            // a line which was placed there by word wrap and a newline follows this character then the caret
-                            // has to be placed at the line above (before the newline) instead of at the same line (after the newline)
-                            if ((m_lines[m_selEnd.y].getSize() == 1) && (pos > 1) && (pos < m_text.getSize()) && (m_text[pos-2] != '\n') && (m_text[pos] == '\n') && (m_selEnd.y > 0))
-                            {
-                                m_selEnd.y--;
-                                m_selEnd.x = m_lines[m_selEnd.y].getSize();
-                            }
-                            else // Just remove the character normally
-                                --m_selEnd.x;
-                        }
-                        else // At the beginning of the line
-                        {
-                            if (m_selEnd.y > 0)
-                            {
-                                --m_selEnd.y;
-                                m_selEnd.x = m_lines[m_selEnd.y].getSize();
-
-                                if ((m_text[pos-1] != '\n') && m_selEnd.x > 0)
-                                    --m_selEnd.x;
-                            }
-                        }
-
-                        m_selStart = m_selEnd;
-
-                        m_text.erase(pos - 1, 1);
-                        rearrangeText(true);
-                    }
+                        replaceText(pos - 1, 1, "");
                 }
                 else // When you did select some characters then delete them
                     deleteSelectedCharacters();
@@ -987,7 +957,8 @@ namespace tgui
                 m_caretVisible = true;
                 m_animationTimeElapsed = {};
 
-                onTextChange.emit(this, m_text);
+                if (onTextChange.isConnected())
+                    onTextChange.emit(this, getText());
                 break;
             }
 
@@ -999,13 +970,15 @@ namespace tgui
                 // Check that we did not select any characters
                 if (m_selStart == m_selEnd)
                 {
-                    m_text.erase(getSelectionEnd(), 1);
-                    rearrangeText(true);
+                    const std::size_t pos = getSelectionEnd();
+                    if (pos < m_textBuffer.getSize())
+                        replaceText(pos, 1, "");
                 }
                 else // You did select some characters, so remove them
                     deleteSelectedCharacters();
 
-                onTextChange.emit(this, m_text);
+                if (onTextChange.isConnected())
+                    onTextChange.emit(this, getText());
                 break;
             }
 
@@ -1014,8 +987,8 @@ namespace tgui
                 if (event.control && !event.alt && !event.shift && !event.system)
                 {
                     m_selStart = {0, 0};
-                    m_selEnd = sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
-                    updateSelectionTexts();
+                    m_selEnd = sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].length, m_lines.size()-1);
+                    updateSelection();
                 }
 
                 break;
@@ -1024,14 +997,8 @@ namespace tgui
             case sf::Keyboard::C:
             {
                 if (event.control && !event.alt && !event.shift && !event.system)
-                {
-                    const std::size_t selStart = getSelectionStart();
-                    const std::size_t selEnd = getSelectionEnd();
-                    if (selStart <= selEnd)
-                        Clipboard::set(m_text.substring(selStart, selEnd - selStart));
-                    else
-                        Clipboard::set(m_text.substring(selEnd, selStart - selEnd));
-                }
+                    Clipboard::set(getSelectedText());
+
                 break;
             }
 
@@ -1039,13 +1006,7 @@ namespace tgui
             {
                 if (event.control && !event.alt && !event.shift && !event.system && !m_readOnly)
                 {
-                    const std::size_t selStart = getSelectionStart();
-                    const std::size_t selEnd = getSelectionEnd();
-                    if (selStart <= selEnd)
-                        Clipboard::set(m_text.substring(selStart, selEnd - selStart));
-                    else
-                        Clipboard::set(m_text.substring(selEnd, selStart - selEnd));
-
+                    Clipboard::set(getSelectedText());
                     deleteSelectedCharacters();
                 }
                 break;
@@ -1060,16 +1021,12 @@ namespace tgui
                     // Only continue pasting if you actually have to do something
                     if ((m_selStart != m_selEnd) || (clipboardContents != ""))
                     {
-                        deleteSelectedCharacters();
+                        const std::size_t selStart = getSelectionStart();
+                        const std::size_t selEnd = getSelectionEnd();
+                        replaceText(std::min(selStart, selEnd), std::max(selStart, selEnd) - std::min(selStart, selEnd), clipboardContents);
 
-                        m_text.insert(getSelectionEnd(), clipboardContents);
-                        m_lines[m_selEnd.y].insert(m_selEnd.x, clipboardContents);
-
-                        m_selEnd.x += clipboardContents.getSize();
-                        m_selStart = m_selEnd;
-                        rearrangeText(true);
-
-                        onTextChange.emit(this, m_text);
+                        if (onTextChange.isConnected())
+                            onTextChange.emit(this, getText());
                     }
                 }
 
@@ -1093,51 +1050,37 @@ namespace tgui
             return;
 
         // Make sure we don't exceed our maximum characters limit
-        if ((m_maxChars > 0) && (m_text.getSize() + 1 > m_maxChars))
+        if ((m_maxChars > 0) && (m_textBuffer.getSize() + 1 > m_maxChars))
             return;
 
-        auto insert = TGUI_LAMBDA_CAPTURE_EQ_THIS()
-        {
-            deleteSelectedCharacters();
-
-            const std::size_t caretPosition = getSelectionEnd();
-
-            m_text.insert(caretPosition, key);
-            m_lines[m_selEnd.y].insert(m_selEnd.x, key);
-
-            // Increment the caret position, unless you type a newline at the start of a line while that line only existed due to word wrapping
-            if ((key != '\n') || (m_selEnd.x > 0) || (m_selEnd.y == 0) || m_lines[m_selEnd.y-1].isEmpty() || (m_text[caretPosition-1] == '\n'))
-            {
-                m_selStart.x++;
-                m_selEnd.x++;
-            }
-
-            rearrangeText(true);
-        };
+        // The typed character replaces the selected text
+        const std::size_t selStart = getSelectionStart();
+        const std::size_t selEnd = getSelectionEnd();
+        const std::size_t pos = std::min(selStart, selEnd);
 
         // If there is a scrollbar then inserting can't go wrong
         if (m_verticalScrollbarPolicy != Scrollbar::Policy::Never)
         {
-            insert();
+            replaceText(pos, std::max(selStart, selEnd) - pos, key);
         }
         else // There is no scrollbar, the text may not fit
         {
             // Store the data so that it can be reverted
-            sf::String oldText = m_text;
+            const sf::String oldSelectedText = getSelectedText();
             const auto oldSelStart = m_selStart;
             const auto oldSelEnd = m_selEnd;
 
             // Try to insert the character
-            insert();
+            replaceText(pos, oldSelectedText.getSize(), key);
 
             // Undo the insert if the text does not fit
             if (m_lines.size() > getInnerSize().y / m_lineHeight)
             {
-                m_text = oldText;
+                replaceText(pos, 1, oldSelectedText);
+
                 m_selStart = oldSelStart;
                 m_selEnd = oldSelEnd;
-
-                rearrangeText(true);
+                updateSelection();
             }
         }
 
@@ -1145,7 +1088,8 @@ namespace tgui
         m_caretVisible = true;
         m_animationTimeElapsed = {};
 
-        onTextChange.emit(this, m_text);
+        if (onTextChange.isConnected())
+            onTextChange.emit(this, getText());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1179,7 +1123,7 @@ namespace tgui
 
         // Don't continue when line height is 0 or when there is no font yet
         if ((m_lineHeight == 0) || (m_fontCached == nullptr))
-            return sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
+            return sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].length, m_lines.size()-1);
 
         // Find on which line the mouse is
         std::size_t lineNumber;
@@ -1200,17 +1144,19 @@ namespace tgui
 
         // Check if you clicked behind everything
         if (lineNumber + 1 > m_lines.size())
-            return sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
+            return sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].length, m_lines.size()-1);
 
         // Find between which character the mouse is standing
+        const Line line = m_lines[lineNumber];
+        const std::size_t lineStart = getLineStart(line);
         float width = Text::getExtraHorizontalPadding(m_fontCached, m_textSize) - m_horizontalScrollbar->getValue();
         std::uint32_t prevChar = 0;
-        for (std::size_t i = 0; i < m_lines[lineNumber].getSize(); ++i)
+        for (std::size_t i = 0; i < line.length; ++i)
         {
             float charWidth;
-            const std::uint32_t curChar = m_lines[lineNumber][i];
+            const std::uint32_t curChar = m_textBuffer.getCharacter(lineStart + i);
             //if (curChar == '\n')
-            //    return sf::Vector2<std::size_t>(m_lines[lineNumber].getSize() - 1, lineNumber); // TextBox strips newlines but this code is kept for when this function is generalized
+            //    return sf::Vector2<std::size_t>(line.length - 1, lineNumber); // TextBox strips newlines but this code is kept for when this function is generalized
             //else
             if (curChar == '\t')
                 charWidth = static_cast<float>(m_fontCached.getGlyph(' ', getTextSize(), false).advance) * 4;
@@ -1232,27 +1178,82 @@ namespace tgui
         }
 
         // You clicked behind the last character
-        return sf::Vector2<std::size_t>(m_lines[lineNumber].getSize(), lineNumber);
+        return sf::Vector2<std::size_t>(line.length, lineNumber);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::size_t TextBox::getIndexOfSelectionPos(sf::Vector2<std::size_t> selectionPos) const
     {
-        auto findIndex = [this](std::size_t line)
+        if (selectionPos.y >= m_lines.size())
+            return 0;
+
+        return getLineStart(m_lines[selectionPos.y]) + selectionPos.x;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2<std::size_t> TextBox::getSelectionPosOfIndex(std::size_t index) const
+    {
+        index = std::min(index, m_textBuffer.getSize());
+
+        // The position is located on the first displayed part of its line in the text that doesn't end before the index
+        const std::size_t textLine = m_textBuffer.getLineOfPosition(index);
+        const std::size_t offset = index - m_textBuffer.getLineStart(textLine);
+        std::size_t lineIndex = m_lines.findLine(textLine, offset);
+        if ((lineIndex == m_lines.size()) || (m_lines[lineIndex].textLine != textLine))
+            --lineIndex;
+
+        const Line line = m_lines[lineIndex];
+        return {std::min(offset - std::min(offset, line.offset), line.length), lineIndex};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String TextBox::getLineText(std::size_t lineIndex) const
+    {
+        return m_textBuffer.getSubstring(getLineStart(m_lines[lineIndex]), m_lines[lineIndex].length);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextBox::getLineStart(const Line& line) const
+    {
+        return m_textBuffer.getLineStart(line.textLine) + line.offset;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float TextBox::findCharacterPos(sf::Vector2<std::size_t> selectionPos) const
+    {
+        if ((m_fontCached == nullptr) || (selectionPos.y >= m_lines.size()))
+            return 0;
+
+        const Line line = m_lines[selectionPos.y];
+        const std::size_t lineStart = getLineStart(line);
+        const float whitespaceWidth = m_fontCached.getGlyph(' ', m_textSize, false).advance;
+
+        float position = 0;
+        std::uint32_t prevChar = 0;
+        for (std::size_t i = 0; i < selectionPos.x; ++i)
         {
-            std::size_t counter = 0;
-            for (std::size_t i = 0; i < line; ++i)
-            {
-                counter += m_lines[i].getSize();
-                if ((counter < m_text.getSize()) && (m_text[counter] == '\n'))
-                    counter += 1;
-            }
+            const std::uint32_t curChar = m_textBuffer.getCharacter(lineStart + i);
+            position += m_fontCached.getKerning(prevChar, curChar, m_textSize);
+            prevChar = curChar;
 
-            return counter;
-        };
+            if (curChar == ' ')
+                position += whitespaceWidth;
+            else if (curChar == '\t')
+                position += whitespaceWidth * 4;
+            else
+                position += m_fontCached.getGlyph(curChar, m_textSize, false).advance;
+        }
+
+        // The position lies in between two characters, so the kerning with the next character is included as well
+        if ((selectionPos.x > 0) && (selectionPos.x < line.length))
+            position += m_fontCached.getKerning(prevChar, m_textBuffer.getCharacter(lineStart + selectionPos.x), m_textSize);
 
-        return findIndex(selectionPos.y) + selectionPos.x;
+        return position;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1271,145 +1272,191 @@ namespace tgui
             const std::size_t selStart = getSelectionStart();
             const std::size_t selEnd = getSelectionEnd();
             if (selStart <= selEnd)
-            {
-                m_text.erase(selStart, selEnd - selStart);
-                m_selEnd = m_selStart;
-            }
+                replaceText(selStart, selEnd - selStart, "");
             else
-            {
-                m_text.erase(selEnd, selStart - selEnd);
-                m_selStart = m_selEnd;
-            }
+                replaceText(selEnd, selStart - selEnd, "");
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::replaceText(std::size_t pos, std::size_t count, const sf::String& text)
+    {
+        pos = std::min(pos, m_textBuffer.getSize());
+        count = std::min(count, m_textBuffer.getSize() - pos);
+
+        m_text = sf::String{};
+        m_textOutdated = true;
 
-            rearrangeText(true);
+        // Without a font, the lines can't be arranged yet
+        if (m_lines.empty())
+        {
+            m_textBuffer.erase(pos, count);
+            m_textBuffer.insert(pos, text);
+            rearrangeText(false);
+            return;
         }
+
+        // Find the lines in the text that contain the changed characters
+        const std::size_t firstTextLine = m_textBuffer.getLineOfPosition(pos);
+        const std::size_t lastTextLine = m_textBuffer.getLineOfPosition(pos + count);
+        const std::size_t oldTextLineCount = m_textBuffer.getLineCount();
+
+        // Find the displayed lines that belong to these lines from the text
+        const std::size_t firstLine = m_lines.findFirstLine(firstTextLine);
+        const std::size_t lastLine = m_lines.findFirstLine(lastTextLine + 1);
+
+        m_textBuffer.erase(pos, count);
+        m_textBuffer.insert(pos, text);
+
+        // Rearrange the changed lines, lines that are too long for the text box are only split when word-wrap is used
+        float maxLineWidth = 0;
+        if ((m_horizontalScrollbarPolicy == Scrollbar::Policy::Never) && (m_lineHeight != 0) && (m_fontCached != nullptr))
+            maxLineWidth = getAvailableLineWidth();
+
+        std::vector<Line> newLines;
+        const std::size_t newLastTextLine = lastTextLine + m_textBuffer.getLineCount() - oldTextLineCount;
+        for (std::size_t textLine = firstTextLine; textLine <= newLastTextLine; ++textLine)
+            arrangeLine(textLine, m_textBuffer.getLineStart(textLine), m_textBuffer.getLineLength(textLine), maxLineWidth, newLines);
+
+        // The lines behind the change don't have to be touched, even when lines were added to or removed from the text
+        m_lines.replace(firstLine, lastLine, newLines);
+
+        // Only the text objects of the changed lines have to be recreated, unless the lines behind them moved as well
+        if (newLines.size() == lastLine - firstLine)
+            invalidateVisibleLineTexts(firstLine, lastLine);
+        else
+            invalidateVisibleLineTexts(firstLine, std::numeric_limits<std::size_t>::max());
+
+        // The longest line is tracked by the list, with a monospaced font it only has to be measured when its length changed
+        if (!m_monospacedFontOptimizationEnabled || (m_lines.getMaxLength() != m_maxLineLength))
+            updateMaxLineWidth();
+
+        m_selStart = getSelectionPosOfIndex(pos + text.getSize());
+        m_selEnd = m_selStart;
+
+        if ((m_lineHeight == 0) || (m_fontCached == nullptr))
+            return;
+
+        updateAfterRearrangingText();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::rearrangeText(bool keepSelection)
     {
+        m_visibleLineTextsOutdated = true;
+
         // Don't continue when line height is 0 or when there is no font yet
         if ((m_lineHeight == 0) || (m_fontCached == nullptr))
             return;
 
-        sf::String string;
-        if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
-            string = m_text;
-        else
+        float maxLineWidth = 0;
+        if (m_horizontalScrollbarPolicy == Scrollbar::Policy::Never)
         {
-            // Find the maximum width of one line
-            const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
-            float maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
-            if (m_verticalScrollbar->isShown())
-                maxLineWidth -= m_verticalScrollbar->getSize().x;
-
             // Don't do anything when there is no room for the text
+            maxLineWidth = getAvailableLineWidth();
             if (maxLineWidth <= 0)
                 return;
-
-            string = Text::wordWrap(maxLineWidth, m_text, m_fontCached, m_textSize, false, false);
         }
 
         // Store the current selection position when we are keeping the selection
         const std::size_t selStart = keepSelection ? getSelectionStart() : 0;
         const std::size_t selEnd = keepSelection ? getSelectionEnd() : 0;
 
-        // Split the string in multiple lines
-        m_maxLineWidth = 0;
-        m_lines.clear();
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        std::size_t longestLineCharCount = 0;
-        std::size_t longestLineIndex = 0;
-        while (newLinePos != sf::String::InvalidPos)
+        // Split the text in multiple lines
+        std::vector<Line> lines;
+        std::size_t lineStart = 0;
+        const std::size_t lineCount = m_textBuffer.getLineCount();
+        for (std::size_t textLine = 0; textLine < lineCount; ++textLine)
         {
-            newLinePos = string.find('\n', searchPosStart);
-
-            if (newLinePos != sf::String::InvalidPos)
-                m_lines.push_back(string.substring(searchPosStart, newLinePos - searchPosStart));
-            else
-                m_lines.push_back(string.substring(searchPosStart));
-
-            if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
-            {
-                if (m_monospacedFontOptimizationEnabled)
-                {
-                    if (m_lines.back().getSize() > longestLineCharCount)
-                    {
-                        longestLineCharCount = m_lines.back().getSize();
-                        longestLineIndex = m_lines.size() - 1;
-                    }
-                }
-                else // Not using optimization for monospaced font, so really calculate the width of every line
-                {
-                    float lineWidth = Text::getLineWidth(m_lines.back(), m_fontCached, m_textSize);
-                    if (lineWidth > m_maxLineWidth)
-                        m_maxLineWidth = lineWidth;
-                }
-            }
-
-            searchPosStart = newLinePos + 1;
+            const std::size_t lineLength = (textLine + 1 < lineCount) ? m_textBuffer.getLineStart(textLine + 1) - 1 - lineStart : m_textBuffer.getSize() - lineStart;
+            arrangeLine(textLine, lineStart, lineLength, maxLineWidth, lines);
+            lineStart += lineLength + 1;
         }
 
-        if ((m_horizontalScrollbarPolicy != Scrollbar::Policy::Never) && m_monospacedFontOptimizationEnabled)
-            m_maxLineWidth = Text::getLineWidth(m_lines[longestLineIndex], m_fontCached, m_textSize);
+        m_lines.assign(lines);
 
         // Check if we should try to keep our selection
         if (keepSelection)
         {
-            std::size_t index = 0;
-            sf::Vector2<std::size_t> newSelStart;
-            sf::Vector2<std::size_t> newSelEnd;
-            bool newSelStartFound = false;
-            bool newSelEndFound = false;
+            m_selStart = getSelectionPosOfIndex(selStart);
+            m_selEnd = getSelectionPosOfIndex(selEnd);
+        }
+        else // Set the caret at the back of the text
+        {
+            m_selStart = sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].length, m_lines.size()-1);
+            m_selEnd = m_selStart;
+        }
 
-            // Look for the new locations of our selection
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
-            {
-                index += m_lines[i].getSize();
+        updateMaxLineWidth();
+        updateAfterRearrangingText();
+    }
 
-                if (!newSelStartFound && (index >= selStart))
-                {
-                    newSelStart = sf::Vector2<std::size_t>(m_lines[i].getSize() - (index - selStart), i);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                    newSelStartFound = true;
-                    if (newSelEndFound)
-                        break;
-                }
+    void TextBox::arrangeLine(std::size_t textLine, std::size_t start, std::size_t length, float maxLineWidth, std::vector<Line>& lines) const
+    {
+        const bool measureLine = (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never) && !m_monospacedFontOptimizationEnabled;
+        if ((maxLineWidth <= 0) || (m_fontCached == nullptr))
+        {
+            lines.push_back({textLine, 0, length, measureLine ? Text::getLineWidth(m_textBuffer.getSubstring(start, length), m_fontCached, m_textSize) : 0});
+            return;
+        }
 
-                if (!newSelEndFound && (index >= selEnd))
-                {
-                    newSelEnd = sf::Vector2<std::size_t>(m_lines[i].getSize() - (index - selEnd), i);
+        // Word-wrap only inserts newlines, so the length of every part can be found by searching for them
+        const sf::String wrappedLine = Text::wordWrap(maxLineWidth, m_textBuffer.getSubstring(start, length), m_fontCached, m_textSize, false, false);
 
-                    newSelEndFound = true;
-                    if (newSelStartFound)
-                        break;
-                }
+        std::size_t searchPosStart = 0;
+        std::size_t newLinePos = 0;
+        std::size_t offset = 0;
+        while (newLinePos != sf::String::InvalidPos)
+        {
+            newLinePos = wrappedLine.find('\n', searchPosStart);
 
-                // Skip newlines in the text
-                if (m_text[index] == '\n')
-                    ++index;
-            }
+            const std::size_t partLength = (newLinePos != sf::String::InvalidPos) ? newLinePos - searchPosStart : wrappedLine.getSize() - searchPosStart;
+            lines.push_back({textLine, offset, partLength, 0});
+            offset += partLength;
 
-            // Keep the selection when possible
-            if (newSelStartFound && newSelEndFound)
-            {
-                m_selStart = newSelStart;
-                m_selEnd = newSelEnd;
-            }
-            else // The text has changed too much, the selection can't be kept
-            {
-                m_selStart = sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
-                m_selEnd = m_selStart;
-            }
+            searchPosStart = newLinePos + 1;
         }
-        else // Set the caret at the back of the text
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float TextBox::getAvailableLineWidth() const
+    {
+        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+        float maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
+        if (m_verticalScrollbar->isShown())
+            maxLineWidth -= m_verticalScrollbar->getSize().x;
+
+        return maxLineWidth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::updateMaxLineWidth()
+    {
+        m_maxLineWidth = 0;
+        m_maxLineLength = 0;
+        if ((m_horizontalScrollbarPolicy == Scrollbar::Policy::Never) || m_lines.empty())
+            return;
+
+        if (m_monospacedFontOptimizationEnabled)
         {
-            m_selStart = sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
-            m_selEnd = m_selStart;
+            // All characters have the same width, so only the line with the most characters has to be measured
+            m_maxLineLength = m_lines.getMaxLength();
+            m_maxLineWidth = Text::getLineWidth(getLineText(m_lines.findLongestLine()), m_fontCached, m_textSize);
         }
+        else // Not using optimization for monospaced font, so the width of every line was calculated
+            m_maxLineWidth = m_lines.getMaxWidth();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBox::updateAfterRearrangingText()
+    {
         updateScrollbars();
 
         // Tell the scrollbars how many pixels the text contains
@@ -1440,7 +1487,7 @@ namespace tgui
                 updateScrollbars();
         }
 
-        updateSelectionTexts();
+        updateSelection();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1472,73 +1519,8 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextBox::updateSelectionTexts()
+    void TextBox::updateSelection()
     {
-        // If there is no selection then just put the whole text in m_textBeforeSelection
-        if (m_selStart == m_selEnd)
-        {
-            sf::String displayedText;
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
-                displayedText += m_lines[i] + "\n";
-
-            m_textBeforeSelection.setString(displayedText);
-            m_textSelection1.setString("");
-            m_textSelection2.setString("");
-            m_textAfterSelection1.setString("");
-            m_textAfterSelection2.setString("");
-        }
-        else // Some text is selected
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
-
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
-
-            // Set the text before the selection
-            if (selectionStart.y > 0)
-            {
-                sf::String string;
-                for (std::size_t i = 0; i < selectionStart.y; ++i)
-                    string += m_lines[i] + "\n";
-
-                string += m_lines[selectionStart.y].substring(0, selectionStart.x);
-                m_textBeforeSelection.setString(string);
-            }
-            else
-                m_textBeforeSelection.setString(m_lines[0].substring(0, selectionStart.x));
-
-            // Set the selected text
-            if (m_selStart.y == m_selEnd.y)
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, selectionEnd.x - selectionStart.x));
-                m_textSelection2.setString("");
-            }
-            else
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, m_lines[selectionStart.y].getSize() - selectionStart.x));
-
-                sf::String string;
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                    string += m_lines[i] + "\n";
-
-                string += m_lines[selectionEnd.y].substring(0, selectionEnd.x);
-
-                m_textSelection2.setString(string);
-            }
-
-            // Set the text after the selection
-            {
-                m_textAfterSelection1.setString(m_lines[selectionEnd.y].substring(selectionEnd.x, m_lines[selectionEnd.y].getSize() - selectionEnd.x));
-
-                sf::String string;
-                for (std::size_t i = selectionEnd.y + 1; i < m_lines.size(); ++i)
-                    string += m_lines[i] + "\n";
-
-                m_textAfterSelection2.setString(string);
-            }
-        }
-
         // Check if the caret is located above or below the view
         if (m_verticalScrollbarPolicy != Scrollbar::Policy::Never)
         {
@@ -1552,16 +1534,7 @@ namespace tgui
         }
 
         // Position the caret
-        {
-            const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
-            sf::Text tempText{m_lines[m_selEnd.y].substring(0, m_selEnd.x), *m_fontCached.getFont(), getTextSize()};
-
-            float kerning = 0;
-            if ((m_selEnd.x > 0) && (m_selEnd.x < m_lines[m_selEnd.y].getSize()))
-                kerning = m_fontCached.getKerning(m_lines[m_selEnd.y][m_selEnd.x - 1], m_lines[m_selEnd.y][m_selEnd.x], m_textSize);
-
-            m_caretPosition = {textOffset + tempText.findCharacterPos(tempText.getString().getSize()).x + kerning, static_cast<float>(m_selEnd.y * m_lineHeight)};
-        }
+        m_caretPosition = {Text::getExtraHorizontalPadding(m_fontCached, m_textSize) + findCharacterPos(m_selEnd), static_cast<float>(m_selEnd.y * m_lineHeight)};
 
         if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
         {
@@ -1621,7 +1594,14 @@ namespace tgui
 
             // Too slow for double clicking
             m_possibleDoubleClick = false;
+
+            // The caret is only drawn while the widget is focused
+            if (m_focused)
+                invalidate();
         }
+
+        if (m_focused)
+            requestWakeup(sf::milliseconds(500) - m_animationTimeElapsed);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1631,91 +1611,7 @@ namespace tgui
         if (!m_fontCached)
             return;
 
-        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
-
-        // Calculate the position of the text objects
-        m_selectionRects.clear();
-        m_textBeforeSelection.setPosition({textOffset, 0});
-        m_defaultText.setPosition({ textOffset, 0 });
-
-        if (m_selStart != m_selEnd)
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
-
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
-
-            float kerningSelectionStart = 0;
-            if ((selectionStart.x > 0) && (selectionStart.x < m_lines[selectionStart.y].getSize()))
-                kerningSelectionStart = m_fontCached.getKerning(m_lines[selectionStart.y][selectionStart.x-1], m_lines[selectionStart.y][selectionStart.x], m_textSize);
-
-            float kerningSelectionEnd = 0;
-            if ((selectionEnd.x > 0) && (selectionEnd.x < m_lines[selectionEnd.y].getSize()))
-                kerningSelectionEnd = m_fontCached.getKerning(m_lines[selectionEnd.y][selectionEnd.x-1], m_lines[selectionEnd.y][selectionEnd.x], m_textSize);
-
-            if (selectionStart.x > 0)
-            {
-                m_textSelection1.setPosition({textOffset + m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().getSize()).x + kerningSelectionStart,
-                                              m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
-            }
-            else
-                m_textSelection1.setPosition({textOffset, m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
-
-            m_textSelection2.setPosition({textOffset, static_cast<float>((selectionStart.y + 1) * m_lineHeight)});
-
-            if (!m_textSelection2.getString().isEmpty() || (selectionEnd.x == 0))
-            {
-                m_textAfterSelection1.setPosition({textOffset + m_textSelection2.findCharacterPos(m_textSelection2.getString().getSize()).x + kerningSelectionEnd,
-                                                   m_textSelection2.getPosition().y + ((selectionEnd.y - selectionStart.y - 1) * m_lineHeight)});
-            }
-            else
-                m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x + kerningSelectionEnd,
-                                                   m_textSelection1.getPosition().y});
-
-            m_textAfterSelection2.setPosition({textOffset, static_cast<float>((selectionEnd.y + 1) * m_lineHeight)});
-
-            // Recalculate the selection rectangles
-            {
-                m_selectionRects.push_back({m_textSelection1.getPosition().x, static_cast<float>(selectionStart.y * m_lineHeight), 0, static_cast<float>(m_lineHeight)});
-
-                if (!m_lines[selectionStart.y].isEmpty())
-                {
-                    m_selectionRects.back().width = m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x;
-
-                    // There is kerning when the selection is on just this line
-                    if (selectionStart.y == selectionEnd.y)
-                        m_selectionRects.back().width += kerningSelectionEnd;
-                }
-
-                sf::Text tempText{"", *m_fontCached.getFont(), getTextSize()};
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                {
-                    m_selectionRects.back().width += textOffset;
-                    m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(i * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
-
-                    if (!m_lines[i].isEmpty())
-                    {
-                        tempText.setString(m_lines[i]);
-                        m_selectionRects.back().width += tempText.findCharacterPos(tempText.getString().getSize()).x;
-                    }
-                }
-
-                if (selectionStart.y != selectionEnd.y)
-                {
-                    m_selectionRects.back().width += textOffset;
-
-                    if (m_textSelection2.getString() != "")
-                    {
-                        tempText.setString(m_lines[selectionEnd.y].substring(0, selectionEnd.x));
-                        m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(selectionEnd.y * m_lineHeight),
-                                                    textOffset + tempText.findCharacterPos(tempText.getString().getSize()).x + kerningSelectionEnd, static_cast<float>(m_lineHeight)});
-                    }
-                    else
-                        m_selectionRects.push_back({0, static_cast<float>(selectionEnd.y * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
-                }
-            }
-        }
+        m_defaultText.setPosition({Text::getExtraHorizontalPadding(m_fontCached, m_textSize), 0});
 
         recalculateVisibleLines();
     }
@@ -1756,6 +1652,52 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBox::updateVisibleLineTexts(std::size_t firstLine, std::size_t lastLine) const
+    {
+        // The slots can only be reused when their amount doesn't change, otherwise lines would end up in a different slot
+        if (m_visibleLineTexts.size() < lastLine - firstLine)
+        {
+            m_visibleLineTexts.resize(lastLine - firstLine);
+            m_visibleLineTextsOutdated = true;
+        }
+
+        if (m_visibleLineTextsOutdated)
+        {
+            for (auto& lineText : m_visibleLineTexts)
+                lineText.line = std::numeric_limits<std::size_t>::max();
+
+            m_visibleLineTextsOutdated = false;
+        }
+
+        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+        for (std::size_t i = firstLine; i < lastLine; ++i)
+        {
+            VisibleLineText& lineText = m_visibleLineTexts[i % m_visibleLineTexts.size()];
+            if (lineText.line == i)
+                continue;
+
+            lineText.line = i;
+            lineText.text.setFont(m_fontCached);
+            lineText.text.setCharacterSize(m_textSize);
+            lineText.text.setOpacity(m_opacityCached);
+            lineText.text.setString(getLineText(i));
+            lineText.text.setPosition({textOffset, static_cast<float>(i * m_lineHeight)});
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::invalidateVisibleLineTexts(std::size_t firstLine, std::size_t lastLine)
+    {
+        for (auto& lineText : m_visibleLineTexts)
+        {
+            if ((lineText.line >= firstLine) && (lineText.line < lastLine))
+                lineText.line = std::numeric_limits<std::size_t>::max();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Signal& TextBox::getSignal(std::string signalName)
     {
         if (signalName == toLower(onTextChange.getName()))
@@ -1782,14 +1724,11 @@ namespace tgui
         }
         else if (property == "textcolor")
         {
-            m_textBeforeSelection.setColor(getSharedRenderer()->getTextColor());
-            m_textAfterSelection1.setColor(getSharedRenderer()->getTextColor());
-            m_textAfterSelection2.setColor(getSharedRenderer()->getTextColor());
+            m_textColorCached = getSharedRenderer()->getTextColor();
         }
         else if (property == "selectedtextcolor")
         {
-            m_textSelection1.setColor(getSharedRenderer()->getSelectedTextColor());
-            m_textSelection2.setColor(getSharedRenderer()->getSelectedTextColor());
+            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
         }
         else if (property == "defaulttextcolor")
         {
@@ -1846,22 +1785,13 @@ namespace tgui
             m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
             m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
             m_spriteBackground.setOpacity(m_opacityCached);
-            m_textBeforeSelection.setOpacity(m_opacityCached);
-            m_textAfterSelection1.setOpacity(m_opacityCached);
-            m_textAfterSelection2.setOpacity(m_opacityCached);
-            m_textSelection1.setOpacity(m_opacityCached);
-            m_textSelection2.setOpacity(m_opacityCached);
             m_defaultText.setOpacity(m_opacityCached);
+            m_visibleLineTextsOutdated = true;
         }
         else if (property == "font")
         {
             Widget::rendererChanged(property);
 
-            m_textBeforeSelection.setFont(m_fontCached);
-            m_textSelection1.setFont(m_fontCached);
-            m_textSelection2.setFont(m_fontCached);
-            m_textAfterSelection1.setFont(m_fontCached);
-            m_textAfterSelection2.setFont(m_fontCached);
             m_defaultText.setFont(m_fontCached);
             setTextSize(getTextSize());
         }
@@ -1997,28 +1927,87 @@ namespace tgui
             // Move the text according to the scrollars
             states.transform.translate({-static_cast<float>(m_horizontalScrollbar->getValue()), -static_cast<float>(m_verticalScrollbar->getValue())});
 
-            // Draw the background of the selected text
-            for (const auto& selectionRect : m_selectionRects)
-            {
-                states.transform.translate({selectionRect.left, selectionRect.top});
-                drawRectangleShape(target, states, {selectionRect.width, selectionRect.height + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize)}, m_selectedTextBackgroundColorCached);
-                states.transform.translate({-selectionRect.left, -selectionRect.top});
-            }
-
             // Draw the text
-            if (m_text.isEmpty())
-            {
+            if (m_textBuffer.isEmpty())
                 m_defaultText.draw(target, states);
-            }
-            else
+            else if (m_lineHeight > 0)
             {
-                m_textBeforeSelection.draw(target, states);
-                if (m_selStart != m_selEnd)
+                // Only the lines that lie inside the clipping area are drawn
+                const unsigned int top = m_verticalScrollbar->getValue();
+                const std::size_t firstLine = std::min<std::size_t>(top / m_lineHeight, m_lines.size());
+                const std::size_t lastLine = std::min<std::size_t>(static_cast<std::size_t>(std::ceil((top + std::max(0.f, clipHeight)) / m_lineHeight)) + 1, m_lines.size());
+                updateVisibleLineTexts(firstLine, lastLine);
+
+                auto selectionStart = m_selStart;
+                auto selectionEnd = m_selEnd;
+                if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
+                    std::swap(selectionStart, selectionEnd);
+
+                const std::size_t firstSelectedLine = (m_selStart != m_selEnd) ? std::max(selectionStart.y, firstLine) : lastLine;
+                const std::size_t lastSelectedLine = (m_selStart != m_selEnd) ? std::min(selectionEnd.y + 1, lastLine) : lastLine;
+
+                // Selected lines that continue on the next line also include the space where the newline would be
+                const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+                auto getSelectionLeft = [&](std::size_t line){
+                    return (line == selectionStart.y) ? textOffset + findCharacterPos(selectionStart) : 0;
+                };
+                auto getSelectionRight = [&](std::size_t line, const Text& text){
+                    if (line == selectionEnd.y)
+                        return textOffset + findCharacterPos(selectionEnd);
+                    else
+                        return (textOffset * 2) + text.findCharacterPos(text.getString().getSize()).x;
+                };
+
+                // Draw the background of the selected text
+                const float selectionHeight = m_lineHeight + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize);
+                for (std::size_t i = firstSelectedLine; i < lastSelectedLine; ++i)
+                {
+                    const float left = getSelectionLeft(i);
+                    const float right = getSelectionRight(i, m_visibleLineTexts[i % m_visibleLineTexts.size()].text);
+
+                    sf::RenderStates selectionStates = states;
+                    selectionStates.transform.translate({left, static_cast<float>(i * m_lineHeight)});
+                    drawRectangleShape(target, selectionStates, {right - left, selectionHeight}, m_selectedTextBackgroundColorCached);
+                }
+
+                // Draw the lines. Lines that are only partially selected are drawn in parts that are clipped to the selection.
+                const float visibleLeft = static_cast<float>(m_horizontalScrollbar->getValue());
+                const float visibleRight = visibleLeft + clipWidth;
+                for (std::size_t i = firstLine; i < lastLine; ++i)
                 {
-                    m_textSelection1.draw(target, states);
-                    m_textSelection2.draw(target, states);
-                    m_textAfterSelection1.draw(target, states);
-                    m_textAfterSelection2.draw(target, states);
+                    Text& text = m_visibleLineTexts[i % m_visibleLineTexts.size()].text;
+                    if ((i < firstSelectedLine) || (i >= lastSelectedLine))
+                    {
+                        text.setColor(m_textColorCached);
+                        text.draw(target, states);
+                    }
+                    else if ((i != selectionStart.y) && (i != selectionEnd.y))
+                    {
+                        text.setColor(m_selectedTextColorCached);
+                        text.draw(target, states);
+                    }
+                    else
+                    {
+                        const float lineTop = static_cast<float>(i * m_lineHeight);
+                        const float left = getSelectionLeft(i);
+                        const float right = getSelectionRight(i, text);
+
+                        text.setColor(m_textColorCached);
+                        if (left > visibleLeft)
+                        {
+                            const Clipping clippingBeforeSelection{target, states, {visibleLeft, lineTop}, {left - visibleLeft, selectionHeight}};
+                            text.draw(target, states);
+                        }
+                        if (right < visibleRight)
+                        {
+                            const Clipping clippingAfterSelection{target, states, {right, lineTop}, {visibleRight - right, selectionHeight}};
+                            text.draw(target, states);
+                        }
+
+                        text.setColor(m_selectedTextColorCached);
+                        const Clipping clippingSelection{target, states, {left, lineTop}, {right - left, selectionHeight}};
+                        text.draw(target, states);
+                    }
                 }
             }
 
@@ -0,0 +1,83 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "AllocationCounter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<bool> countAllocations{false};
+    std::atomic<std::size_t> allocationCount{0};
+    std::atomic<std::size_t> allocatedBytes{0};
+}
+
+void* operator new(std::size_t size)
+{
+    if (countAllocations)
+    {
+        ++allocationCount;
+        allocatedBytes += size;
+    }
+
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void startCountingAllocations()
+{
+    allocationCount = 0;
+    allocatedBytes = 0;
+    countAllocations = true;
+}
+
+void stopCountingAllocations()
+{
+    countAllocations = false;
+}
+
+std::size_t getAllocationCount()
+{
+    return allocationCount;
+}
+
+std::size_t getAllocatedBytes()
+{
+    return allocatedBytes;
+}
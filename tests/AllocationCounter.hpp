@@ -0,0 +1,39 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_TESTS_ALLOCATION_COUNTER_HPP
+#define TGUI_TESTS_ALLOCATION_COUNTER_HPP
+
+#include <cstddef>
+
+// The tests-memory executable replaces the global allocation functions to count the allocations that are made between a
+// call to startCountingAllocations and stopCountingAllocations. These functions aren't available in the other tests.
+void startCountingAllocations();
+void stopCountingAllocations();
+
+std::size_t getAllocationCount();
+std::size_t getAllocatedBytes();
+
+#endif // TGUI_TESTS_ALLOCATION_COUNTER_HPP
@@ -0,0 +1,138 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include "AllocationCounter.hpp"
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/TextBox.hpp>
+#include <TGUI/AnimationManager.hpp>
+
+TEST_CASE("[TextBox] Selecting text with the mouse doesn't allocate")
+{
+    sf::RenderTexture target;
+    target.create(270, 160);
+    tgui::Gui gui{target};
+
+    auto textBox = tgui::TextBox::create();
+    textBox->setPosition(10, 5);
+    textBox->setSize(250, 150);
+    textBox->setTextSize(16);
+    textBox->setText("Cupcake ipsum dolor sit.\nAmet candy canes.\nPowder donut sugar plum.\nCaramels cupcake icing.");
+    textBox->setVerticalScrollbarValue(0);
+    gui.add(textBox);
+
+    // Move over all lines once first, so that the text objects of the lines and the glyphs of the font are created
+    const std::vector<sf::Vector2f> mousePositions = {{40, 10}, {120, 30}, {60, 50}, {200, 70}, {20, 30}, {90, 10}};
+    textBox->leftMousePressed({3, 3});
+    for (const auto& position : mousePositions)
+        textBox->mouseMoved(position);
+    gui.draw();
+
+    startCountingAllocations();
+    for (const auto& position : mousePositions)
+    {
+        textBox->mouseMoved(position);
+        gui.draw();
+    }
+    stopCountingAllocations();
+
+    textBox->leftMouseReleased({90, 10});
+    REQUIRE(textBox->getSelectedText() != "");
+    REQUIRE(getAllocationCount() == 0);
+}
+
+TEST_CASE("[Button] Hovering over buttons doesn't allocate")
+{
+    sf::RenderTexture target;
+    target.create(200, 220);
+    tgui::Gui gui{target};
+
+    for (unsigned int i = 0; i < 10; ++i)
+    {
+        auto button = tgui::Button::create("Button " + tgui::to_string(i));
+        button->setPosition(10, 20.f * i + 10);
+        button->setSize(180, 20);
+        gui.add(button);
+    }
+
+    auto moveMouse = [&gui](int x, int y){
+        sf::Event event;
+        event.type = sf::Event::MouseMoved;
+        event.mouseMove.x = x;
+        event.mouseMove.y = y;
+        gui.handleEvent(event);
+    };
+
+    // Hover over every button once first, so that the vertices of the texts and the glyphs of the font are created
+    for (int y = 0; y < 220; y += 5)
+    {
+        moveMouse(100, y);
+        gui.draw();
+    }
+
+    // Moving the mouse only changes the colors of the buttons and their texts
+    startCountingAllocations();
+    for (unsigned int i = 0; i < 10; ++i)
+    {
+        for (int y = 0; y < 220; y += 5)
+        {
+            moveMouse(100, y);
+            gui.draw();
+        }
+    }
+    stopCountingAllocations();
+
+    REQUIRE(getAllocationCount() == 0);
+}
+
+TEST_CASE("[AnimationManager] Animating widgets doesn't allocate")
+{
+    tgui::AnimationManager manager;
+    auto panel1 = tgui::Panel::create();
+    auto panel2 = tgui::Panel::create();
+
+    // The first animations create the arrays, which keep their capacity when the animations finish
+    manager.animatePosition(panel1, {100, 0}, sf::milliseconds(100));
+    manager.animatePosition(panel2, {100, 0}, sf::milliseconds(100));
+    manager.update(sf::milliseconds(100));
+    REQUIRE(manager.getAnimationCount() == 0);
+
+    startCountingAllocations();
+    for (unsigned int i = 0; i < 10; ++i)
+    {
+        manager.animatePosition(panel1, {static_cast<float>(i), 50}, sf::milliseconds(100));
+        manager.animatePosition(panel2, {50, static_cast<float>(i)}, sf::milliseconds(50));
+        manager.update(sf::milliseconds(50));
+        manager.stop(panel2);
+        manager.animatePosition(panel2, {0, 0}, sf::milliseconds(100));
+        manager.update(sf::milliseconds(50));
+        manager.finish(panel2);
+    }
+    stopCountingAllocations();
+
+    REQUIRE(!manager.isAnimating(panel1));
+    REQUIRE(panel1->getPosition() == sf::Vector2f{9, 50});
+    REQUIRE(getAllocationCount() == 0);
+}
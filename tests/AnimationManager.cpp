@@ -0,0 +1,221 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/AnimationManager.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+
+TEST_CASE("[AnimationManager]")
+{
+    tgui::AnimationManager manager;
+    REQUIRE(manager.getAnimationCount() == 0);
+    REQUIRE(!manager.update(sf::milliseconds(100)));
+
+    auto button = tgui::Button::create();
+    button->setPosition(10, 20);
+    button->setSize(100, 40);
+
+    SECTION("Easing")
+    {
+        for (const auto easing : {tgui::Easing::Linear, tgui::Easing::EaseIn, tgui::Easing::EaseOut,
+                                  tgui::Easing::EaseInOut, tgui::Easing::EaseOutBack})
+        {
+            REQUIRE(tgui::compareFloats(tgui::AnimationManager::ease(easing, 0), 0));
+            REQUIRE(tgui::compareFloats(tgui::AnimationManager::ease(easing, 1), 1));
+        }
+
+        REQUIRE(tgui::compareFloats(tgui::AnimationManager::ease(tgui::Easing::Linear, 0.25f), 0.25f));
+        REQUIRE(tgui::compareFloats(tgui::AnimationManager::ease(tgui::Easing::EaseInOut, 0.5f), 0.5f));
+        REQUIRE(tgui::AnimationManager::ease(tgui::Easing::EaseIn, 0.5f) < 0.5f);
+        REQUIRE(tgui::AnimationManager::ease(tgui::Easing::EaseOut, 0.5f) > 0.5f);
+        REQUIRE(tgui::AnimationManager::ease(tgui::Easing::EaseOutBack, 0.8f) > 1);
+    }
+
+    SECTION("Position and size")
+    {
+        manager.animatePosition(button, {110, 220}, sf::milliseconds(400));
+        manager.animateSize(button, {200, 80}, sf::milliseconds(200));
+        REQUIRE(manager.getAnimationCount() == 2);
+        REQUIRE(manager.isAnimating(button));
+
+        REQUIRE(manager.update(sf::milliseconds(100)));
+        REQUIRE(button->getPosition() == sf::Vector2f(35, 70));
+        REQUIRE(button->getSize() == sf::Vector2f(150, 60));
+
+        // The size animation finishes first
+        REQUIRE(manager.update(sf::milliseconds(100)));
+        REQUIRE(button->getSize() == sf::Vector2f(200, 80));
+        REQUIRE(manager.getAnimationCount() == 1);
+
+        REQUIRE(!manager.update(sf::milliseconds(500)));
+        REQUIRE(button->getPosition() == sf::Vector2f(110, 220));
+        REQUIRE(!manager.isAnimating(button));
+    }
+
+    SECTION("Opacity and color")
+    {
+        button->getRenderer()->setBackgroundColor(sf::Color(0, 100, 200));
+        manager.animateOpacity(button, 0.5f, sf::milliseconds(100));
+        manager.animateColor(button, "BackgroundColor", sf::Color(100, 200, 0), sf::milliseconds(100));
+
+        manager.update(sf::milliseconds(50));
+        REQUIRE(tgui::compareFloats(button->getInheritedOpacity(), 0.75f));
+        REQUIRE(button->getRenderer()->getBackgroundColor() == sf::Color(50, 150, 100));
+
+        manager.update(sf::milliseconds(50));
+        REQUIRE(tgui::compareFloats(button->getInheritedOpacity(), 0.5f));
+        REQUIRE(button->getRenderer()->getBackgroundColor() == sf::Color(100, 200, 0));
+    }
+
+    SECTION("Replacing an animation")
+    {
+        manager.animatePosition(button, {110, 20}, sf::milliseconds(100));
+        manager.update(sf::milliseconds(50));
+        REQUIRE(button->getPosition() == sf::Vector2f(60, 20));
+
+        // The new animation continues from the current position
+        manager.animatePosition(button, {60, 120}, sf::milliseconds(100));
+        REQUIRE(manager.getAnimationCount() == 1);
+        manager.update(sf::milliseconds(50));
+        REQUIRE(button->getPosition() == sf::Vector2f(60, 70));
+    }
+
+    SECTION("Stop and finish")
+    {
+        auto button2 = tgui::Button::create();
+        manager.animatePosition(button, {110, 20}, sf::milliseconds(100));
+        manager.animatePosition(button2, {50, 50}, sf::milliseconds(100));
+        manager.animateSize(button, {200, 40}, sf::milliseconds(100));
+        REQUIRE(manager.getAnimationCount() == 3);
+
+        manager.update(sf::milliseconds(50));
+        manager.stop(button);
+        REQUIRE(manager.getAnimationCount() == 1);
+        REQUIRE(button->getPosition() == sf::Vector2f(60, 20));
+        REQUIRE(button->getSize() == sf::Vector2f(150, 40));
+
+        manager.finish(button2);
+        REQUIRE(manager.getAnimationCount() == 0);
+        REQUIRE(button2->getPosition() == sf::Vector2f(50, 50));
+
+        manager.animateSize(button2, {10, 10}, sf::milliseconds(100));
+        manager.stopAll();
+        REQUIRE(manager.getAnimationCount() == 0);
+    }
+
+    SECTION("Signals are emitted once per frame")
+    {
+        unsigned int positionChangeCount = 0;
+        unsigned int sizeChangeCount = 0;
+        button->onPositionChange.connect([&]{ positionChangeCount++; });
+        button->onSizeChange.connect([&]{ sizeChangeCount++; });
+
+        manager.animatePosition(button, {110, 20}, sf::milliseconds(100));
+        manager.animateSize(button, {200, 40}, sf::milliseconds(100));
+        manager.update(sf::milliseconds(25));
+        manager.update(sf::milliseconds(25));
+        REQUIRE(positionChangeCount == 2);
+        REQUIRE(sizeChangeCount == 2);
+    }
+
+    SECTION("Starting and stopping animations from a signal handler")
+    {
+        auto button2 = tgui::Button::create();
+        auto button3 = tgui::Button::create();
+        button->onPositionChange.connect([&]{
+            manager.stop(button2);
+            manager.animateSize(button3, {60, 60}, sf::milliseconds(100));
+        });
+
+        manager.animatePosition(button, {110, 20}, sf::milliseconds(100));
+        manager.animatePosition(button2, {50, 50}, sf::milliseconds(100));
+        manager.update(sf::milliseconds(50));
+        REQUIRE(button->getPosition() == sf::Vector2f(60, 20));
+        REQUIRE(button2->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(!manager.isAnimating(button2));
+        REQUIRE(manager.isAnimating(button3));
+        REQUIRE(manager.getAnimationCount() == 2);
+
+        // The animation of the position ends and the size animation restarts while the arrays are being updated
+        manager.update(sf::milliseconds(50));
+        REQUIRE(button->getPosition() == sf::Vector2f(110, 20));
+        REQUIRE(manager.getAnimationCount() == 1);
+        REQUIRE(manager.isAnimating(button3));
+
+        manager.finish(button3);
+        REQUIRE(button3->getSize() == sf::Vector2f(60, 60));
+        REQUIRE(manager.getAnimationCount() == 0);
+    }
+
+    SECTION("Gui")
+    {
+        tgui::Gui gui;
+        auto panel = tgui::Panel::create();
+        panel->add(button);
+        gui.add(panel);
+
+        gui.getAnimationManager().animatePosition(button, {110, 20}, sf::milliseconds(100));
+        gui.updateTime(sf::milliseconds(50));
+        REQUIRE(button->getPosition() == sf::Vector2f(60, 20));
+        REQUIRE(gui.needsRedraw());
+        REQUIRE(gui.getNextWakeupTime() == sf::Time::Zero);
+
+        gui.updateTime(sf::milliseconds(50));
+        REQUIRE(button->getPosition() == sf::Vector2f(110, 20));
+        REQUIRE(gui.getAnimationManager().getAnimationCount() == 0);
+    }
+}
+
+TEST_CASE("[AnimationManager] Animating many widgets", "[.benchmark]")
+{
+    const unsigned int widgetCount = 5000;
+    const unsigned int frames = 100;
+
+    tgui::Gui gui;
+    std::vector<tgui::Button::Ptr> buttons;
+    for (unsigned int i = 0; i < widgetCount; ++i)
+    {
+        buttons.push_back(tgui::Button::create());
+        gui.add(buttons.back());
+    }
+
+    tgui::AnimationManager& manager = gui.getAnimationManager();
+    manager.reserve(widgetCount * 3);
+
+    sf::Clock clock;
+    for (unsigned int i = 0; i < widgetCount; ++i)
+    {
+        manager.animatePosition(buttons[i], {static_cast<float>(i % 100) * 10, static_cast<float>(i / 100) * 10}, sf::seconds(10), tgui::Easing::EaseInOut);
+        manager.animateSize(buttons[i], {50, 20}, sf::seconds(10), tgui::Easing::EaseOut);
+        manager.animateOpacity(buttons[i], 0.5f, sf::seconds(10));
+    }
+    WARN("Starting " << manager.getAnimationCount() << " animations took " << clock.restart().asMicroseconds() << "us");
+
+    for (unsigned int i = 0; i < frames; ++i)
+        gui.updateTime(sf::milliseconds(16));
+    WARN("Updating " << manager.getAnimationCount() << " animations during " << frames << " frames took " << clock.restart().asMicroseconds() << "us");
+
+    REQUIRE(manager.getAnimationCount() == widgetCount * 3);
+}
@@ -40,6 +40,36 @@ TEST_CASE("[Container]")
     widget2->add(widget4, "w4");
     widget2->add(widget5, "w5");
 
+    SECTION("saveWidgetsToNodeTree")
+    {
+        std::stringstream stream1;
+        container->saveWidgetsToStream(stream1);
+
+        // The tree is a snapshot, changing the widgets afterwards doesn't affect it
+        const auto rootNode = container->saveWidgetsToNodeTree();
+        container->removeAllWidgets();
+
+        std::stringstream stream2;
+        tgui::DataIO::emit(rootNode, stream2);
+        REQUIRE(stream1.str() == stream2.str());
+    }
+
+    SECTION("loadWidgetsFromNodeTree")
+    {
+        std::stringstream stream1;
+        container->saveWidgetsToStream(stream1);
+
+        // The tree can be parsed separately from loading the widgets
+        const auto rootNode = tgui::DataIO::parse(stream1);
+        container->loadWidgetsFromNodeTree(rootNode);
+        REQUIRE(container->getWidgets().size() == 3);
+        REQUIRE(container->get("w5") != nullptr);
+
+        std::stringstream stream2;
+        container->saveWidgetsToStream(stream2);
+        REQUIRE(stream1.str() == stream2.str());
+    }
+
     SECTION("default font")
     {
         REQUIRE(tgui::getGlobalFont() != nullptr);
@@ -243,6 +273,52 @@ TEST_CASE("[Container]")
         REQUIRE(widget5->getInheritedOpacity() == 0.7f);
     }
 
+    SECTION("Culling")
+    {
+        sf::RenderTexture target;
+        target.create(200, 100);
+        tgui::Gui gui{target};
+
+        auto panel = tgui::ScrollablePanel::create({100, 100});
+        gui.add(panel);
+        for (unsigned int i = 0; i < 20; ++i)
+        {
+            auto button = tgui::Button::create();
+            button->setPosition(0, i * 50.f);
+            button->setSize(50, 50);
+            panel->add(button);
+        }
+
+        // Only the panel and the 2 buttons inside the visible area are drawn
+        tgui::Container::resetDrawStatistics();
+        gui.draw();
+        REQUIRE(tgui::Container::getDrawStatistics().widgetsDrawn == 3);
+        REQUIRE(tgui::Container::getDrawStatistics().widgetsCulled == 18);
+
+        // The widgets that are scrolled into view are drawn instead
+        panel->setVerticalScrollbarValue(500);
+        tgui::Container::resetDrawStatistics();
+        gui.draw();
+        REQUIRE(tgui::Container::getDrawStatistics().widgetsDrawn == 3);
+        REQUIRE(tgui::Container::getDrawStatistics().widgetsCulled == 18);
+
+        // A panel outside the screen is skipped together with its children
+        panel->setPosition(300, 0);
+        tgui::Container::resetDrawStatistics();
+        gui.draw();
+        REQUIRE(tgui::Container::getDrawStatistics().widgetsDrawn == 0);
+        REQUIRE(tgui::Container::getDrawStatistics().widgetsCulled == 1);
+
+        // Radio button groups don't clip their children, so their size doesn't matter
+        auto group = tgui::RadioButtonGroup::create();
+        group->add(tgui::RadioButton::create());
+        gui.add(group);
+        tgui::Container::resetDrawStatistics();
+        gui.draw();
+        REQUIRE(tgui::Container::getDrawStatistics().widgetsDrawn == 2);
+        REQUIRE(tgui::Container::getDrawStatistics().widgetsCulled == 1);
+    }
+
     // TODO: Events
     //       Test parameter of Widget::disable
 }
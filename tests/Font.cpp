@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Font.hpp>
+#include <TGUI/Text.hpp>
 
 TEST_CASE("[Font]")
 {
@@ -35,4 +36,50 @@ TEST_CASE("[Font]")
     REQUIRE(tgui::Font(font1).getFont() != nullptr);
     REQUIRE(tgui::Font(font2).getFont() == font2);
     REQUIRE(tgui::Font("resources/DejaVuSans.ttf").getFont() != nullptr);
+
+    SECTION("prewarm")
+    {
+        auto sfFont = std::make_shared<sf::Font>();
+        REQUIRE(sfFont->loadFromFile("resources/DejaVuSans.ttf"));
+
+        tgui::Font font{sfFont};
+        REQUIRE(font.getGlyphStatistics().pages == 0);
+        REQUIRE(font.getGlyphStatistics().textureMemory == 0);
+
+        font.prewarm({12, 20});
+        const auto statistics = font.getGlyphStatistics();
+        REQUIRE(statistics.pages == 2);
+        REQUIRE(statistics.textureMemory > 0);
+
+        // The glyphs are already rasterized, so requesting them again doesn't change anything
+        font.prewarm("abc", {12});
+        REQUIRE(font.getGlyphStatistics().pages == 2);
+        REQUIRE(font.getGlyphStatistics().textureMemory == statistics.textureMemory);
+
+        // Copies of the font share the statistics
+        tgui::Font copy = font;
+        copy.prewarm("abc", {12}, true);
+        copy.prewarm("x", {30});
+        REQUIRE(font.getGlyphStatistics().pages == 3);
+
+        REQUIRE(tgui::Font{}.getGlyphStatistics().pages == 0);
+    }
+
+    SECTION("Glyph statistics without prewarming")
+    {
+        auto sfFont = std::make_shared<sf::Font>();
+        REQUIRE(sfFont->loadFromFile("resources/DejaVuSans.ttf"));
+
+        // Glyphs that are requested while drawing text are counted as well
+        tgui::Font font{sfFont};
+        font.getGlyph('a', 15, false);
+        REQUIRE(font.getGlyphStatistics().pages == 1);
+        REQUIRE(font.getGlyphStatistics().textureMemory > 0);
+
+        tgui::Text text;
+        text.setFont(font);
+        text.setCharacterSize(25);
+        text.setString("Hello");
+        REQUIRE(font.getGlyphStatistics().pages == 2);
+    }
 }
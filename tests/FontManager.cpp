@@ -0,0 +1,152 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/FontManager.hpp>
+#include <TGUI/Font.hpp>
+#include <TGUI/Loading/Theme.hpp>
+#include <SFML/System/Err.hpp>
+
+namespace
+{
+    struct FontManagerTest : public tgui::FontManager
+    {
+        static std::size_t getEntryCount() { return m_fonts.size(); }
+    };
+}
+
+TEST_CASE("[FontManager]")
+{
+    tgui::FontManager::evictAllFonts();
+    tgui::FontManager::resetStatistics();
+
+    SECTION("Sharing fonts")
+    {
+        auto font1 = tgui::FontManager::getFont("resources/DejaVuSans.ttf");
+        auto font2 = tgui::FontManager::getFont("resources/DejaVuSans.ttf");
+        REQUIRE(font1 != nullptr);
+        REQUIRE(font1 == font2);
+        REQUIRE(tgui::Font("resources/DejaVuSans.ttf").getFont() == font1);
+
+        REQUIRE(tgui::FontManager::getStatistics().loads == 1);
+        REQUIRE(tgui::FontManager::getStatistics().cacheHits == 2);
+
+        tgui::FontManager::resetStatistics();
+        REQUIRE(tgui::FontManager::getStatistics().loads == 0);
+        REQUIRE(tgui::FontManager::getStatistics().cacheHits == 0);
+    }
+
+    SECTION("Fonts are released when no longer used")
+    {
+        auto font = tgui::FontManager::getFont("resources/DejaVuSans.ttf");
+        REQUIRE(tgui::FontManager::isFontLoaded("resources/DejaVuSans.ttf"));
+
+        font = nullptr;
+        REQUIRE(!tgui::FontManager::isFontLoaded("resources/DejaVuSans.ttf"));
+
+        REQUIRE(tgui::FontManager::getFont("resources/DejaVuSans.ttf") != nullptr);
+        REQUIRE(tgui::FontManager::getStatistics().loads == 2);
+    }
+
+    SECTION("Entries of released fonts are removed")
+    {
+        auto font = tgui::FontManager::getFont("resources/DejaVuSans.ttf");
+        REQUIRE(FontManagerTest::getEntryCount() == 1);
+
+        font = nullptr;
+        REQUIRE(FontManagerTest::getEntryCount() == 1);
+
+        // The entry is removed when looking up the font
+        REQUIRE(!tgui::FontManager::isFontLoaded("resources/DejaVuSans.ttf"));
+        REQUIRE(FontManagerTest::getEntryCount() == 0);
+
+        // Or when another font is loaded from disk
+        font = tgui::FontManager::getFont("resources/DejaVuSans.ttf");
+        font = nullptr;
+        std::streambuf *oldbuf = sf::err().rdbuf(nullptr);
+        REQUIRE(tgui::FontManager::getFont("resources/NonExistent.ttf") == nullptr);
+        sf::err().rdbuf(oldbuf);
+        REQUIRE(FontManagerTest::getEntryCount() == 0);
+    }
+
+    SECTION("Preloading")
+    {
+        auto preloadedFont = tgui::FontManager::preloadFont("resources/DejaVuSans.ttf");
+        REQUIRE(preloadedFont != nullptr);
+        REQUIRE(tgui::FontManager::isFontLoaded("resources/DejaVuSans.ttf"));
+
+        REQUIRE(tgui::FontManager::getFont("resources/DejaVuSans.ttf") == preloadedFont);
+        REQUIRE(tgui::FontManager::getStatistics().loads == 1);
+        REQUIRE(tgui::FontManager::getStatistics().cacheHits == 1);
+
+        SECTION("Releasing the preloaded font")
+        {
+            preloadedFont = nullptr;
+            REQUIRE(!tgui::FontManager::isFontLoaded("resources/DejaVuSans.ttf"));
+        }
+
+        SECTION("Evict single font")
+        {
+            tgui::FontManager::evictFont("resources/DejaVuSans.ttf");
+            REQUIRE(!tgui::FontManager::isFontLoaded("resources/DejaVuSans.ttf"));
+
+            // The font is loaded again while the old one remains valid for whoever still uses it
+            auto font = tgui::FontManager::getFont("resources/DejaVuSans.ttf");
+            REQUIRE(font != preloadedFont);
+            REQUIRE(tgui::FontManager::getStatistics().loads == 2);
+        }
+
+        SECTION("Evict all fonts")
+        {
+            tgui::FontManager::evictAllFonts();
+            REQUIRE(!tgui::FontManager::isFontLoaded("resources/DejaVuSans.ttf"));
+            REQUIRE(FontManagerTest::getEntryCount() == 0);
+        }
+    }
+
+    SECTION("Theme")
+    {
+        // All renderers in the theme use the same font file, which is only loaded once
+        tgui::Theme theme{"resources/Black.txt"};
+        theme.getRenderer("Button")->propertyValuePairs["font"] = {"\"resources/DejaVuSans.ttf\""};
+        theme.getRenderer("Label")->propertyValuePairs["font"] = {"\"resources/DejaVuSans.ttf\""};
+
+        const auto buttonFont = theme.getRenderer("Button")->propertyValuePairs["font"].getFont();
+        const auto labelFont = theme.getRenderer("Label")->propertyValuePairs["font"].getFont();
+        REQUIRE(buttonFont == labelFont);
+        REQUIRE(tgui::FontManager::getStatistics().loads == 1);
+    }
+
+    SECTION("Nonexistent font")
+    {
+        std::streambuf *oldbuf = sf::err().rdbuf(nullptr);
+        REQUIRE(tgui::FontManager::getFont("resources/NonExistent.ttf") == nullptr);
+        REQUIRE(tgui::FontManager::preloadFont("resources/NonExistent.ttf") == nullptr);
+        REQUIRE(!tgui::FontManager::isFontLoaded("resources/NonExistent.ttf"));
+        sf::err().rdbuf(oldbuf);
+    }
+
+    tgui::FontManager::evictAllFonts();
+}
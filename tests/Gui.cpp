@@ -0,0 +1,477 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/ChatBox.hpp>
+#include <TGUI/Widgets/CheckBox.hpp>
+#include <TGUI/Widgets/ComboBox.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/ListBox.hpp>
+#include <TGUI/Widgets/ListView.hpp>
+#include <TGUI/Widgets/ScrollablePanel.hpp>
+#include <TGUI/Widgets/Scrollbar.hpp>
+#include <TGUI/Widgets/Tabs.hpp>
+#include <TGUI/ToolTip.hpp>
+
+TEST_CASE("[Gui]")
+{
+    sf::RenderTexture target;
+    target.create(200, 100);
+    tgui::Gui gui{target};
+
+    auto label = tgui::Label::create("Label");
+    auto button = tgui::Button::create("Button");
+    button->setPosition(0, 50);
+    button->setSize(100, 30);
+    gui.add(label);
+    gui.add(button);
+
+    SECTION("Redraw")
+    {
+        REQUIRE(gui.needsRedraw());
+        gui.draw();
+        REQUIRE(!gui.needsRedraw());
+
+        SECTION("Idle")
+        {
+            // Nothing changes when no events are passed to the gui
+            for (unsigned int i = 0; i < 10; ++i)
+            {
+                gui.updateTime(sf::milliseconds(100));
+                REQUIRE(!gui.needsRedraw());
+            }
+
+            REQUIRE(!gui.updateTime());
+            REQUIRE(gui.getNextWakeupTime() > sf::seconds(3600));
+        }
+
+        SECTION("Property changes")
+        {
+            label->setText("Changed");
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            button->setPosition(10, 50);
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            // Setting the same position again doesn't require a redraw
+            button->setPosition(10, 50);
+            REQUIRE(!gui.needsRedraw());
+
+            button->getRenderer()->setBackgroundColor(sf::Color::Red);
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            button->setVisible(false);
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            gui.remove(label);
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            // Changing a widget that isn't part of the gui doesn't affect it
+            label->setText("Removed");
+            REQUIRE(!gui.needsRedraw());
+        }
+
+        SECTION("Item and check changes")
+        {
+            auto listBox = tgui::ListBox::create();
+            auto comboBox = tgui::ComboBox::create();
+            auto checkBox = tgui::CheckBox::create();
+            gui.add(listBox);
+            gui.add(comboBox);
+            gui.add(checkBox);
+            gui.draw();
+
+            listBox->addItem("1");
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            listBox->setSelectedItem("1");
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            listBox->removeItem("1");
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            comboBox->addItem("1");
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            comboBox->setSelectedItem("1");
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            comboBox->changeItem("1", "2");
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            checkBox->setChecked(true);
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            checkBox->setChecked(false);
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            // Checking a box that is already checked changes nothing
+            checkBox->setChecked(false);
+            REQUIRE(!gui.needsRedraw());
+        }
+
+        SECTION("Scrolling and selection changes")
+        {
+            auto scrollbar = tgui::Scrollbar::create();
+            scrollbar->setMaximum(50);
+            scrollbar->setViewportSize(10);
+            auto tabs = tgui::Tabs::create();
+            tabs->add("1", false);
+            tabs->add("2", false);
+            auto chatBox = tgui::ChatBox::create();
+            chatBox->setSize(100, 40);
+            for (unsigned int i = 0; i < 10; ++i)
+                chatBox->addLine("Line");
+            auto listView = tgui::ListView::create();
+            listView->setSize(100, 40);
+            listView->addColumn("Column");
+            for (unsigned int i = 0; i < 10; ++i)
+                listView->addItem("Item");
+            gui.add(scrollbar);
+            gui.add(tabs);
+            gui.add(chatBox);
+            gui.add(listView);
+            gui.draw();
+
+            scrollbar->setValue(20);
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            // Setting the same value again doesn't require a redraw
+            scrollbar->setValue(20);
+            REQUIRE(!gui.needsRedraw());
+
+            scrollbar->setMaximum(25);
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            tabs->select(1);
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            tabs->deselect();
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            tabs->remove(0);
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            chatBox->setScrollbarValue(0);
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            chatBox->removeLine(0);
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            chatBox->setLinesStartFromTop(true);
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            listView->setVerticalScrollbarValue(20);
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            listView->setSelectedItem(1);
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            listView->deselectItems();
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            listView->changeSubItem(2, 0, "Changed");
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            listView->removeItem(3);
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            listView->sortByColumn(0, false);
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+        }
+
+        SECTION("Events")
+        {
+            sf::Event event;
+            event.type = sf::Event::MouseMoved;
+            event.mouseMove.x = 150;
+            event.mouseMove.y = 10;
+            REQUIRE(!gui.handleEvent(event));
+            REQUIRE(!gui.needsRedraw());
+
+            // Mouse enters the button
+            event.mouseMove.x = 20;
+            event.mouseMove.y = 60;
+            REQUIRE(gui.handleEvent(event));
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            // Tool tip would be shown after the initial delay
+            REQUIRE(gui.getNextWakeupTime() <= tgui::ToolTip::getInitialDelay());
+        }
+
+        SECTION("Tool tip")
+        {
+            // A label with a fixed size only arranges its text when it gets updated
+            auto toolTip = tgui::Label::create("Tool tip");
+            toolTip->setSize(80, 20);
+            toolTip->getRenderer()->setBackgroundColor(sf::Color::White);
+            toolTip->getRenderer()->setTextColor(sf::Color::Black);
+            button->setToolTip(toolTip);
+
+            sf::Event event;
+            event.type = sf::Event::MouseMoved;
+            event.mouseMove.x = 20;
+            event.mouseMove.y = 52;
+            gui.handleEvent(event);
+            gui.draw();
+
+            gui.updateTime(tgui::ToolTip::getInitialDelay());
+            REQUIRE(toolTip->getParent() != nullptr);
+            REQUIRE(gui.needsRedraw());
+
+            target.clear(sf::Color::White);
+            gui.draw();
+            target.display();
+            REQUIRE(!gui.needsRedraw());
+
+            // The text of the tool tip has to be visible the first time it is drawn
+            const sf::Image image = target.getTexture().copyToImage();
+            const sf::Vector2u topLeft{static_cast<unsigned int>(toolTip->getPosition().x), static_cast<unsigned int>(toolTip->getPosition().y)};
+            REQUIRE(topLeft.x + 80 <= image.getSize().x);
+            REQUIRE(topLeft.y + 20 <= image.getSize().y);
+
+            bool textDrawn = false;
+            for (unsigned int x = topLeft.x; x < topLeft.x + 80; ++x)
+            {
+                for (unsigned int y = topLeft.y; y < topLeft.y + 20; ++y)
+                {
+                    if (image.getPixel(x, y).r < 128)
+                        textDrawn = true;
+                }
+            }
+            REQUIRE(textDrawn);
+        }
+
+        SECTION("Caret blinking")
+        {
+            auto editBox = tgui::EditBox::create();
+            editBox->setPosition(100, 0);
+            gui.add(editBox);
+            gui.draw();
+
+            // The caret of an unfocused edit box isn't visible, so it doesn't require redraws
+            gui.updateTime(sf::milliseconds(600));
+            REQUIRE(!gui.needsRedraw());
+
+            editBox->setFocused(true);
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            gui.updateTime(sf::milliseconds(100));
+            REQUIRE(!gui.needsRedraw());
+            REQUIRE(gui.getNextWakeupTime() <= sf::milliseconds(400));
+
+            gui.updateTime(sf::milliseconds(400));
+            REQUIRE(gui.needsRedraw());
+        }
+
+        SECTION("Animation")
+        {
+            button->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(300));
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            gui.updateTime(sf::milliseconds(100));
+            REQUIRE(gui.needsRedraw());
+            REQUIRE(gui.getNextWakeupTime() == sf::Time::Zero);
+            gui.draw();
+
+            gui.updateTime(sf::milliseconds(300));
+            REQUIRE(gui.needsRedraw());
+            gui.draw();
+
+            // Animation has finished
+            gui.updateTime(sf::milliseconds(100));
+            REQUIRE(!gui.needsRedraw());
+        }
+    }
+
+    SECTION("prewarmFonts")
+    {
+        auto sfFont = std::make_shared<sf::Font>();
+        REQUIRE(sfFont->loadFromFile("resources/DejaVuSans.ttf"));
+        const tgui::Font font{sfFont};
+
+        auto toolTip = tgui::Label::create();
+        toolTip->getRenderer()->setFont(font);
+        toolTip->setTextSize(57);
+        button->setToolTip(toolTip);
+
+        const auto statistics = font.getGlyphStatistics();
+        gui.prewarmFonts();
+        REQUIRE(font.getGlyphStatistics().pages >= 1);
+        REQUIRE(font.getGlyphStatistics().textureMemory > statistics.textureMemory);
+    }
+
+    SECTION("Queued events")
+    {
+        auto mouseMoved = [](int x, int y){
+            sf::Event event;
+            event.type = sf::Event::MouseMoved;
+            event.mouseMove.x = x;
+            event.mouseMove.y = y;
+            return event;
+        };
+        auto mouseButton = [](sf::Event::EventType type, int x, int y){
+            sf::Event event;
+            event.type = type;
+            event.mouseButton.button = sf::Mouse::Left;
+            event.mouseButton.x = x;
+            event.mouseButton.y = y;
+            return event;
+        };
+
+        // Recorded stream of a mouse that wanders around before clicking the button and leaving it again
+        const std::vector<sf::Event> events = {
+                mouseMoved(150, 10),
+                mouseMoved(20, 60),
+                mouseMoved(150, 10),
+                mouseMoved(30, 65),
+                mouseButton(sf::Event::MouseButtonPressed, 30, 65),
+                mouseMoved(35, 66),
+                mouseMoved(40, 67),
+                mouseButton(sf::Event::MouseButtonReleased, 40, 67),
+                mouseMoved(60, 70),
+                mouseMoved(150, 10)
+            };
+
+        unsigned int mouseEnterCount = 0;
+        unsigned int mouseLeaveCount = 0;
+        unsigned int clickCount = 0;
+        button->onMouseEnter.connect([&]{ mouseEnterCount++; });
+        button->onMouseLeave.connect([&]{ mouseLeaveCount++; });
+        button->onPress.connect([&]{ clickCount++; });
+
+        SECTION("Handling events one by one")
+        {
+            for (const auto& event : events)
+                gui.handleEvent(event);
+
+            REQUIRE(mouseEnterCount == 2);
+            REQUIRE(mouseLeaveCount == 2);
+            REQUIRE(clickCount == 1);
+        }
+
+        SECTION("Handling queued events")
+        {
+            for (const auto& event : events)
+                gui.queueEvent(event);
+
+            REQUIRE(gui.handleQueuedEvents());
+
+            // The mouse only enters the button once, but the click is still detected
+            REQUIRE(mouseEnterCount == 1);
+            REQUIRE(mouseLeaveCount == 1);
+            REQUIRE(clickCount == 1);
+
+            // The queue is empty afterwards
+            REQUIRE(!gui.handleQueuedEvents());
+        }
+    }
+
+    SECTION("Queued wheel events")
+    {
+        auto wheelScrolled = [](float delta){
+            sf::Event event;
+            event.type = sf::Event::MouseWheelScrolled;
+            event.mouseWheelScroll.wheel = sf::Mouse::VerticalWheel;
+            event.mouseWheelScroll.delta = delta;
+            event.mouseWheelScroll.x = 10;
+            event.mouseWheelScroll.y = 10;
+            return event;
+        };
+
+        auto panel = tgui::ScrollablePanel::create({100, 100});
+        panel->setContentSize({100, 1000});
+        gui.add(panel);
+
+        // Scrolling three times at once has the same effect as three separate scroll events
+        gui.queueEvent(wheelScrolled(-1));
+        gui.queueEvent(wheelScrolled(-1));
+        gui.queueEvent(wheelScrolled(-1));
+        gui.handleQueuedEvents();
+        const unsigned int queuedScrollValue = panel->getVerticalScrollbarValue();
+        REQUIRE(queuedScrollValue > 0);
+
+        panel->setVerticalScrollbarValue(0);
+        for (unsigned int i = 0; i < 3; ++i)
+            gui.handleEvent(wheelScrolled(-1));
+        REQUIRE(panel->getVerticalScrollbarValue() == queuedScrollValue);
+
+        // Widgets that change their value in steps take every merged scroll event into account
+        gui.remove(panel);
+        auto comboBox = tgui::ComboBox::create();
+        comboBox->setSize(100, 20);
+        comboBox->setChangeItemOnScroll(true);
+        for (const auto& item : {"1", "2", "3", "4"})
+            comboBox->addItem(item);
+        gui.add(comboBox);
+
+        gui.queueEvent(wheelScrolled(-1));
+        gui.queueEvent(wheelScrolled(-1));
+        gui.queueEvent(wheelScrolled(-1));
+        gui.handleQueuedEvents();
+        REQUIRE(comboBox->getSelectedItemIndex() == 2);
+
+        gui.queueEvent(wheelScrolled(1));
+        gui.queueEvent(wheelScrolled(-1));
+        gui.handleQueuedEvents();
+        REQUIRE(comboBox->getSelectedItemIndex() == 2);
+
+        gui.queueEvent(wheelScrolled(1));
+        gui.queueEvent(wheelScrolled(1));
+        gui.handleQueuedEvents();
+        REQUIRE(comboBox->getSelectedItemIndex() == 0);
+    }
+}
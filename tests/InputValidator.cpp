@@ -0,0 +1,147 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/InputValidator.hpp>
+
+TEST_CASE("[InputValidator]")
+{
+    SECTION("Any input")
+    {
+        tgui::InputValidator validator;
+        REQUIRE(validator.acceptsAnyInput());
+        REQUIRE(validator.getPattern() == ".*");
+        REQUIRE(validator.matches(""));
+        REQUIRE(validator.matches(L"Some \u00CA text"));
+
+        REQUIRE(tgui::InputValidator{".*"}.acceptsAnyInput());
+        REQUIRE(!tgui::InputValidator{".+"}.acceptsAnyInput());
+    }
+
+    SECTION("Numbers")
+    {
+        tgui::InputValidator validator{"[+-]?[0-9]*\\.?[0-9]*"};
+        REQUIRE(!validator.acceptsAnyInput());
+        REQUIRE(validator.matches(""));
+        REQUIRE(validator.matches("-2.5"));
+        REQUIRE(validator.matches("+.5"));
+        REQUIRE(!validator.matches("2.5.1"));
+        REQUIRE(!validator.matches("--2"));
+        REQUIRE(!validator.matches(L"2\u00CA"));
+
+        tgui::InputValidator hexValidator{"[0-9a-fA-F]*"};
+        REQUIRE(hexValidator.matches("09afAF"));
+        REQUIRE(!hexValidator.matches("0x10"));
+    }
+
+    SECTION("Syntax")
+    {
+        REQUIRE(tgui::InputValidator{"^[a-z]+$"}.matches("abc"));
+        REQUIRE(!tgui::InputValidator{"^[a-z]+$"}.matches("aBc"));
+        REQUIRE(tgui::InputValidator{"(ab|c)*d?"}.matches("abcabd"));
+        REQUIRE(!tgui::InputValidator{"(ab|c)*d?"}.matches("abad"));
+        REQUIRE(tgui::InputValidator{"a{2,3}"}.matches("aaa"));
+        REQUIRE(!tgui::InputValidator{"a{2,3}"}.matches("aaaa"));
+        REQUIRE(tgui::InputValidator{"\\d+\\.\\d{2}"}.matches("12.34"));
+        REQUIRE(tgui::InputValidator{"\\w+@\\w+\\.com"}.matches("my_name@example.com"));
+        REQUIRE(tgui::InputValidator{"[^\\s]*"}.matches("NoSpaces"));
+        REQUIRE(!tgui::InputValidator{"[^\\s]*"}.matches("With spaces"));
+        REQUIRE(tgui::InputValidator{"a.c"}.matches(L"a\u00CAc"));
+        REQUIRE(!tgui::InputValidator{"a.c"}.matches("a\nc"));
+        REQUIRE(tgui::InputValidator{""}.matches(""));
+        REQUIRE(!tgui::InputValidator{""}.matches("a"));
+    }
+
+    SECTION("Features of std::regex that can't be compiled")
+    {
+        // Back-references and lookaheads are still supported, but they are checked with std::regex
+        REQUIRE(tgui::InputValidator{"(a+)b\\1"}.matches("aabaa"));
+        REQUIRE(!tgui::InputValidator{"(a+)b\\1"}.matches("aaba"));
+        REQUIRE(tgui::InputValidator{"(?!x)[a-z]*"}.matches("abc"));
+        REQUIRE(!tgui::InputValidator{"(?!x)[a-z]*"}.matches("xyz"));
+    }
+
+    SECTION("Invalid expressions")
+    {
+        REQUIRE_THROWS_AS(tgui::InputValidator{"abc[0-"}, tgui::Exception);
+        REQUIRE_THROWS_AS(tgui::InputValidator{"(a"}, tgui::Exception);
+        REQUIRE_THROWS_AS(tgui::InputValidator{"*a"}, tgui::Exception);
+    }
+
+    SECTION("Edits")
+    {
+        tgui::InputValidator validator{"[+-]?[0-9]*"};
+        REQUIRE(validator.matchesAfterEdit("25", 0, 0, '-'));
+        REQUIRE(!validator.matchesAfterEdit("25", 1, 0, '-'));
+        REQUIRE(validator.matchesAfterEdit("25", 2, 0, '0'));
+        REQUIRE(!validator.matchesAfterEdit("-25", 0, 0, '+'));
+        REQUIRE(validator.matchesAfterEdit("-25", 0, 1, '+'));
+        REQUIRE(validator.matchesAfterEdit("-25", 1, 2, '7'));
+        REQUIRE(!validator.matchesAfterEdit("-25", 1, 2, 'x'));
+    }
+
+    SECTION("Edits with remembered states")
+    {
+        // The result has to be the same as when checking the edited text from scratch, while the states of the text are
+        // being updated with every edit
+        const std::string pattern = "(ab|c)*d?";
+        tgui::InputValidator validator{pattern};
+        tgui::InputValidator uncachedValidator{pattern};
+
+        sf::String text = "abcab";
+        validator.textEdited(text, 0, 0, text.getSize());
+
+        const std::vector<std::pair<std::size_t, std::uint32_t>> insertions = {
+            {5, 'd'}, {0, 'c'}, {3, 'x'}, {2, 'a'}, {3, 'b'}, {1, 'c'}, {0, 'd'}, {7, 'c'}
+        };
+        for (const auto& insertion : insertions)
+        {
+            sf::String editedText = text;
+            editedText.insert(insertion.first, insertion.second);
+            REQUIRE(validator.matchesAfterEdit(text, insertion.first, 0, insertion.second) == uncachedValidator.matches(editedText));
+            REQUIRE(uncachedValidator.matchesAfterEdit(text, insertion.first, 0, insertion.second) == uncachedValidator.matches(editedText));
+
+            text = editedText;
+            validator.textEdited(text, insertion.first, 0, 1);
+        }
+
+        for (std::size_t pos = 0; pos + 2 <= text.getSize(); ++pos)
+        {
+            sf::String editedText = text;
+            editedText.erase(pos, 2);
+            editedText.insert(pos, 'c');
+            REQUIRE(validator.matchesAfterEdit(text, pos, 2, 'c') == uncachedValidator.matches(editedText));
+        }
+
+        text.erase(1, 3);
+        validator.textEdited(text, 1, 3, 0);
+        for (std::size_t pos = 0; pos <= text.getSize(); ++pos)
+        {
+            sf::String editedText = text;
+            editedText.insert(pos, 'b');
+            REQUIRE(validator.matchesAfterEdit(text, pos, 0, 'b') == uncachedValidator.matches(editedText));
+        }
+    }
+}
@@ -206,6 +206,43 @@ TEST_CASE("[DataIO]")
         }
     }
 
+    SECTION("emit format")
+    {
+        auto root = std::make_unique<tgui::DataIO::Node>();
+        root->propertyValuePairs["Global"] = std::make_unique<tgui::DataIO::ValueNode>("1");
+
+        auto child1 = std::make_unique<tgui::DataIO::Node>();
+        child1->name = "Child1";
+        child1->propertyValuePairs["Property"] = std::make_unique<tgui::DataIO::ValueNode>("Value");
+
+        auto nestedChild = std::make_unique<tgui::DataIO::Node>();
+        nestedChild->name = "NestedChild";
+        nestedChild->propertyValuePairs["PropertyA"] = std::make_unique<tgui::DataIO::ValueNode>("ValueA");
+        child1->children.push_back(std::move(nestedChild));
+        child1->children.push_back(std::make_unique<tgui::DataIO::Node>());
+
+        root->children.push_back(std::move(child1));
+        root->children.push_back(std::make_unique<tgui::DataIO::Node>());
+
+        std::stringstream stream;
+        tgui::DataIO::emit(root, stream);
+        REQUIRE(stream.str() == "Global = 1;\n"
+                                "\n"
+                                "Child1 {\n"
+                                "    Property = Value;\n"
+                                "\n"
+                                "    NestedChild {\n"
+                                "        PropertyA = ValueA;\n"
+                                "    }\n"
+                                "\n"
+                                "    {\n"
+                                "    }\n"
+                                "}\n"
+                                "\n"
+                                "{\n"
+                                "}\n");
+    }
+
     SECTION("correct input")
     {
         std::stringstream stream;
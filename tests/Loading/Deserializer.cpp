@@ -24,6 +24,8 @@
 
 #include "Tests.hpp"
 #include <TGUI/Loading/Deserializer.hpp>
+#include <sstream>
+#include <locale>
 
 using Type = tgui::ObjectConverter::Type;
 
@@ -110,6 +112,7 @@ TEST_CASE("[Deserializer]")
         REQUIRE(tgui::Deserializer::deserialize(Type::Number, "0").getNumber() == 0);
         REQUIRE(tgui::Deserializer::deserialize(Type::Number, "1").getNumber() == 1);
         REQUIRE(tgui::Deserializer::deserialize(Type::Number, "2.25").getNumber() == 2.25f);
+        REQUIRE(tgui::Deserializer::deserialize(Type::Number, "-1.5e1").getNumber() == -15);
     }
 
     SECTION("deserialize outline")
@@ -222,3 +225,38 @@ TEST_CASE("[Deserializer]")
         REQUIRE(tgui::Deserializer::deserialize(Type::Color, "rgb(10, 20, 30)").getColor() == sf::Color(10, 20, 30));
     }
 }
+
+TEST_CASE("[Deserializer] Parsing numbers", "[.benchmark]")
+{
+    std::vector<std::string> numbers;
+    for (unsigned int i = 0; i < 100000; ++i)
+        numbers.push_back(tgui::to_string(i * 0.37f));
+
+    // The way numbers were parsed before: a string stream with the classic locale per number
+    double totalStream = 0;
+    double total = 0;
+    sf::Clock clock;
+    for (const auto& number : numbers)
+    {
+        float value = 0;
+        std::istringstream iss(number);
+        iss.imbue(std::locale::classic());
+        iss >> value;
+        totalStream += value;
+    }
+    WARN("Parsing " << numbers.size() << " floats with istringstream took " << clock.restart().asMicroseconds() << "us");
+
+    for (const auto& number : numbers)
+        total += tgui::strToFloat(number);
+    WARN("Parsing " << numbers.size() << " floats with strToFloat took " << clock.restart().asMicroseconds() << "us");
+
+    for (unsigned int i = 0; i < numbers.size(); ++i)
+        tgui::Deserializer::deserialize(Type::Color, "rgba(10, 20, 30, 40)");
+    WARN("Deserializing " << numbers.size() << " colors took " << clock.restart().asMicroseconds() << "us");
+
+    for (unsigned int i = 0; i < numbers.size(); ++i)
+        tgui::Deserializer::deserialize(Type::Outline, "(1, 2, 3, 4)");
+    WARN("Deserializing " << numbers.size() << " outlines took " << clock.restart().asMicroseconds() << "us");
+
+    REQUIRE(total == totalStream);
+}
@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Loading/Theme.hpp>
+#include <TGUI/Widgets/Button.hpp>
 #include <TGUI/Widgets/Label.hpp>
 
 // TODO: Reloading theme
@@ -138,6 +139,68 @@ TEST_CASE("[Theme]")
             }
         }
 
+        SECTION("Copy on write")
+        {
+            auto label1 = tgui::Label::create();
+            auto label2 = tgui::Label::create();
+            label1->setRenderer(theme.getRenderer("label"));
+            label2->setRenderer(theme.getRenderer("label"));
+            REQUIRE(theme.getRenderer("label")->observers.size() == 2);
+
+            // Reading from the renderer doesn't copy the data
+            const tgui::Color textColor = label1->getRenderer()->getTextColor();
+            REQUIRE(label1->getSharedRenderer()->getData() == theme.getRenderer("label"));
+
+            // Changing a property gives the widget its own copy of the data
+            label1->getRenderer()->setTextColor({1, 2, 3});
+            REQUIRE(label1->getRenderer()->getData() != theme.getRenderer("label"));
+            REQUIRE(label1->getRenderer()->getTextColor() == tgui::Color(1, 2, 3));
+            REQUIRE(label1->getRenderer()->getData()->observers.size() == 1);
+            REQUIRE(label2->getSharedRenderer()->getTextColor() == textColor);
+            REQUIRE(theme.getRenderer("label")->observers.size() == 1);
+
+            // After calling getRenderer, changes made through getSharedRenderer no longer affect the other widgets either
+            label2->getRenderer();
+            label2->getSharedRenderer()->setTextColor({4, 5, 6});
+            REQUIRE(label2->getSharedRenderer()->getData() != theme.getRenderer("label"));
+            REQUIRE(tgui::LabelRenderer(theme.getRenderer("label")).getTextColor() == textColor);
+            REQUIRE(theme.getRenderer("label")->observers.empty());
+
+            // The data returned by getRenderer belongs to the widget, it can be changed or given to another widget
+            auto label3 = tgui::Label::create();
+            label3->setRenderer(theme.getRenderer("label"));
+            auto data = label3->getRenderer()->getData();
+            REQUIRE(data != theme.getRenderer("label"));
+            REQUIRE(theme.getRenderer("label")->observers.empty());
+
+            data->propertyValuePairs["textcolor"] = tgui::Color{7, 8, 9};
+            REQUIRE(tgui::LabelRenderer(theme.getRenderer("label")).getTextColor() == textColor);
+
+            auto label4 = tgui::Label::create();
+            label4->setRenderer(label3->getRenderer()->getData());
+            label4->getRenderer()->setTextColor({10, 11, 12});
+            REQUIRE(label3->getRenderer()->getTextColor() == tgui::Color(7, 8, 9));
+        }
+
+        SECTION("Observers that unsubscribe while being notified")
+        {
+            auto data = tgui::RendererData::create();
+            int ids[3];
+            unsigned int callCount = 0;
+            for (const int& id : ids)
+            {
+                data->observers[&id] = [&data,&callCount,&id](const std::string&){
+                    ++callCount;
+                    data->observers.erase(&id);
+                };
+            }
+
+            // No observer is skipped when the one that was called before it removes itself
+            data->notifyObservers("textcolor");
+            REQUIRE(callCount == 3);
+            REQUIRE(data->observers.empty());
+        }
+
         SECTION("Without widgets")
         {
             REQUIRE(tgui::LabelRenderer(theme.getRenderer("label")).getTextColor() != sf::Color::Cyan);
@@ -199,3 +262,33 @@ TEST_CASE("[Theme]")
         REQUIRE(loader->loadCount == 2);
     }
 }
+
+TEST_CASE("[Theme] Switching themes", "[.benchmark]")
+{
+    tgui::Theme theme{"resources/Black.txt"};
+
+    std::vector<tgui::Button::Ptr> buttons;
+    for (unsigned int i = 0; i < 10000; ++i)
+    {
+        auto button = tgui::Button::create();
+        button->setRenderer(theme.getRenderer("Button"));
+        buttons.push_back(button);
+    }
+
+    sf::Clock clock;
+    theme.load("resources/BabyBlue.txt");
+    WARN("Switching the theme of " << buttons.size() << " buttons took " << clock.restart().asMicroseconds() << "us");
+
+    theme.load("resources/Black.txt");
+    WARN("Switching the theme back took " << clock.restart().asMicroseconds() << "us");
+
+    for (const auto& button : buttons)
+        button->getRenderer()->getTextColor();
+    WARN("Reading a property through getRenderer of every button took " << clock.restart().asMicroseconds() << "us");
+
+    for (const auto& button : buttons)
+        button->getRenderer()->setTextColor(sf::Color::Red);
+    WARN("Changing a property through getRenderer of every button took " << clock.restart().asMicroseconds() << "us");
+
+    REQUIRE(theme.getRenderer("Button")->observers.empty());
+}
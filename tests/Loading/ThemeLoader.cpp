@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Loading/ThemeLoader.hpp>
+#include <TGUI/Loading/Theme.hpp>
 
 // Ignore warning "C4503: decorated name length exceeded, name was truncated" in Visual Studio
 #if defined _MSC_VER
@@ -35,6 +36,7 @@ namespace tgui
     struct DefaultThemeLoaderTest
     {
         static auto& getPropertiesCache(std::shared_ptr<DefaultThemeLoader> loader) { return loader->m_propertiesCache; }
+        static auto& getDeserializedCache(std::shared_ptr<DefaultThemeLoader> loader) { return loader->m_deserializedCache; }
     };
 }
 
@@ -110,6 +112,112 @@ TEST_CASE("[ThemeLoader]")
         REQUIRE(properties["listbox"] == "{\nbackgroundcolor = Cyan;\n\nScrollbar {\n    trackcolor = Black;\n}\n}");
     }
 
+    SECTION("load deserialized")
+    {
+        auto values = loader->loadDeserialized("resources/ThemeSpecialCases.txt", "name.WITH.dots");
+        REQUIRE(values.size() == 2);
+        REQUIRE(values["textcolor"].getType() == tgui::ObjectConverter::Type::Color);
+        REQUIRE(values["textcolor"].getColor() == sf::Color::Green);
+        REQUIRE(values["backgroundcolor"].getColor() == sf::Color::White);
+
+        // Values that can't be deserialized are kept as strings
+        values = loader->loadDeserialized("resources/ThemeSpecialCases.txt", "SpecialChars.{}=:;/*#//\t\\\"");
+        REQUIRE(values.size() == 1);
+        REQUIRE(values["textcolor"].getType() == tgui::ObjectConverter::Type::String);
+        REQUIRE(values["textcolor"].getString() == "rgba(,,,)");
+
+        // Nested sections are deserialized too, but each call returns its own copy of them
+        values = loader->loadDeserialized("resources/ThemeNested.txt", "ListBox1");
+        REQUIRE(values.size() == 2);
+        REQUIRE(values["backgroundcolor"].getColor() == sf::Color::White);
+        REQUIRE(values["scrollbar"].getType() == tgui::ObjectConverter::Type::RendererData);
+        auto scrollbarData = values["scrollbar"].getRenderer();
+        REQUIRE(scrollbarData->propertyValuePairs["thumbcolor"].getType() == tgui::ObjectConverter::Type::Color);
+        REQUIRE(scrollbarData->propertyValuePairs["thumbcolor"].getColor() == sf::Color::Green);
+
+        auto values2 = loader->loadDeserialized("resources/ThemeNested.txt", "ListBox1");
+        REQUIRE(values2["scrollbar"].getRenderer() != scrollbarData);
+        REQUIRE(values2["scrollbar"].getRenderer()->propertyValuePairs["trackcolor"].getColor() == sf::Color::Red);
+
+        // The loaded sections are cached until the cache is flushed
+        auto& cache = tgui::DefaultThemeLoaderTest::getDeserializedCache(loader);
+        REQUIRE(cache.size() == 2);
+        REQUIRE(cache["resources/ThemeNested.txt"].size() == 1);
+
+        tgui::DefaultThemeLoader::flushCache("resources/ThemeNested.txt");
+        REQUIRE(cache.size() == 1);
+
+        tgui::DefaultThemeLoader::flushCache();
+        REQUIRE(cache.size() == 0);
+
+        REQUIRE_THROWS_AS(loader->loadDeserialized("resources/Black.txt", "NonexistentClassName"), tgui::Exception);
+    }
+
+    SECTION("load deserialized with property names that don't reveal the type")
+    {
+        auto values = loader->loadDeserialized("resources/ThemePropertyTypes.txt", "PropertyTypes");
+        REQUIRE(values.size() == 10);
+
+        // The type is only derived from the name when it matches the patterns of the renderer properties
+        REQUIRE(values["borders"].getType() == tgui::ObjectConverter::Type::Outline);
+        REQUIRE(values["borders"].getOutline() == tgui::Outline(1, 2, 3, 4));
+        REQUIRE(values["selectedtextstyle"].getType() == tgui::ObjectConverter::Type::TextStyle);
+        REQUIRE(values["selectedtextstyle"].getTextStyle() == sf::Text::Bold);
+
+        // Names that only contain a pattern somewhere in the middle are left as strings
+        REQUIRE(values["borderbelowtitlebar"].getType() == tgui::ObjectConverter::Type::String);
+        REQUIRE(values["borderbelowtitlebar"].getString() == "2");
+        REQUIRE(values["fontsize"].getType() == tgui::ObjectConverter::Type::String);
+        REQUIRE(values["fontsize"].getString() == "12");
+        REQUIRE(values["paddingbetweenbuttons"].getType() == tgui::ObjectConverter::Type::String);
+        REQUIRE(values["paddingbetweenbuttons"].getString() == "3");
+        REQUIRE(values["transparenttexture"].getType() == tgui::ObjectConverter::Type::String);
+        REQUIRE(values["transparenttexture"].getString() == "true");
+
+        // Names without any pattern are left as strings, even when the value could be deserialized
+        REQUIRE(values["highlight"].getType() == tgui::ObjectConverter::Type::String);
+        REQUIRE(values["highlight"].getString() == "Red");
+        REQUIRE(values["opacity"].getType() == tgui::ObjectConverter::Type::String);
+        REQUIRE(values["opacity"].getString() == "0.5");
+
+        // A name that matches a pattern while the value isn't of that type is kept as a string
+        REQUIRE(values["colorcount"].getType() == tgui::ObjectConverter::Type::String);
+        REQUIRE(values["colorcount"].getString() == "3");
+
+        // Nested sections are recognized by their value instead of their name
+        REQUIRE(values["scrollbar"].getType() == tgui::ObjectConverter::Type::RendererData);
+        auto& scrollbarValues = values["scrollbar"].getRenderer()->propertyValuePairs;
+        REQUIRE(scrollbarValues["thumbcolor"].getType() == tgui::ObjectConverter::Type::Color);
+        REQUIRE(scrollbarValues["thumbcolor"].getColor() == sf::Color::Green);
+        REQUIRE(scrollbarValues["maximumthumbwidth"].getType() == tgui::ObjectConverter::Type::String);
+        REQUIRE(scrollbarValues["maximumthumbwidth"].getString() == "5");
+    }
+
+    SECTION("deserialized cache is released with the theme")
+    {
+        auto& cache = tgui::DefaultThemeLoaderTest::getDeserializedCache(loader);
+
+        {
+            tgui::Theme theme1{"resources/ThemeNested.txt"};
+            tgui::Theme theme2{"resources/ThemeSpecialCases.txt"};
+            theme1.getRenderer("ListBox1");
+            theme2.getRenderer("Button1");
+            REQUIRE(cache.size() == 2);
+
+            // Loading another file releases the values of the old one
+            theme2.load("resources/ThemeButton1.txt");
+            REQUIRE(cache.size() == 2);
+            REQUIRE(cache.find("resources/ThemeSpecialCases.txt") == cache.end());
+            REQUIRE(cache.find("resources/ThemeButton1.txt") != cache.end());
+        }
+
+        // The textures and fonts aren't kept alive by the cache once the themes are gone
+        REQUIRE(cache.size() == 0);
+
+        // The property strings remain cached
+        REQUIRE(tgui::DefaultThemeLoaderTest::getPropertiesCache(loader).size() == 3);
+    }
+
     SECTION("cache")
     {
         REQUIRE(tgui::DefaultThemeLoaderTest::getPropertiesCache(loader).size() == 0);
@@ -0,0 +1,132 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include "AllocationCounter.hpp"
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/CheckBox.hpp>
+#include <TGUI/Widgets/ChildWindow.hpp>
+#include <TGUI/Widgets/ComboBox.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/ListBox.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/Picture.hpp>
+#include <TGUI/Widgets/ProgressBar.hpp>
+#include <TGUI/Widgets/Slider.hpp>
+#include <TGUI/Widgets/TextBox.hpp>
+
+namespace
+{
+    template <typename WidgetType>
+    void reportWidgetFootprint(const std::string& name)
+    {
+        // Create a widget first, so that one-time allocations (e.g. loading the default font) are not counted
+        auto firstWidget = WidgetType::create();
+
+        const unsigned int count = 1000;
+        std::vector<typename WidgetType::Ptr> widgets;
+        widgets.reserve(count);
+
+        startCountingAllocations();
+        for (unsigned int i = 0; i < count; ++i)
+            widgets.push_back(WidgetType::create());
+        stopCountingAllocations();
+
+        // The heap bytes include the widget object itself and the control block of its shared_ptr
+        WARN(name << ": sizeof = " << sizeof(WidgetType) << ", heap bytes per widget = " << (getAllocatedBytes() / count));
+    }
+}
+
+TEST_CASE("[Widget] Memory footprint of widgets", "[.benchmark]")
+{
+    WARN("Base widget: sizeof = " << sizeof(tgui::Widget));
+
+    reportWidgetFootprint<tgui::ClickableWidget>("ClickableWidget");
+    reportWidgetFootprint<tgui::Button>("Button");
+    reportWidgetFootprint<tgui::CheckBox>("CheckBox");
+    reportWidgetFootprint<tgui::ChildWindow>("ChildWindow");
+    reportWidgetFootprint<tgui::ComboBox>("ComboBox");
+    reportWidgetFootprint<tgui::EditBox>("EditBox");
+    reportWidgetFootprint<tgui::Label>("Label");
+    reportWidgetFootprint<tgui::ListBox>("ListBox");
+    reportWidgetFootprint<tgui::Panel>("Panel");
+    reportWidgetFootprint<tgui::Picture>("Picture");
+    reportWidgetFootprint<tgui::ProgressBar>("ProgressBar");
+    reportWidgetFootprint<tgui::Slider>("Slider");
+    reportWidgetFootprint<tgui::TextBox>("TextBox");
+}
+
+TEST_CASE("[Widget] Rarely used members are only allocated when needed")
+{
+    // Create a widget first, so that one-time allocations (e.g. loading the default font) are not counted
+    auto firstWidget = tgui::ClickableWidget::create();
+    auto toolTip = tgui::Label::create("Tool tip");
+
+    startCountingAllocations();
+    auto widget = tgui::ClickableWidget::create();
+    stopCountingAllocations();
+    const std::size_t allocationsPerWidget = getAllocationCount();
+    const std::size_t bytesPerWidget = getAllocatedBytes();
+
+    SECTION("Every widget allocates the same amount")
+    {
+        std::vector<tgui::ClickableWidget::Ptr> widgets;
+        widgets.reserve(10);
+
+        startCountingAllocations();
+        for (unsigned int i = 0; i < 10; ++i)
+            widgets.push_back(tgui::ClickableWidget::create());
+        stopCountingAllocations();
+
+        REQUIRE(getAllocationCount() == 10 * allocationsPerWidget);
+        REQUIRE(getAllocatedBytes() == 10 * bytesPerWidget);
+    }
+
+    SECTION("Reading the members doesn't allocate them")
+    {
+        startCountingAllocations();
+        widget->setToolTip(nullptr);
+        const bool hasToolTip = (widget->getToolTip() != nullptr);
+        const bool animating = widget->isAnimationPlaying();
+        stopCountingAllocations();
+
+        REQUIRE(!hasToolTip);
+        REQUIRE(!animating);
+        REQUIRE(getAllocationCount() == 0);
+    }
+
+    SECTION("Setting a tool tip allocates the rarely used members")
+    {
+        startCountingAllocations();
+        auto widgetWithToolTip = tgui::ClickableWidget::create();
+        widgetWithToolTip->setToolTip(toolTip);
+        stopCountingAllocations();
+
+        REQUIRE(widgetWithToolTip->getToolTip() == toolTip);
+        REQUIRE(getAllocationCount() > allocationsPerWidget);
+        REQUIRE(getAllocatedBytes() > bytesPerWidget);
+    }
+}
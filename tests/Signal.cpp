@@ -143,4 +143,19 @@ TEST_CASE("[Signal]")
         widget->setSize(400, 100);
         REQUIRE(i == 4);
     }
+
+    SECTION("isConnected")
+    {
+        REQUIRE(!widget->onPositionChange.isConnected());
+
+        const unsigned int id = widget->onPositionChange.connect([]{});
+        REQUIRE(widget->onPositionChange.isConnected());
+
+        widget->onPositionChange.setEnabled(false);
+        REQUIRE(!widget->onPositionChange.isConnected());
+        widget->onPositionChange.setEnabled(true);
+
+        widget->onPositionChange.disconnect(id);
+        REQUIRE(!widget->onPositionChange.isConnected());
+    }
 }
@@ -24,6 +24,70 @@
 
 #include "Tests.hpp"
 #include <TGUI/String.hpp>
+#include <TGUI/to_string.hpp>
+#include <clocale>
+#include <limits>
+#include <cmath>
+#include <vector>
+
+#if TGUI_COMPILED_WITH_CPP_VER >= 17
+    #include <charconv>
+#endif
+
+namespace
+{
+    // The way strToInt, strToUInt and strToFloat parsed numbers before they had their own parser.
+    // Returns the amount of characters that were part of the number, or 0 when the string was rejected.
+#if TGUI_COMPILED_WITH_CPP_VER >= 17
+    template <typename T>
+    std::size_t parseNumberLikeBefore(const std::string& str, T& value)
+    {
+        const auto result = std::from_chars(str.data(), str.data() + str.length(), value);
+        return (result.ec == std::errc{}) ? static_cast<std::size_t>(result.ptr - str.data()) : 0;
+    }
+#else
+    std::size_t parseNumberLikeBefore(const std::string& str, int& value)
+    {
+        try
+        {
+            std::size_t length;
+            value = std::stoi(str, &length);
+            return length;
+        }
+        catch (const std::exception&)
+        {
+            return 0;
+        }
+    }
+
+    std::size_t parseNumberLikeBefore(const std::string& str, unsigned int& value)
+    {
+        int signedValue;
+        const std::size_t length = parseNumberLikeBefore(str, signedValue);
+        value = static_cast<unsigned int>(signedValue);
+        return length;
+    }
+
+    std::size_t parseNumberLikeBefore(const std::string& str, float& value)
+    {
+        try
+        {
+            std::size_t length;
+            value = std::stof(str, &length);
+            return length;
+        }
+        catch (const std::exception&)
+        {
+            return 0;
+        }
+    }
+#endif
+
+    std::size_t getParsedLength(const std::string& str, const char* numberEnd)
+    {
+        return numberEnd ? static_cast<std::size_t>(numberEnd - str.data()) : 0;
+    }
+}
 
 TEST_CASE("[String]")
 {
@@ -1317,12 +1381,130 @@ TEST_CASE("[String]")
         {
             REQUIRE(tgui::strToInt("123") == 123);
             REQUIRE(tgui::strToInt("text", -5) == -5);
+            REQUIRE(tgui::strToInt("-45") == -45);
+            REQUIRE(tgui::strToInt("12px") == 12);
+            REQUIRE(tgui::strToInt("-2147483648") == -2147483648LL);
+            REQUIRE(tgui::strToInt("2147483648", -1) == -1);
+            REQUIRE(tgui::strToInt("", -2) == -2);
+            REQUIRE(tgui::strToInt("--5", -3) == -3);
+#if TGUI_COMPILED_WITH_CPP_VER >= 17
+            // Just like std::from_chars, whitespace and a plus sign aren't accepted
+            REQUIRE(tgui::strToInt(" 7", -4) == -4);
+            REQUIRE(tgui::strToInt("+7", -4) == -4);
+#else
+            // Just like std::stoi, whitespace and a plus sign are skipped
+            REQUIRE(tgui::strToInt(" 7") == 7);
+            REQUIRE(tgui::strToInt("\v+7") == 7);
+#endif
+        }
+
+        SECTION("strToUInt")
+        {
+            REQUIRE(tgui::strToUInt("123") == 123);
+            REQUIRE(tgui::strToUInt("4294967296", 6) == 6);
+#if TGUI_COMPILED_WITH_CPP_VER >= 17
+            REQUIRE(tgui::strToUInt("4294967295") == 4294967295u);
+            REQUIRE(tgui::strToUInt("-1", 5) == 5);
+#else
+            // Unsigned values were parsed with std::stoi as well
+            REQUIRE(tgui::strToUInt("4294967295", 5) == 5);
+            REQUIRE(tgui::strToUInt("-1") == 4294967295u);
+#endif
         }
 
         SECTION("strToFloat")
         {
             REQUIRE(tgui::strToFloat("0.5") == 0.5f);
             REQUIRE(tgui::strToFloat("text", -3.5f) == -3.5f);
+            REQUIRE(tgui::strToFloat("-2.25") == -2.25f);
+            REQUIRE(tgui::strToFloat("1.5E-2") == 0.015f);
+            REQUIRE(tgui::strToFloat(".75") == 0.75f);
+            REQUIRE(tgui::strToFloat("50%") == 50.f);
+            REQUIRE(tgui::strToFloat("0.1") == 0.1f);
+            REQUIRE(tgui::strToFloat("1e39", 3) == 3);
+            REQUIRE(tgui::strToFloat("1e-50", 3) == 3);
+            REQUIRE(tgui::strToFloat("--5", 3) == 3);
+            REQUIRE(tgui::strToFloat("-inf") == -std::numeric_limits<float>::infinity());
+            REQUIRE(std::isnan(tgui::strToFloat("NaN")));
+#if TGUI_COMPILED_WITH_CPP_VER >= 17
+            REQUIRE(tgui::strToFloat(" +1e2", 3) == 3);
+            REQUIRE(tgui::strToFloat("0x1p3") == 0);
+#else
+            REQUIRE(tgui::strToFloat(" +1e2") == 100.f);
+            REQUIRE(tgui::strToFloat("0x1p3") == 8);
+#endif
+
+            // The global locale doesn't influence the decimal separator
+            const std::string oldLocale = std::setlocale(LC_NUMERIC, nullptr);
+            if (std::setlocale(LC_NUMERIC, "de_DE.UTF-8") || std::setlocale(LC_NUMERIC, "German"))
+            {
+                REQUIRE(tgui::strToFloat("2.5") == 2.5f);
+                std::setlocale(LC_NUMERIC, oldLocale.c_str());
+            }
+        }
+
+        SECTION("Numbers are parsed like before")
+        {
+            const std::vector<std::string> strings = {
+                "", " ", "0", "-0", "5", "00012", " 5", "\t5", "\n5", "\v5", "\f5", "+5", "-5", "--5", "+-5", "-+5", "- 5",
+                "5abc", "abc", "12px", "50%", "1,5", "2147483647", "2147483648", "-2147483648", "-2147483649", "4294967295",
+                "4294967296", "99999999999999999999", "0.5", ".5", "5.", ".", "-.5", "1e5", "1E-2", "1e", "1e+", "1e-", "5em",
+                "1.5e-2", "0x1A", "0x1p3", "0x", "0x.", "0X.8", "0x1.8p-1", "inf", "-inf", "INF", "Infinity", "infinit", "nan",
+                "NaN", "-nan", "nan(123)", "nan(", "nan(a b)", "3.4028235e38", "3.4028236e38", "1e39", "-1e39", "1.17549435e-38",
+                "1e-40", "1e-50", "0e-50", "1e50000000000", "1e-50000000000", "0.1", "123456789012345678901234567890",
+                "0.000000000000000000000000000001", "3.14159265358979", "-0.0001"
+            };
+
+            for (const auto& text : strings)
+            {
+                INFO("Parsing '" << text << "'");
+
+                int intValue = 0;
+                int expectedIntValue = 0;
+                const std::size_t intLength = getParsedLength(text, tgui::priv::parseInt(text.data(), text.data() + text.length(), intValue));
+                REQUIRE(intLength == parseNumberLikeBefore(text, expectedIntValue));
+                if (intLength > 0)
+                    REQUIRE(intValue == expectedIntValue);
+
+                unsigned int uintValue = 0;
+                unsigned int expectedUIntValue = 0;
+                const std::size_t uintLength = getParsedLength(text, tgui::priv::parseUInt(text.data(), text.data() + text.length(), uintValue));
+                REQUIRE(uintLength == parseNumberLikeBefore(text, expectedUIntValue));
+                if (uintLength > 0)
+                    REQUIRE(uintValue == expectedUIntValue);
+
+                float floatValue = 0;
+                float expectedFloatValue = 0;
+                const std::size_t floatLength = getParsedLength(text, tgui::priv::parseFloat(text.data(), text.data() + text.length(), floatValue));
+                REQUIRE(floatLength == parseNumberLikeBefore(text, expectedFloatValue));
+                if ((floatLength > 0) && !std::isnan(expectedFloatValue))
+                    REQUIRE(floatValue == expectedFloatValue);
+                else if (floatLength > 0)
+                    REQUIRE(std::isnan(floatValue));
+            }
+        }
+
+        SECTION("to_string")
+        {
+            REQUIRE(tgui::to_string(0) == "0");
+            REQUIRE(tgui::to_string(-42) == "-42");
+            REQUIRE(tgui::to_string(123456789u) == "123456789");
+            REQUIRE(tgui::to_string(std::numeric_limits<long long>::min()) == "-9223372036854775808");
+            REQUIRE(tgui::to_string(std::numeric_limits<unsigned long long>::max()) == "18446744073709551615");
+            REQUIRE(tgui::to_string(2.5f) == "2.5");
+            REQUIRE(tgui::to_string(-0.125) == "-0.125");
+            REQUIRE(tgui::to_string(1234567.f) == "1.23457e+06");
+            REQUIRE(tgui::to_string(0.37f) == "0.37");
+            REQUIRE(tgui::to_string(true) == "1");
+            REQUIRE(tgui::to_string('x') == "x");
+
+            // The global locale doesn't influence the decimal separator
+            const std::string oldLocale = std::setlocale(LC_NUMERIC, nullptr);
+            if (std::setlocale(LC_NUMERIC, "de_DE.UTF-8") || std::setlocale(LC_NUMERIC, "German"))
+            {
+                REQUIRE(tgui::to_string(2.5f) == "2.5");
+                std::setlocale(LC_NUMERIC, oldLocale.c_str());
+            }
         }
 
         SECTION("toLower")
@@ -24,6 +24,8 @@
 
 #include "Tests.hpp"
 #include <TGUI/Text.hpp>
+#include <cmath>
+#include <limits>
 
 TEST_CASE("[Text]")
 {
@@ -135,4 +137,73 @@ TEST_CASE("[Text]")
             REQUIRE(text.getSize().y == text3.getSize().y);
         }
     }
+
+    SECTION("Character positions")
+    {
+        text.setFont("resources/DejaVuSans.ttf");
+        text.setCharacterSize(20);
+        text.setString("Ab c\n\tdef");
+
+        // The positions have to match with the ones of sf::Text, which was used to draw the text before
+        const sf::Text sfText{text.getString(), *text.getFont().getFont(), text.getCharacterSize()};
+        for (std::size_t i = 0; i <= text.getString().getSize() + 1; ++i)
+            REQUIRE(text.findCharacterPos(i) == tgui::Vector2f{sfText.findCharacterPos(i)});
+    }
+
+    SECTION("Word-wrap")
+    {
+        const tgui::Font font{"resources/DejaVuSans.ttf"};
+        const sf::String string = "Lorem ipsum dolor sit amet, consectetur adipiscing elit.\nSed do eiusmod tempor incididunt ut labore.";
+
+        REQUIRE(tgui::Text::wordWrap(0, string, font, 16, false) == string);
+
+        float minimumWidth;
+        float maximumWidth;
+        const sf::String wrapped = tgui::Text::wordWrap(150, string, font, 16, false, true, minimumWidth, maximumWidth);
+        REQUIRE(wrapped == tgui::Text::wordWrap(150, string, font, 16, false));
+        REQUIRE(wrapped != string);
+        REQUIRE(minimumWidth <= 150);
+        REQUIRE(maximumWidth > 150);
+
+        // The result is the same for every width inside the returned range
+        REQUIRE(tgui::Text::wordWrap(minimumWidth, string, font, 16, false) == wrapped);
+        REQUIRE(tgui::Text::wordWrap((minimumWidth + maximumWidth) / 2.f, string, font, 16, false) == wrapped);
+        REQUIRE(tgui::Text::wordWrap(std::nextafter(maximumWidth, 0.f), string, font, 16, false) == wrapped);
+
+        // Text that fits on a single line keeps the same result for any larger width
+        tgui::Text::wordWrap(1000, "Short", font, 16, false, true, minimumWidth, maximumWidth);
+        REQUIRE(minimumWidth > 0);
+        REQUIRE(minimumWidth < 1000);
+        REQUIRE(maximumWidth == std::numeric_limits<float>::infinity());
+    }
+}
+
+TEST_CASE("[Text] Changing colors of many texts", "[.benchmark]")
+{
+    sf::RenderTexture target;
+    target.create(200, 1000);
+
+    std::vector<tgui::Text> texts(1000);
+    for (std::size_t i = 0; i < texts.size(); ++i)
+    {
+        texts[i].setFont("resources/DejaVuSans.ttf");
+        texts[i].setCharacterSize(12);
+        texts[i].setString("List item " + tgui::to_string(i));
+        texts[i].setPosition(0, static_cast<float>(i));
+        texts[i].draw(target, {});
+    }
+
+    // Simulates hovering over list items, which only changes the colors of the texts
+    sf::Clock clock;
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+        for (auto& text : texts)
+        {
+            text.setColor((i % 2) ? sf::Color::Red : sf::Color::Blue);
+            text.setOpacity((i % 2) ? 1.f : 0.5f);
+            text.draw(target, {});
+        }
+    }
+
+    WARN("Changing colors of 1000 texts 100 times took " << clock.getElapsedTime().asMilliseconds() << "ms");
 }
@@ -0,0 +1,229 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/TextBuffer.hpp>
+
+TEST_CASE("[TextBuffer]")
+{
+    tgui::TextBuffer buffer;
+    REQUIRE(buffer.isEmpty());
+    REQUIRE(buffer.getSize() == 0);
+    REQUIRE(buffer.getText() == "");
+    REQUIRE(buffer.getLineCount() == 1);
+    REQUIRE(buffer.getLineLength(0) == 0);
+
+    SECTION("Set text")
+    {
+        buffer.setText("Hello\nWorld");
+        REQUIRE(!buffer.isEmpty());
+        REQUIRE(buffer.getSize() == 11);
+        REQUIRE(buffer.getText() == "Hello\nWorld");
+        REQUIRE(buffer.getSubstring(3, 5) == "lo\nWo");
+        REQUIRE(buffer.getSubstring(8) == "rld");
+        REQUIRE(buffer.getSubstring(20) == "");
+        REQUIRE(buffer.getCharacter(6) == 'W');
+        REQUIRE(buffer.getPieceCount() == 1);
+
+        buffer.setText("");
+        REQUIRE(buffer.isEmpty());
+        REQUIRE(buffer.getPieceCount() == 0);
+
+        REQUIRE(tgui::TextBuffer("Text").getText() == "Text");
+    }
+
+    SECTION("Insert and erase")
+    {
+        buffer.setText("Hello World");
+
+        buffer.insert(5, ",");
+        REQUIRE(buffer.getText() == "Hello, World");
+
+        buffer.insert(0, ">> ");
+        buffer.insert(buffer.getSize(), "!");
+        REQUIRE(buffer.getText() == ">> Hello, World!");
+        REQUIRE(buffer.getSize() == 16);
+
+        buffer.erase(0, 3);
+        REQUIRE(buffer.getText() == "Hello, World!");
+
+        buffer.erase(4, 5);
+        REQUIRE(buffer.getText() == "Hellorld!");
+
+        buffer.erase(8, 10);
+        REQUIRE(buffer.getText() == "Hellorld");
+
+        buffer.erase(20, 1);
+        buffer.insert(20, "?");
+        REQUIRE(buffer.getText() == "Hellorld?");
+
+        buffer.erase(0, buffer.getSize());
+        REQUIRE(buffer.isEmpty());
+        REQUIRE(buffer.getLineCount() == 1);
+    }
+
+    SECTION("Typed characters are added to the same piece")
+    {
+        buffer.setText("ac");
+        buffer.insert(1, "b");
+        REQUIRE(buffer.getPieceCount() == 3);
+
+        for (std::size_t i = 0; i < 10; ++i)
+            buffer.insert(2 + i, "x");
+
+        REQUIRE(buffer.getText() == "abxxxxxxxxxxc");
+        REQUIRE(buffer.getPieceCount() == 3);
+    }
+
+    SECTION("Lines")
+    {
+        buffer.setText("First\n\nThird line");
+        REQUIRE(buffer.getLineCount() == 3);
+        REQUIRE(buffer.getLineStart(0) == 0);
+        REQUIRE(buffer.getLineStart(1) == 6);
+        REQUIRE(buffer.getLineStart(2) == 7);
+        REQUIRE(buffer.getLineLength(0) == 5);
+        REQUIRE(buffer.getLineLength(1) == 0);
+        REQUIRE(buffer.getLineLength(2) == 10);
+
+        REQUIRE(buffer.getLineOfPosition(0) == 0);
+        REQUIRE(buffer.getLineOfPosition(5) == 0);
+        REQUIRE(buffer.getLineOfPosition(6) == 1);
+        REQUIRE(buffer.getLineOfPosition(7) == 2);
+        REQUIRE(buffer.getLineOfPosition(17) == 2);
+
+        buffer.insert(2, "\n");
+        buffer.insert(buffer.getSize(), "\n");
+        buffer.erase(7, 1);
+        REQUIRE(buffer.getText() == "Fi\nrst\nThird line\n");
+        REQUIRE(buffer.getLineCount() == 4);
+        REQUIRE(buffer.getLineStart(1) == 3);
+        REQUIRE(buffer.getLineStart(2) == 7);
+        REQUIRE(buffer.getLineStart(3) == 18);
+        REQUIRE(buffer.getLineLength(2) == 10);
+        REQUIRE(buffer.getLineLength(3) == 0);
+        REQUIRE(buffer.getLineOfPosition(18) == 3);
+    }
+
+    SECTION("Random edits")
+    {
+        // Compare the buffer with the same edits made on a normal string
+        sf::String expected = "Some text\nthat is\n\nedited";
+        buffer.setText(expected);
+
+        unsigned int seed = 1;
+        auto random = [&seed](unsigned int max){
+            seed = seed * 1103515245 + 12345;
+            return static_cast<std::size_t>((seed / 65536) % max);
+        };
+
+        for (unsigned int i = 0; i < 500; ++i)
+        {
+            const std::size_t pos = random(static_cast<unsigned int>(expected.getSize() + 1));
+            if (random(3) > 0)
+            {
+                const sf::String str = (random(4) == 0) ? "\n" : "ab";
+                expected.insert(pos, str);
+                buffer.insert(pos, str);
+            }
+            else
+            {
+                const std::size_t count = random(5);
+                if (pos < expected.getSize())
+                    expected.erase(pos, count);
+                buffer.erase(pos, count);
+            }
+
+            REQUIRE(buffer.getSize() == expected.getSize());
+        }
+
+        REQUIRE(buffer.getText() == expected);
+
+        std::size_t lineStart = 0;
+        for (std::size_t line = 0; line < buffer.getLineCount(); ++line)
+        {
+            REQUIRE(buffer.getLineStart(line) == lineStart);
+            REQUIRE(buffer.getLineOfPosition(lineStart) == line);
+
+            const std::size_t newLinePos = expected.find('\n', lineStart);
+            if (newLinePos == sf::String::InvalidPos)
+            {
+                REQUIRE(line + 1 == buffer.getLineCount());
+                REQUIRE(buffer.getLineLength(line) == expected.getSize() - lineStart);
+            }
+            else
+            {
+                REQUIRE(buffer.getLineLength(line) == newLinePos - lineStart);
+                lineStart = newLinePos + 1;
+            }
+        }
+    }
+}
+
+TEST_CASE("[TextBuffer] Editing a 10 MB text", "[.benchmark]")
+{
+    // Lines of 80 characters followed by a newline
+    std::basic_string<sf::Uint32> str(10 * 1024 * 1024, 'a');
+    for (std::size_t i = 80; i < str.size(); i += 81)
+        str[i] = '\n';
+
+    const unsigned int edits = 10000;
+    const sf::String text{str};
+
+    sf::String string = text;
+    sf::Clock clock;
+    for (unsigned int i = 0; i < edits; ++i)
+    {
+        const std::size_t pos = (static_cast<std::size_t>(i) * 7919 * 1031) % string.getSize();
+        if (i % 2)
+            string.insert(pos, "x");
+        else
+            string.erase(pos, 1);
+    }
+    WARN("Making " << edits << " edits in a 10 MB sf::String took " << clock.restart().asMicroseconds() << "us");
+
+    tgui::TextBuffer buffer{text};
+    clock.restart();
+    for (unsigned int i = 0; i < edits; ++i)
+    {
+        const std::size_t pos = (static_cast<std::size_t>(i) * 7919 * 1031) % buffer.getSize();
+        if (i % 2)
+            buffer.insert(pos, "x");
+        else
+            buffer.erase(pos, 1);
+    }
+    WARN("Making " << edits << " edits in a 10 MB TextBuffer took " << clock.restart().asMicroseconds() << "us");
+
+    std::size_t lineStarts = 0;
+    for (unsigned int i = 0; i < edits; ++i)
+        lineStarts += buffer.getLineStart((static_cast<std::size_t>(i) * 7919) % buffer.getLineCount());
+    WARN("Looking up " << edits << " line starts in the TextBuffer took " << clock.restart().asMicroseconds() << "us");
+
+    // Before the piece table, the text box stored the text both as a whole and split in lines
+    WARN("Memory used by the TextBuffer: " << buffer.getMemoryUsage() / 1024 << "KB, "
+         << "the text and its lines as sf::String use " << 2 * text.getSize() * sizeof(sf::Uint32) / 1024 << "KB");
+
+    REQUIRE(buffer.getText() == string);
+    REQUIRE(lineStarts > 0);
+}
@@ -0,0 +1,118 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Tests.hpp"
+#include <TGUI/TextLineList.hpp>
+
+namespace
+{
+    void requireLine(const tgui::TextLineList& list, std::size_t index, std::size_t textLine, std::size_t offset, std::size_t length)
+    {
+        const tgui::TextLineList::Line line = list[index];
+        REQUIRE(line.textLine == textLine);
+        REQUIRE(line.offset == offset);
+        REQUIRE(line.length == length);
+    }
+}
+
+TEST_CASE("[TextLineList]")
+{
+    tgui::TextLineList list;
+    REQUIRE(list.empty());
+    REQUIRE(list.size() == 0);
+    REQUIRE(list.getMaxLength() == 0);
+    REQUIRE(list.getMaxWidth() == 0);
+
+    // Text line 1 is split over two displayed lines
+    list.assign({{0, 0, 5, 50}, {1, 0, 8, 70}, {1, 8, 3, 30}, {2, 0, 0, 0}, {3, 0, 6, 60}});
+    REQUIRE(!list.empty());
+    REQUIRE(list.size() == 5);
+    requireLine(list, 0, 0, 0, 5);
+    requireLine(list, 1, 1, 0, 8);
+    requireLine(list, 2, 1, 8, 3);
+    requireLine(list, 3, 2, 0, 0);
+    requireLine(list, 4, 3, 0, 6);
+    REQUIRE(list[2].width == 30);
+
+    SECTION("Maxima")
+    {
+        REQUIRE(list.getMaxLength() == 8);
+        REQUIRE(list.getMaxWidth() == 70);
+        REQUIRE(list.findLongestLine() == 1);
+    }
+
+    SECTION("Finding lines")
+    {
+        REQUIRE(list.findFirstLine(0) == 0);
+        REQUIRE(list.findFirstLine(1) == 1);
+        REQUIRE(list.findFirstLine(2) == 3);
+        REQUIRE(list.findFirstLine(3) == 4);
+        REQUIRE(list.findFirstLine(4) == 5);
+
+        REQUIRE(list.findLine(1, 0) == 1);
+        REQUIRE(list.findLine(1, 8) == 1);
+        REQUIRE(list.findLine(1, 9) == 2);
+        REQUIRE(list.findLine(1, 12) == 3);
+        REQUIRE(list.findLine(3, 6) == 4);
+        REQUIRE(list.findLine(3, 7) == 5);
+    }
+
+    SECTION("Replacing lines")
+    {
+        // Splitting a line in the text renumbers the lines behind it
+        list.replace(0, 1, {{0, 0, 2, 20}, {1, 0, 3, 30}});
+        REQUIRE(list.size() == 6);
+        requireLine(list, 0, 0, 0, 2);
+        requireLine(list, 1, 1, 0, 3);
+        requireLine(list, 2, 2, 0, 8);
+        requireLine(list, 3, 2, 8, 3);
+        requireLine(list, 5, 4, 0, 6);
+        REQUIRE(list.findFirstLine(4) == 5);
+
+        // Joining the lines in the text of a line that was split over several displayed lines
+        list.replace(2, 6, {{2, 0, 20, 200}});
+        REQUIRE(list.size() == 3);
+        requireLine(list, 2, 2, 0, 20);
+        REQUIRE(list.getMaxLength() == 20);
+        REQUIRE(list.getMaxWidth() == 200);
+        REQUIRE(list.findLongestLine() == 2);
+
+        // Shortening the longest line
+        list.replace(2, 3, {{2, 0, 1, 10}});
+        REQUIRE(list.getMaxLength() == 3);
+        REQUIRE(list.getMaxWidth() == 30);
+        REQUIRE(list.findLongestLine() == 1);
+    }
+
+    SECTION("Clear")
+    {
+        list.clear();
+        REQUIRE(list.empty());
+        REQUIRE(list.findFirstLine(0) == 0);
+        REQUIRE(list.getMaxLength() == 0);
+        REQUIRE(list.findLongestLine() == 0);
+    }
+}
@@ -316,6 +316,42 @@ TEST_CASE("[Widget]")
         // TODO: Other tests with the renderer class (e.g. sharing and copying a renderer when using multiple widgets)
     }
 
+    SECTION("WidgetType")
+    {
+        REQUIRE(widget->getWidgetType() == "ClickableWidget");
+
+        // All widgets of the same type share the same type string
+        auto otherWidget = tgui::ClickableWidget::create();
+        REQUIRE(&otherWidget->getWidgetType() == &widget->getWidgetType());
+    }
+
+    SECTION("UserData")
+    {
+        REQUIRE_THROWS_AS(widget->getUserData<int>(), std::bad_cast);
+
+        widget->setUserData(5);
+        REQUIRE(widget->getUserData<int>() == 5);
+
+        widget->setUserData(std::string("Data"));
+        REQUIRE(widget->getUserData<std::string>() == "Data");
+    }
+
+    SECTION("Copying")
+    {
+        auto toolTip = tgui::Panel::create();
+        widget->setToolTip(toolTip);
+
+        auto copy = tgui::ClickableWidget::copy(std::static_pointer_cast<tgui::ClickableWidget>(widget));
+        REQUIRE(copy->getToolTip() != nullptr);
+        REQUIRE(copy->getToolTip() != toolTip);
+        REQUIRE(copy->getWidgetType() == "ClickableWidget");
+
+        auto otherWidget = tgui::ClickableWidget::create();
+        REQUIRE(otherWidget->getToolTip() == nullptr);
+        *otherWidget = *copy;
+        REQUIRE(otherWidget->getToolTip() != nullptr);
+    }
+
     SECTION("Saving and loading widget from file")
     {
         auto parent = tgui::Panel::create();
@@ -0,0 +1,190 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/WidgetPool.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Label.hpp>
+
+TEST_CASE("[WidgetPool]")
+{
+    tgui::WidgetPool<tgui::Label> pool;
+    REQUIRE(pool.getPooledWidgetCount() == 0);
+    REQUIRE(pool.getMaximumPooledWidgets() == 256);
+
+    SECTION("Recycling")
+    {
+        auto label = pool.create();
+        REQUIRE(label->getWidgetType() == "Label");
+        tgui::Label* address = label.get();
+
+        label = nullptr;
+        REQUIRE(pool.getPooledWidgetCount() == 1);
+
+        label = pool.create();
+        REQUIRE(label.get() == address);
+        REQUIRE(pool.getPooledWidgetCount() == 0);
+    }
+
+    SECTION("Widgets are reset")
+    {
+        tgui::Label::Ptr prototype = tgui::Label::create("Prototype");
+        prototype->setTextSize(20);
+        tgui::WidgetPool<tgui::Label> labelPool{*prototype};
+
+        auto label = labelPool.create();
+        REQUIRE(label->getText() == "Prototype");
+        REQUIRE(label->getTextSize() == 20);
+
+        unsigned int count = 0;
+        label->setText("Changed");
+        label->setPosition(10, 20);
+        label->setUserData(5);
+        label->getRenderer()->setTextColor(sf::Color::Red);
+        label->onDoubleClick.connect([&]{ count++; });
+        label->onSizeChange.connect([&]{ count++; });
+
+        label = nullptr;
+        label = labelPool.create();
+        REQUIRE(label->getText() == "Prototype");
+        REQUIRE(label->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(label->getRenderer()->getTextColor() == prototype->getRenderer()->getTextColor());
+        REQUIRE_THROWS(label->getUserData<int>());
+
+        label->setSize(50, 50);
+        REQUIRE(count == 0);
+    }
+
+    SECTION("Layouts bound to a pooled widget")
+    {
+        auto label = pool.create();
+        label->setPosition(30, 0);
+        label->setSize(20, 10);
+
+        auto button = tgui::Button::create();
+        button->setPosition(tgui::bindRight(label), 5);
+        REQUIRE(button->getPosition() == sf::Vector2f(50, 5));
+
+        // The layout no longer refers to the label once it is back in the pool, not even after the pool destroys it
+        label = nullptr;
+        REQUIRE(button->getPosition() == sf::Vector2f(0, 5));
+
+        pool.clear();
+        button->setPosition(button->getPositionLayout());
+        REQUIRE(button->getPosition() == sf::Vector2f(0, 5));
+
+        label = pool.create();
+        label->setPosition(100, 0);
+        REQUIRE(button->getPosition() == sf::Vector2f(0, 5));
+    }
+
+    SECTION("Widgets can be used in a container")
+    {
+        tgui::Gui gui;
+        auto label = pool.create();
+        gui.add(label, "Pooled");
+        label = nullptr;
+        REQUIRE(pool.getPooledWidgetCount() == 0);
+
+        gui.removeAllWidgets();
+        REQUIRE(pool.getPooledWidgetCount() == 1);
+
+        // The widget no longer has a parent when it is reused
+        label = pool.create();
+        REQUIRE(label->getParent() == nullptr);
+    }
+
+    SECTION("Pool size")
+    {
+        pool.reserve(10);
+        REQUIRE(pool.getPooledWidgetCount() == 10);
+
+        pool.setMaximumPooledWidgets(2);
+        REQUIRE(pool.getPooledWidgetCount() == 2);
+
+        pool.reserve(10);
+        REQUIRE(pool.getPooledWidgetCount() == 2);
+
+        std::vector<tgui::Label::Ptr> labels;
+        for (unsigned int i = 0; i < 5; ++i)
+            labels.push_back(pool.create());
+        REQUIRE(pool.getPooledWidgetCount() == 0);
+
+        labels.clear();
+        REQUIRE(pool.getPooledWidgetCount() == 2);
+
+        pool.clear();
+        REQUIRE(pool.getPooledWidgetCount() == 0);
+    }
+
+    SECTION("Widgets may outlive the pool")
+    {
+        tgui::Button::Ptr button;
+        {
+            tgui::WidgetPool<tgui::Button> buttonPool;
+            button = buttonPool.create();
+        }
+
+        button->setText("Still alive");
+        button = nullptr;
+    }
+}
+
+TEST_CASE("[WidgetPool] Create and destroy widgets", "[.benchmark]")
+{
+    const unsigned int iterations = 10000;
+    const unsigned int widgetsPerIteration = 20;
+
+    std::vector<tgui::Label::Ptr> labels;
+    labels.reserve(widgetsPerIteration);
+
+    sf::Clock clock;
+    for (unsigned int i = 0; i < iterations; ++i)
+    {
+        for (unsigned int j = 0; j < widgetsPerIteration; ++j)
+        {
+            labels.push_back(tgui::Label::create());
+            labels.back()->setText("Label");
+        }
+
+        labels.clear();
+    }
+    WARN("Creating and destroying " << iterations * widgetsPerIteration << " labels with Label::create took " << clock.restart().asMicroseconds() << "us");
+
+    tgui::WidgetPool<tgui::Label> pool;
+    clock.restart();
+    for (unsigned int i = 0; i < iterations; ++i)
+    {
+        for (unsigned int j = 0; j < widgetsPerIteration; ++j)
+        {
+            labels.push_back(pool.create());
+            labels.back()->setText("Label");
+        }
+
+        labels.clear();
+    }
+    WARN("Creating and destroying " << iterations * widgetsPerIteration << " labels with a WidgetPool took " << clock.restart().asMicroseconds() << "us");
+
+    REQUIRE(pool.getPooledWidgetCount() == widgetsPerIteration);
+}
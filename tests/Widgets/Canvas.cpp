@@ -84,6 +84,63 @@ TEST_CASE("[Canvas]")
         REQUIRE(internalRenderTexture == &canvas->getRenderTexture());
     }
 
+    SECTION("Layers")
+    {
+        canvas = tgui::Canvas::create({200, 100});
+        REQUIRE(canvas->getLayerCount() == 1);
+        REQUIRE(!canvas->removeLayer(0));
+
+        REQUIRE(canvas->addLayer() == 1);
+        REQUIRE(canvas->getLayerCount() == 2);
+        REQUIRE(canvas->isLayerVisible(1));
+
+        canvas->setLayerVisible(1, false);
+        REQUIRE(!canvas->isLayerVisible(1));
+        REQUIRE(!canvas->isLayerVisible(5));
+
+        std::vector<sf::Vertex> vertices = {
+                {{10, 10}, sf::Color::Red},
+                {{10, 20}, sf::Color::Red},
+                {{20, 10}, sf::Color::Red},
+                {{20, 20}, sf::Color::Red}
+            };
+        REQUIRE(canvas->addGeometryLayer(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip) == 2);
+        REQUIRE(canvas->getLayerCount() == 3);
+
+        // Only geometry layers can be updated and only the first vertex can be used to resize them
+        REQUIRE(canvas->updateGeometry(2, vertices.data(), 2, 2));
+        REQUIRE(!canvas->updateGeometry(2, vertices.data(), 4, 2));
+        REQUIRE(canvas->updateGeometry(2, vertices.data(), 4));
+        REQUIRE(!canvas->updateGeometry(1, vertices.data(), 4));
+
+        // Updating from the first vertex can also shrink the layer
+        REQUIRE(canvas->updateGeometry(2, vertices.data(), 2));
+        REQUIRE(!canvas->updateGeometry(2, vertices.data(), 2, 2));
+        REQUIRE(canvas->updateGeometry(2, vertices.data(), 4));
+        REQUIRE(!canvas->updateGeometry(3, vertices.data(), 4));
+
+        // Layers are kept when the canvas is copied
+        tgui::Canvas::Ptr copy = tgui::Canvas::copy(canvas);
+        REQUIRE(copy->getLayerCount() == 3);
+        REQUIRE(!copy->isLayerVisible(1));
+
+        REQUIRE(canvas->removeLayer(1));
+        REQUIRE(canvas->getLayerCount() == 2);
+        REQUIRE(!canvas->removeLayer(2));
+    }
+
+    SECTION("Partial clear")
+    {
+        canvas = tgui::Canvas::create({200, 100});
+        canvas->setView(sf::View({20, 10, 100, 50}));
+
+        // The view is only changed until the contents are displayed
+        canvas->clear(0, sf::FloatRect{50, 20, 40, 30});
+        REQUIRE(!(canvas->getView() == sf::View({20, 10, 100, 50})));
+        canvas->display();
+        REQUIRE(canvas->getView() == sf::View({20, 10, 100, 50}));
+    }
+
     testWidgetRenderer(canvas->getRenderer());
 
     SECTION("Saving and loading from file")
@@ -125,5 +182,24 @@ TEST_CASE("[Canvas]")
         canvas->display();
 
         TEST_DRAW("Canvas.png")
+
+        SECTION("Layers")
+        {
+            std::vector<sf::Vertex> quad = {
+                    {{120, 20}, sf::Color::Blue},
+                    {{120, 60}, sf::Color::Blue},
+                    {{160, 20}, sf::Color::Blue},
+                    {{160, 60}, sf::Color::Blue}
+                };
+
+            const std::size_t layer = canvas->addLayer();
+            canvas->clear(layer, sf::FloatRect{110, 10, 60, 60}, sf::Color::Green);
+            canvas->draw(layer, quad.data(), quad.size(), sf::PrimitiveType::TrianglesStrip);
+            canvas->display(layer);
+
+            // A hidden layer doesn't change the image
+            canvas->setLayerVisible(layer, false);
+            TEST_DRAW("Canvas.png")
+        }
     }
 }
@@ -351,6 +351,19 @@ TEST_CASE("[ComboBox]")
                 REQUIRE(comboBox->getSelectedItemIndex() == 0);
                 REQUIRE(itemSelectedCount == 3);
 
+                // Merged scroll events move over multiple items, opposite scroll events that were merged do nothing
+                container->mouseWheelScrolled(-2, mousePosOnComboBox);
+                REQUIRE(comboBox->getSelectedItemIndex() == 2);
+                REQUIRE(itemSelectedCount == 4);
+                container->mouseWheelScrolled(-3, mousePosOnComboBox);
+                REQUIRE(comboBox->getSelectedItemIndex() == 2);
+                REQUIRE(itemSelectedCount == 4);
+                container->mouseWheelScrolled(0, mousePosOnComboBox);
+                REQUIRE(comboBox->getSelectedItemIndex() == 2);
+                container->mouseWheelScrolled(5, mousePosOnComboBox);
+                REQUIRE(comboBox->getSelectedItemIndex() == 0);
+                REQUIRE(itemSelectedCount == 5);
+
                 // Changing item by scrolling can be disabled
                 comboBox->setChangeItemOnScroll(false);
                 container->mouseWheelScrolled(-1, mousePosOnComboBox);
@@ -361,7 +374,7 @@ TEST_CASE("[ComboBox]")
                 mouseClick(mousePosOnComboBox);
                 container->mouseWheelScrolled(-1, mousePosOnComboBox);
                 REQUIRE(comboBox->getSelectedItemIndex() == 0);
-                REQUIRE(itemSelectedCount == 3);
+                REQUIRE(itemSelectedCount == 5);
             }
 
             SECTION("Programmatically")
@@ -331,6 +331,34 @@ TEST_CASE("[EditBox]")
             }
         }
 
+        SECTION("Hex")
+        {
+            REQUIRE(editBox->setInputValidator(tgui::EditBox::Validator::Hex));
+            REQUIRE(editBox->getInputValidator() == tgui::EditBox::Validator::Hex);
+            REQUIRE(editBox->getText() == "");
+
+            editBox->setText("7fA0");
+            REQUIRE(editBox->getText() == "7fA0");
+
+            editBox->setText("-5");
+            REQUIRE(editBox->getText() == "");
+
+            editBox->setText("0x10");
+            REQUIRE(editBox->getText() == "");
+
+            SECTION("Adding characters")
+            {
+                editBox->textEntered('c');
+                REQUIRE(editBox->getText() == "c");
+
+                editBox->textEntered('g');
+                REQUIRE(editBox->getText() == "c");
+
+                editBox->textEntered('9');
+                REQUIRE(editBox->getText() == "c9");
+            }
+        }
+
         SECTION("Invalid expressions")
         {
             REQUIRE(editBox->setInputValidator("abc[0-9]xyz"));
@@ -108,6 +108,24 @@ TEST_CASE("[Grid]")
         REQUIRE(grid->getWidgetAlignment(0, 0) == tgui::Grid::Alignment::Center);
     }
 
+    SECTION("Batch update")
+    {
+        auto widget1 = tgui::ClickableWidget::create({40, 30});
+        auto widget2 = tgui::ClickableWidget::create({20, 10});
+
+        grid->beginBatchUpdate();
+        grid->addWidget(widget1, 0, 0);
+        grid->addWidget(widget2, 1, 1);
+        widget2->setSize({60, 20});
+        REQUIRE(grid->getSize() == sf::Vector2f(0, 0));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(0, 0));
+
+        grid->endBatchUpdate();
+        REQUIRE(grid->getSize() == sf::Vector2f(100, 50));
+        REQUIRE(widget1->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(40, 30));
+    }
+
     SECTION("Saving and loading from file")
     {
         grid->setSize({800, 600});
@@ -109,6 +109,57 @@ TEST_CASE("[HorizontalLayout]")
         }
     }
 
+    SECTION("Deferred layout updates")
+    {
+        auto widget1 = tgui::ClickableWidget::create({100, 50});
+        unsigned int sizeChangeCount = 0;
+        widget1->onSizeChange.connect([&]{ sizeChangeCount++; });
+
+        SECTION("Inside a gui")
+        {
+            sf::RenderTexture target;
+            target.create(200, 100);
+            tgui::Gui gui{target};
+            gui.add(layout);
+
+            layout->add(widget1);
+            layout->add(tgui::ClickableWidget::create());
+            layout->add(tgui::ClickableWidget::create());
+            layout->add(tgui::ClickableWidget::create());
+            REQUIRE(sizeChangeCount == 0);
+
+            // The layout is updated once, when the size of a widget is requested
+            REQUIRE(widget1->getSize() == sf::Vector2f(200, 1000));
+            REQUIRE(sizeChangeCount == 1);
+
+            // Drawing the gui also updates the layout
+            layout->add(tgui::ClickableWidget::create());
+            REQUIRE(sizeChangeCount == 1);
+            gui.draw();
+            REQUIRE(sizeChangeCount == 2);
+            REQUIRE(widget1->getSize() == sf::Vector2f(160, 1000));
+        }
+
+        SECTION("Batch update")
+        {
+            {
+                tgui::Container::BatchUpdate batch{layout};
+                layout->add(widget1);
+                layout->add(tgui::ClickableWidget::create());
+                layout->add(tgui::ClickableWidget::create());
+                layout->add(tgui::ClickableWidget::create());
+                REQUIRE(sizeChangeCount == 0);
+            }
+
+            REQUIRE(sizeChangeCount == 1);
+            REQUIRE(widget1->getSize() == sf::Vector2f(200, 1000));
+
+            // Outside a gui and a batch, the layout is updated immediately
+            layout->add(tgui::ClickableWidget::create());
+            REQUIRE(sizeChangeCount == 2);
+        }
+    }
+
     SECTION("Order")
     {
         REQUIRE(layout->get(0) == nullptr);
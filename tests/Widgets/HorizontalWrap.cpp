@@ -94,6 +94,36 @@ TEST_CASE("[HorizontalWrap]")
         REQUIRE(pic8->getPosition() == sf::Vector2f(0, 160));
     }
 
+    SECTION("Batch update")
+    {
+        auto pic1 = tgui::Picture::create("resources/image.png");
+        pic1->setSize({50, 40});
+        auto pic2 = tgui::Picture::copy(pic1);
+        auto pic3 = tgui::Picture::copy(pic1);
+
+        wrap->beginBatchUpdate();
+        wrap->add(pic1);
+        wrap->add(pic2);
+
+        wrap->beginBatchUpdate();
+        wrap->add(pic3);
+        wrap->endBatchUpdate();
+
+        // Widgets aren't repositioned until the outermost batch ends
+        REQUIRE(pic2->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(pic3->getPosition() == sf::Vector2f(0, 0));
+
+        wrap->endBatchUpdate();
+        REQUIRE(pic1->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(pic2->getPosition() == sf::Vector2f(50, 0));
+        REQUIRE(pic3->getPosition() == sf::Vector2f(0, 40));
+
+        // Changes are applied immediately again after the batch
+        wrap->remove(pic1);
+        REQUIRE(pic2->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(pic3->getPosition() == sf::Vector2f(50, 0));
+    }
+
     testWidgetRenderer(wrap->getRenderer());
     SECTION("Renderer")
     {
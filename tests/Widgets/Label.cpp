@@ -152,6 +152,68 @@ TEST_CASE("[Label]")
         REQUIRE(!label->isIgnoringMouseEvents());
     }
 
+    SECTION("Rearranging text")
+    {
+        // Draws a label on its own, to compare labels that reached the same state in different ways
+        auto drawLabel = [](tgui::Label::Ptr labelToDraw){
+            sf::RenderTexture target;
+            target.create(200, 120);
+            tgui::Gui gui{target};
+            gui.add(labelToDraw);
+            target.clear();
+            gui.draw();
+            target.display();
+            gui.remove(labelToDraw);
+            return target.getTexture().copyToImage();
+        };
+
+        auto imagesEqual = [](const sf::Image& image1, const sf::Image& image2){
+            if (image1.getSize() != image2.getSize())
+                return false;
+
+            const std::size_t byteCount = 4 * image1.getSize().x * image1.getSize().y;
+            return std::equal(image1.getPixelsPtr(), image1.getPixelsPtr() + byteCount, image2.getPixelsPtr());
+        };
+
+        auto createLabel = [](){
+            auto newLabel = tgui::Label::create();
+            newLabel->getRenderer()->setFont("resources/DejaVuSans.ttf");
+            newLabel->setScrollbarPolicy(tgui::Scrollbar::Policy::Automatic);
+            newLabel->setTextSize(14);
+            newLabel->setText("Bacon ipsum dolor amet alcatra jerky turkey ball tip jowl beef. Shank landjaeger frankfurter, doner "
+                              "burgdoggen strip steak chicken pancetta jowl. Pork loin leberkas meatloaf ham shoulder cow hamburger "
+                              "pancetta. Rump turducken ribeye salami pork chop sirloin. Leberkas alcatra filet mignon jerky pork belly.");
+            return newLabel;
+        };
+
+        auto resizedLabel = createLabel();
+        for (const float width : {100.f, 180.f, 120.f, 181.f, 100.f, 150.f})
+            resizedLabel->setSize(width, 100);
+
+        auto newLabel = createLabel();
+        newLabel->setSize(150, 100);
+        REQUIRE(imagesEqual(drawLabel(resizedLabel), drawLabel(newLabel)));
+
+        // Lines that only become visible after scrolling are still shown
+        resizedLabel->mouseWheelScrolled(-5, {10, 10});
+        newLabel->mouseWheelScrolled(-5, {10, 10});
+        REQUIRE(imagesEqual(drawLabel(resizedLabel), drawLabel(newLabel)));
+
+        resizedLabel->setHorizontalAlignment(tgui::Label::HorizontalAlignment::Center);
+        resizedLabel->setSize(140, 100);
+        resizedLabel->setSize(150, 100);
+        newLabel->setHorizontalAlignment(tgui::Label::HorizontalAlignment::Center);
+        REQUIRE(imagesEqual(drawLabel(resizedLabel), drawLabel(newLabel)));
+
+        // The cached word-wrap isn't used when the text changes
+        resizedLabel->setText("Short");
+        newLabel = createLabel();
+        newLabel->setSize(150, 100);
+        newLabel->setHorizontalAlignment(tgui::Label::HorizontalAlignment::Center);
+        newLabel->setText("Short");
+        REQUIRE(imagesEqual(drawLabel(resizedLabel), drawLabel(newLabel)));
+    }
+
     SECTION("Events / Signals")
     {
         SECTION("ClickableWidget")
@@ -367,3 +429,42 @@ TEST_CASE("[Label]")
         }
     }
 }
+
+TEST_CASE("[Label] Resizing many labels", "[.benchmark]")
+{
+    sf::RenderTexture target;
+    target.create(1000, 800);
+    tgui::Gui gui{target};
+
+    auto panel = tgui::Panel::create({1000, 800});
+    gui.add(panel);
+
+    // 500 labels in 25 rows, the width of the labels depends on the width of the panel
+    for (unsigned int i = 0; i < 500; ++i)
+    {
+        auto label = tgui::Label::create("Label number " + tgui::to_string(i) + " with a text that has to be word-wrapped");
+        label->getRenderer()->setFont("resources/DejaVuSans.ttf");
+        label->setTextSize(13);
+        label->setPosition({tgui::bindWidth(panel) * ((i % 20) / 20.f), (i / 20) * 32});
+        label->setSize({tgui::bindWidth(panel) / 20.f, 32});
+        panel->add(label);
+    }
+
+    // Simulates dragging the border of the window, the labels get a new width every frame
+    sf::Clock clock;
+    unsigned int frames = 0;
+    for (int width = 1000; width >= 600; width -= 2, ++frames)
+    {
+        panel->setSize({static_cast<float>(width), 800});
+        target.clear();
+        gui.draw();
+    }
+    for (int width = 600; width <= 1000; width += 2, ++frames)
+    {
+        panel->setSize({static_cast<float>(width), 800});
+        target.clear();
+        gui.draw();
+    }
+
+    WARN("Drawing 500 labels while resizing them during " << frames << " frames took " << clock.getElapsedTime().asMilliseconds() << "ms");
+}
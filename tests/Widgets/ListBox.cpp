@@ -255,6 +255,58 @@ TEST_CASE("[ListBox]")
         REQUIRE(!listBox->containsId("1"));
     }
 
+    SECTION("Find item by prefix")
+    {
+        REQUIRE(listBox->findItemByPrefix("B") == -1);
+
+        listBox->addItem("Cherry");
+        listBox->addItem("banana");
+        listBox->addItem("Blueberry");
+        listBox->addItem("Apple");
+        listBox->addItem("Banana split");
+
+        REQUIRE(listBox->findItemByPrefix("") == -1);
+        REQUIRE(listBox->findItemByPrefix("b") == 1);
+        REQUIRE(listBox->findItemByPrefix("bl") == 2);
+        REQUIRE(listBox->findItemByPrefix("BANANA ") == 4);
+        REQUIRE(listBox->findItemByPrefix("banana split!") == -1);
+        REQUIRE(listBox->findItemByPrefix("c") == 0);
+        REQUIRE(listBox->findItemByPrefix("Z") == -1);
+
+        // The index is rebuilt when the items change
+        listBox->changeItemByIndex(0, "Blackberry");
+        REQUIRE(listBox->findItemByPrefix("bla") == 0);
+        REQUIRE(listBox->findItemByPrefix("c") == -1);
+        listBox->removeItemByIndex(0);
+        REQUIRE(listBox->findItemByPrefix("b") == 0);
+        listBox->addItem("Avocado");
+        REQUIRE(listBox->findItemByPrefix("av") == 4);
+    }
+
+    SECTION("Type to search")
+    {
+        listBox->addItem("Apple");
+        listBox->addItem("Banana");
+        listBox->addItem("Blueberry");
+        listBox->addItem("Cherry");
+
+        listBox->textEntered('b');
+        REQUIRE(listBox->getSelectedItemIndex() == 1);
+        listBox->textEntered('l');
+        REQUIRE(listBox->getSelectedItemIndex() == 2);
+
+        // Characters that don't match anything leave the selection unchanged
+        listBox->textEntered('x');
+        REQUIRE(listBox->getSelectedItemIndex() == 2);
+
+        // A new search starts when nothing was typed for a while
+        auto container = tgui::Group::create();
+        container->add(listBox);
+        container->update(sf::milliseconds(2000));
+        listBox->textEntered('c');
+        REQUIRE(listBox->getSelectedItemIndex() == 3);
+    }
+
     SECTION("ItemHeight")
     {
         listBox->setItemHeight(20);
@@ -734,3 +786,30 @@ TEST_CASE("[ListBox]")
         }
     }
 }
+
+TEST_CASE("[ListBox] Many items", "[.benchmark]")
+{
+    const unsigned int itemCount = 100000;
+
+    auto listBox = tgui::ListBox::create();
+    listBox->setSize(200, 300);
+    listBox->setAutoScroll(false);
+
+    sf::Clock clock;
+    for (unsigned int i = 0; i < itemCount; ++i)
+        listBox->addItem("Item " + tgui::to_string(i));
+    WARN("Adding " << itemCount << " items took " << clock.restart().asMicroseconds() << "us");
+
+    sf::RenderTexture target;
+    target.create(200, 300);
+    listBox->setScrollbarValue(listBox->getItemHeight() * itemCount / 2);
+    listBox->draw(target, {});
+    WARN("Drawing the list box with " << itemCount << " items took " << clock.restart().asMicroseconds() << "us");
+
+    REQUIRE(listBox->findItemByPrefix("item 5") == 5);
+    WARN("First search with a prefix took " << clock.restart().asMicroseconds() << "us");
+
+    REQUIRE(listBox->findItemByPrefix("item 9999") == 9999);
+    REQUIRE(listBox->findItemByPrefix("item 99999") == 99999);
+    WARN("Extending the prefix took " << clock.restart().asMicroseconds() << "us");
+}
@@ -209,6 +209,80 @@ TEST_CASE("[ListView]")
         REQUIRE(listView->getItemRows() == std::vector<std::vector<sf::String>>{{"200", "-5", "20"}, {"1000", "7", ""}, {"300", "", ""}});
     }
 
+    SECTION("Sorting and filtering")
+    {
+        listView->addColumn("Name");
+        listView->addColumn("Size");
+        listView->addMultipleItems({{"b", "20"}, {"c", "3"}, {"a", "100"}, {"b", "abc"}, {"d", "3"}});
+
+        auto getDisplayedItems = [&]{
+            std::vector<int> items;
+            for (std::size_t row = 0; row < listView->getDisplayedItemCount(); ++row)
+                items.push_back(listView->getDisplayedItemIndex(row));
+            return items;
+        };
+
+        REQUIRE(listView->getSortColumn() == -1);
+        REQUIRE(listView->getDisplayedItemCount() == 5);
+        REQUIRE(getDisplayedItems() == std::vector<int>{0, 1, 2, 3, 4});
+        REQUIRE(listView->getDisplayedItemIndex(5) == -1);
+
+        // Sorting is stable and doesn't change the item indices
+        listView->sortByColumn(0);
+        REQUIRE(listView->getSortColumn() == 0);
+        REQUIRE(listView->getSortAscending());
+        REQUIRE(getDisplayedItems() == std::vector<int>{2, 0, 3, 1, 4});
+        REQUIRE(listView->getItem(0) == "b");
+
+        listView->sortByColumn(0, false);
+        REQUIRE(!listView->getSortAscending());
+        REQUIRE(getDisplayedItems() == std::vector<int>{4, 1, 0, 3, 2});
+
+        // Numbers are compared by value, texts that aren't numbers are placed at the end
+        REQUIRE(listView->getColumnSortType(1) == tgui::ListView::ColumnSortType::String);
+        listView->sortByColumn(1);
+        REQUIRE(getDisplayedItems() == std::vector<int>{2, 0, 1, 4, 3});
+        listView->setColumnSortType(1, tgui::ListView::ColumnSortType::Numeric);
+        REQUIRE(getDisplayedItems() == std::vector<int>{1, 4, 0, 2, 3});
+
+        listView->setColumnSortComparator(1, [](const sf::String& left, const sf::String& right){ return left.getSize() < right.getSize(); });
+        REQUIRE(listView->getColumnSortType(1) == tgui::ListView::ColumnSortType::Custom);
+        REQUIRE(getDisplayedItems() == std::vector<int>{1, 4, 0, 2, 3});
+
+        // New and changed items are placed at their sorted position
+        listView->sortByColumn(0);
+        listView->addItem({"bb", "1"});
+        REQUIRE(getDisplayedItems() == std::vector<int>{2, 0, 3, 5, 1, 4});
+        listView->changeSubItem(4, 0, "a");
+        REQUIRE(getDisplayedItems() == std::vector<int>{2, 4, 0, 3, 5, 1});
+        listView->removeItem(0);
+        REQUIRE(getDisplayedItems() == std::vector<int>{1, 3, 2, 4, 0});
+
+        // Filtering hides items and deselects them
+        listView->setSelectedItem(1);
+        listView->setFilter([&](std::size_t index){ return listView->getItemCell(index, 0) != "a"; });
+        REQUIRE(listView->getItemCount() == 5);
+        REQUIRE(listView->getDisplayedItemCount() == 3);
+        REQUIRE(getDisplayedItems() == std::vector<int>{2, 4, 0});
+        REQUIRE(listView->getSelectedItemIndex() == -1);
+
+        listView->addItem({"a", "0"});
+        REQUIRE(listView->getDisplayedItemCount() == 3);
+        listView->changeItem(5, {"e", "0"});
+        REQUIRE(getDisplayedItems() == std::vector<int>{2, 4, 0, 5});
+
+        listView->clearSorting();
+        REQUIRE(listView->getSortColumn() == -1);
+        REQUIRE(getDisplayedItems() == std::vector<int>{0, 2, 4, 5});
+
+        listView->setFilter(nullptr);
+        REQUIRE(getDisplayedItems() == std::vector<int>{0, 1, 2, 3, 4, 5});
+
+        listView->sortByColumn(0);
+        listView->removeAllItems();
+        REQUIRE(listView->getDisplayedItemCount() == 0);
+    }
+
     SECTION("Returned item rows depend on columns")
     {
         listView->addItem({"1,1", "1,2", "1,3"});
@@ -421,6 +495,46 @@ TEST_CASE("[ListView]")
         REQUIRE(listView->getAutoScroll());
     }
 
+    SECTION("Batch update")
+    {
+        listView->setSize(200, 100);
+        listView->setItemHeight(20);
+
+        listView->beginBatchUpdate();
+        listView->beginBatchUpdate();
+        for (unsigned int i = 0; i < 20; ++i)
+            listView->addItem(tgui::to_string(20 - i));
+        listView->endBatchUpdate();
+
+        // Scrolling down only happens when the outermost batch ends
+        REQUIRE(listView->getItemCount() == 20);
+        REQUIRE(listView->getVerticalScrollbarValue() == 0);
+        listView->endBatchUpdate();
+        REQUIRE(listView->getVerticalScrollbarValue() > 0);
+
+        // The sorted order is updated once at the end of the batch
+        listView->addColumn("Number");
+        listView->setColumnSortType(0, tgui::ListView::ColumnSortType::Numeric);
+        listView->sortByColumn(0);
+        REQUIRE(listView->getDisplayedItemIndex(0) == 19);
+
+        listView->setSelectedItem(5);
+        listView->beginBatchUpdate();
+        listView->changeSubItem(0, 0, "0");
+        listView->removeItem(19);
+        listView->removeItem(1);
+        listView->addItem("-1");
+        listView->endBatchUpdate();
+
+        REQUIRE(listView->getItemCount() == 19);
+        REQUIRE(listView->getDisplayedItemCount() == 19);
+        REQUIRE(listView->getDisplayedItemIndex(0) == 18);
+        REQUIRE(listView->getDisplayedItemIndex(1) == 0);
+        REQUIRE(listView->getDisplayedItemIndex(2) == 17);
+        REQUIRE(listView->getItem(4) == "15");
+        REQUIRE(listView->getSelectedItemIndex() == 4);
+    }
+
     SECTION("VerticalScrollbarPolicy")
     {
         REQUIRE(listView->getVerticalScrollbarPolicy() == tgui::Scrollbar::Policy::Automatic);
@@ -550,6 +664,35 @@ TEST_CASE("[ListView]")
             }
         }
 
+        SECTION("Dragging over sorted items")
+        {
+            listView->addColumn("Col 1", 50);
+            listView->setHeaderVisible(false);
+            listView->setMultiSelect(true);
+
+            // The rows display the items 2, 1 and 0
+            listView->sortByColumn(0, false);
+            mouseMoved({40, 30});
+            mousePressed({40, 30});
+            mouseMoved({40, 50});
+            mouseReleased({40, 50});
+            REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{2, 1});
+
+            // The changed item moves to the last row, the rows display the items 1, 0 and 2
+            listView->changeItem(2, {"Item 0"});
+            mouseMoved({40, 50});
+            mousePressed({40, 50});
+            mouseMoved({40, 70});
+            mouseReleased({40, 70});
+            REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{0, 2});
+
+            mousePressed({40, 30});
+            mouseMoved({40, 50});
+            mouseMoved({40, 70});
+            mouseReleased({40, 70});
+            REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{1, 0, 2});
+        }
+
         SECTION("Click on header")
         {
             int lastHeaderIndex = -1;
@@ -579,6 +722,35 @@ TEST_CASE("[ListView]")
             REQUIRE(headerClickCount == 2);
         }
 
+        SECTION("Sort on header click")
+        {
+            listView->setHeaderHeight(30);
+            listView->addColumn("Col 1", 50);
+            listView->addColumn("Col 2", 50);
+
+            REQUIRE(!listView->getSortOnHeaderClick());
+            mousePressed({40, 35});
+            mouseReleased({40, 35});
+            REQUIRE(listView->getSortColumn() == -1);
+
+            listView->setSortOnHeaderClick(true);
+            REQUIRE(listView->getSortOnHeaderClick());
+            mousePressed({40, 35});
+            mouseReleased({40, 35});
+            REQUIRE(listView->getSortColumn() == 0);
+            REQUIRE(listView->getSortAscending());
+
+            mousePressed({40, 35});
+            mouseReleased({40, 35});
+            REQUIRE(listView->getSortColumn() == 0);
+            REQUIRE(!listView->getSortAscending());
+
+            // The top row now displays the last item
+            mousePressed({40, 60});
+            mouseReleased({40, 60});
+            REQUIRE(listView->getSelectedItemIndex() == 2);
+        }
+
         SECTION("Right click")
         {
             int lastIndex = -1;
@@ -1096,3 +1268,64 @@ TEST_CASE("[ListView]")
         }
     }
 }
+
+TEST_CASE("[ListView] Sorting many items", "[.benchmark]")
+{
+    const unsigned int itemCount = 1000000;
+
+    std::vector<std::vector<sf::String>> items;
+    items.reserve(itemCount);
+    for (unsigned int i = 0; i < itemCount; ++i)
+        items.push_back({"Item " + tgui::to_string((i * 7919) % itemCount), tgui::to_string((i * 104729) % 1000)});
+
+    auto listView = tgui::ListView::create();
+    listView->addColumn("Name");
+    listView->addColumn("Value");
+    listView->setColumnSortType(1, tgui::ListView::ColumnSortType::Numeric);
+    listView->addMultipleItems(items);
+
+    sf::Clock clock;
+    listView->sortByColumn(0);
+    WARN("Sorting " << itemCount << " items on a text column took " << clock.restart().asMilliseconds() << "ms");
+
+    listView->sortByColumn(1, false);
+    WARN("Sorting " << itemCount << " items on a numeric column took " << clock.restart().asMilliseconds() << "ms");
+
+    listView->setFilter([&](std::size_t index){ return index % 2 == 0; });
+    WARN("Filtering " << itemCount << " items took " << clock.restart().asMilliseconds() << "ms");
+
+    REQUIRE(listView->getDisplayedItemCount() == itemCount / 2);
+}
+
+TEST_CASE("[ListView] Updating many cells", "[.benchmark]")
+{
+    const unsigned int itemCount = 10000;
+    const unsigned int changesPerUpdate = 5000;
+
+    auto listView = tgui::ListView::create();
+    listView->addColumn("Name");
+    listView->addColumn("Value");
+    listView->setColumnSortType(1, tgui::ListView::ColumnSortType::Numeric);
+    for (unsigned int i = 0; i < itemCount; ++i)
+        listView->addItem({"Item " + tgui::to_string(i), tgui::to_string(i)});
+    listView->sortByColumn(1);
+
+    sf::Clock clock;
+    for (unsigned int i = 0; i < changesPerUpdate; ++i)
+        listView->changeSubItem((i * 7919) % itemCount, 1, tgui::to_string((i * 104729) % 1000));
+    WARN("Changing " << changesPerUpdate << " cells in a sorted list view took " << clock.restart().asMilliseconds() << "ms");
+
+    listView->beginBatchUpdate();
+    for (unsigned int i = 0; i < changesPerUpdate; ++i)
+        listView->changeSubItem((i * 7919) % itemCount, 1, tgui::to_string((i * 7) % 1000));
+    listView->endBatchUpdate();
+    WARN("Changing " << changesPerUpdate << " cells in a sorted list view within a batch took " << clock.restart().asMilliseconds() << "ms");
+
+    listView->beginBatchUpdate();
+    for (unsigned int i = 0; i < changesPerUpdate; ++i)
+        listView->removeItem(itemCount - 1 - 2 * i);
+    listView->endBatchUpdate();
+    WARN("Removing " << changesPerUpdate << " items within a batch took " << clock.restart().asMilliseconds() << "ms");
+
+    REQUIRE(listView->getDisplayedItemCount() == itemCount - changesPerUpdate);
+}
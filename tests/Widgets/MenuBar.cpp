@@ -215,6 +215,55 @@ TEST_CASE("[MenuBar]")
             REQUIRE(!menuBar->removeMenuItem({"File", "Other", "Print"}));
             REQUIRE(!menuBar->addMenuItem({"File", "Other", "Extra", "Quit"}, false));
         }
+
+        SECTION("Bulk updates")
+        {
+            REQUIRE(menuBar->addMenuItems({"File", "Recent"}, {"a.txt", "b.txt"}));
+            REQUIRE(menuBar->addMenuItems({"File", "Recent"}, {"c.txt"}));
+            REQUIRE(menuBar->getMenuList().size() == 1);
+            REQUIRE(menuBar->getMenuList()[0].menuItems[0].text == "Recent");
+            REQUIRE(menuBar->getMenuList()[0].menuItems[0].menuItems.size() == 3);
+            REQUIRE(menuBar->getMenuList()[0].menuItems[0].menuItems[2].text == "c.txt");
+
+            REQUIRE(menuBar->setMenuItems({"File", "Recent"}, {"d.txt"}));
+            REQUIRE(menuBar->getMenuList()[0].menuItems[0].menuItems.size() == 1);
+            REQUIRE(menuBar->getMenuList()[0].menuItems[0].menuItems[0].text == "d.txt");
+
+            REQUIRE(menuBar->setMenuItems({"Edit"}, {"Undo", "Redo"}));
+            REQUIRE(menuBar->getMenuList().size() == 2);
+            REQUIRE(menuBar->getMenuList()[1].menuItems.size() == 2);
+
+            REQUIRE(!menuBar->addMenuItems({"View", "Zoom"}, {"In", "Out"}, false));
+            REQUIRE(!menuBar->setMenuItems({}, {"Item"}));
+            REQUIRE(menuBar->getMenuList().size() == 2);
+        }
+
+        SECTION("Large menus")
+        {
+            std::vector<sf::String> items;
+            for (unsigned int i = 0; i < 100; ++i)
+                items.push_back("Item " + tgui::to_string(i));
+            items.push_back("Item 5"); // Duplicate text
+
+            REQUIRE(menuBar->setMenuItems({"Window", "List"}, items));
+            REQUIRE(menuBar->setMenuItemEnabled({"Window", "List", "Item 5"}, false));
+            REQUIRE(!menuBar->getMenuItemEnabled({"Window", "List", "Item 5"}));
+            REQUIRE(menuBar->getMenuList()[0].menuItems[0].menuItems[100].enabled);
+            REQUIRE(menuBar->getMenuItemEnabled({"Window", "List", "Item 99"}));
+            REQUIRE(!menuBar->setMenuItemEnabled({"Window", "List", "Item 100"}, false));
+
+            // Items that are added or removed after a search are found correctly
+            REQUIRE(menuBar->addMenuItem({"Window", "List", "Item 100"}));
+            REQUIRE(menuBar->setMenuItemEnabled({"Window", "List", "Item 100"}, false));
+            REQUIRE(menuBar->removeMenuItem({"Window", "List", "Item 0"}));
+            REQUIRE(menuBar->removeMenuItem({"Window", "List", "Item 5"}));
+            REQUIRE(menuBar->getMenuItemEnabled({"Window", "List", "Item 5"}));
+            REQUIRE(!menuBar->getMenuItemEnabled({"Window", "List", "Item 100"}));
+            REQUIRE(menuBar->getMenuList()[0].menuItems[0].menuItems.size() == 100);
+
+            REQUIRE(menuBar->addMenuItem({"Window", "List", "Item 50", "Sub"}));
+            REQUIRE(menuBar->getMenuList()[0].menuItems[0].menuItems[48].menuItems.size() == 1);
+        }
     }
 
     SECTION("Disabling menus")
@@ -496,3 +545,45 @@ TEST_CASE("[MenuBar]")
         }
     }
 }
+
+TEST_CASE("[MenuBar] Building and rebuilding a large menu", "[.benchmark]")
+{
+    const unsigned int menuCount = 10;
+    const unsigned int subMenuCount = 10;
+    const unsigned int itemCount = 100;
+
+    std::vector<sf::String> items;
+    for (unsigned int i = 0; i < itemCount; ++i)
+        items.push_back("Item " + tgui::to_string(i));
+
+    auto menuBar = tgui::MenuBar::create();
+    sf::Clock clock;
+    for (unsigned int i = 0; i < menuCount; ++i)
+    {
+        for (unsigned int j = 0; j < subMenuCount; ++j)
+        {
+            for (const auto& item : items)
+                menuBar->addMenuItem({"Menu " + tgui::to_string(i), "Sub " + tgui::to_string(j), item});
+        }
+    }
+    WARN("Building a menu with " << menuCount * subMenuCount * itemCount << " items with addMenuItem took " << clock.restart().asMicroseconds() << "us");
+
+    for (unsigned int i = 0; i < menuCount; ++i)
+    {
+        for (unsigned int j = 0; j < subMenuCount; ++j)
+            menuBar->setMenuItems({"Menu " + tgui::to_string(i), "Sub " + tgui::to_string(j)}, items);
+    }
+    WARN("Rebuilding a menu with " << menuCount * subMenuCount * itemCount << " items with setMenuItems took " << clock.restart().asMicroseconds() << "us");
+
+    for (unsigned int i = 0; i < menuCount; ++i)
+    {
+        for (unsigned int j = 0; j < subMenuCount; ++j)
+        {
+            for (const auto& item : items)
+                menuBar->setMenuItemEnabled({"Menu " + tgui::to_string(i), "Sub " + tgui::to_string(j), item}, false);
+        }
+    }
+    WARN("Looking up " << menuCount * subMenuCount * itemCount << " menu items took " << clock.restart().asMicroseconds() << "us");
+
+    REQUIRE(!menuBar->getMenuItemEnabled({"Menu 9", "Sub 9", "Item 99"}));
+}
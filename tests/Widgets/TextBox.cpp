@@ -218,6 +218,75 @@ TEST_CASE("[TextBox]")
         REQUIRE(textBox->getLinesCount() == 4);
     }
 
+    SECTION("Editing only rearranges the changed lines")
+    {
+        // The lines after editing should be the same as when the resulting text was set at once
+        auto requireSameLinesAsNewTextBox = [](tgui::TextBox::Ptr editedTextBox){
+            auto reference = tgui::TextBox::copy(editedTextBox);
+            reference->setText(editedTextBox->getText());
+            REQUIRE(editedTextBox->getLinesCount() == reference->getLinesCount());
+
+            // The width of the longest line determines how far the text can be scrolled
+            editedTextBox->setHorizontalScrollbarValue(100000);
+            reference->setHorizontalScrollbarValue(100000);
+            REQUIRE(editedTextBox->getHorizontalScrollbarValue() == reference->getHorizontalScrollbarValue());
+        };
+
+        textBox->setSize(165, 100);
+        textBox->setTextSize(24);
+
+        SECTION("Word-wrap")
+        {
+            textBox->setText("The quick brown fox\njumps over\n\nthe lazy dog");
+            REQUIRE(textBox->getText() == "The quick brown fox\njumps over\n\nthe lazy dog");
+            requireSameLinesAsNewTextBox(textBox);
+
+            textBox->setCaretPosition(4);
+            for (const char c : std::string("very very "))
+                textBox->textEntered(static_cast<std::uint32_t>(c));
+            REQUIRE(textBox->getText() == "The very very quick brown fox\njumps over\n\nthe lazy dog");
+            REQUIRE(textBox->getCaretPosition() == 14);
+            requireSameLinesAsNewTextBox(textBox);
+
+            textBox->setSelectedText(25, 36);
+            textBox->textEntered('\n');
+            REQUIRE(textBox->getText() == "The very very quick brown\nover\n\nthe lazy dog");
+            REQUIRE(textBox->getCaretPosition() == 26);
+            requireSameLinesAsNewTextBox(textBox);
+
+            textBox->setText(textBox->getText());
+            textBox->setSelectedText(0, textBox->getText().getSize());
+            textBox->textEntered('x');
+            REQUIRE(textBox->getText() == "x");
+            REQUIRE(textBox->getLinesCount() == 1);
+        }
+
+        SECTION("Horizontal scrollbar")
+        {
+            textBox->setHorizontalScrollbarPolicy(tgui::Scrollbar::Policy::Automatic);
+            textBox->setText("Short\nA line that is too long to fit\nShort");
+            REQUIRE(textBox->getLinesCount() == 3);
+
+            textBox->setCaretPosition(13);
+            textBox->textEntered('\n');
+            REQUIRE(textBox->getLinesCount() == 4);
+            REQUIRE(textBox->getCaretPosition() == 14);
+            requireSameLinesAsNewTextBox(textBox);
+
+            textBox->setSelectedText(5, 14);
+            textBox->textEntered(' ');
+            REQUIRE(textBox->getText() == "Short that is too long to fit\nShort");
+            REQUIRE(textBox->getLinesCount() == 2);
+            requireSameLinesAsNewTextBox(textBox);
+
+            // Shortening the longest line
+            textBox->setSelectedText(6, 14);
+            textBox->textEntered('!');
+            REQUIRE(textBox->getText() == "Short !too long to fit\nShort");
+            requireSameLinesAsNewTextBox(textBox);
+        }
+    }
+
     SECTION("Events / Signals")
     {
         textBox->setSize(165, 100);
@@ -449,6 +518,29 @@ TEST_CASE("[TextBox]")
             REQUIRE(textBox->getText() == "ABCDEFGHIJKLMNOPQRSTUVWXYZABC");
         }
 
+        SECTION("Selecting text with the mouse")
+        {
+            sf::String text;
+            for (unsigned int i = 0; i < 100; ++i)
+                text += "Line " + tgui::to_string(i) + "\n";
+
+            textBox->setText(text);
+            textBox->setVerticalScrollbarValue(0);
+
+            textBox->leftMousePressed({3, 3});
+            REQUIRE(textBox->getCaretPosition() == 0);
+
+            textBox->mouseMoved({100, 60});
+            REQUIRE(textBox->getSelectionStart() == 0);
+            REQUIRE(textBox->getSelectionEnd() > 7);
+            REQUIRE(textBox->getSelectedText().substring(0, 7) == "Line 0\n");
+
+            textBox->mouseMoved({3, 3});
+            textBox->leftMouseReleased({3, 3});
+            REQUIRE(textBox->getSelectedText() == "");
+            REQUIRE(textBox->getCaretPosition() == 0);
+        }
+
         // TODO: TextChanged and SelectionChanged events
     }
 
@@ -647,6 +739,36 @@ TEST_CASE("[TextBox]")
                 TEST_DRAW("TextBox_ForcedScrollbars.png")
             }
         }
+
+        SECTION("Partially selected lines")
+        {
+            // When the selected text looks the same as the normal text, the parts in which the lines are drawn have to fit
+            // together without changing a single pixel. The selection boundaries lie next to spaces to avoid kerning.
+            renderer.setOpacity(1);
+            renderer.setSelectedTextColor(sf::Color::Blue);
+            renderer.setSelectedTextBackgroundColor(sf::Color::Yellow);
+            textBox->setFocused(false);
+            textBox->setVerticalScrollbarValue(0);
+
+            auto drawImage = [&]{
+                target.clear({25, 130, 10});
+                gui.draw();
+                target.display();
+                const sf::Image image = target.getTexture().copyToImage();
+                return std::vector<sf::Uint8>(image.getPixelsPtr(), image.getPixelsPtr() + (image.getSize().x * image.getSize().y * 4));
+            };
+
+            const std::size_t selectionStart = textBox->getText().find("ipsum");
+            const std::size_t selectionEnd = textBox->getText().find("donut");
+            textBox->setSelectedText(selectionEnd, selectionEnd);
+            const auto imageWithoutSelection = drawImage();
+
+            textBox->setSelectedText(selectionStart, selectionEnd);
+            REQUIRE(drawImage() == imageWithoutSelection);
+
+            renderer.setSelectedTextColor(sf::Color::Red);
+            REQUIRE(drawImage() != imageWithoutSelection);
+        }
     }
 
     SECTION("Bug Fixes")
@@ -674,3 +796,103 @@ TEST_CASE("[TextBox]")
         }
     }
 }
+
+TEST_CASE("[TextBox] Editing and selecting in a 10 MB text", "[.benchmark]")
+{
+    // Lines of 80 characters followed by a newline
+    std::basic_string<sf::Uint32> str(10 * 1024 * 1024, 'a');
+    for (std::size_t i = 80; i < str.size(); i += 81)
+        str[i] = '\n';
+
+    auto textBox = tgui::TextBox::create();
+    textBox->setSize(400, 300);
+    textBox->setHorizontalScrollbarPolicy(tgui::Scrollbar::Policy::Automatic);
+    textBox->enableMonospacedFontOptimization();
+
+    sf::Clock clock;
+    textBox->setText(sf::String{str});
+    WARN("Setting a 10 MB text took " << clock.restart().asMicroseconds() << "us");
+
+    sf::RenderTexture target;
+    target.create(400, 300);
+    tgui::Gui gui{target};
+    gui.add(textBox);
+    clock.restart();
+
+    textBox->setVerticalScrollbarValue(textBox->getVerticalScrollbarValue() / 2);
+    gui.draw();
+    WARN("Drawing the text box took " << clock.restart().asMicroseconds() << "us");
+
+    const unsigned int edits = 1000;
+    textBox->setCaretPosition(str.size() / 2);
+    for (unsigned int i = 0; i < edits; ++i)
+        textBox->textEntered('x');
+    WARN("Typing " << edits << " characters took " << clock.restart().asMicroseconds() << "us");
+
+    // Drag a selection back and forth over the visible lines and draw the text box after every mouse move
+    const unsigned int mouseMoves = 1000;
+    textBox->leftMousePressed({50, 50});
+    for (unsigned int i = 0; i < mouseMoves; ++i)
+    {
+        textBox->mouseMoved({static_cast<float>(20 + (i * 7) % 300), static_cast<float>(20 + (i * 13) % 240)});
+        gui.draw();
+    }
+    textBox->leftMouseReleased({50, 50});
+    WARN("Moving the mouse " << mouseMoves << " times while selecting took " << clock.restart().asMicroseconds() << "us");
+
+    textBox->setSelectedText(0, str.size());
+    gui.draw();
+    WARN("Selecting and drawing the entire text took " << clock.restart().asMicroseconds() << "us");
+
+    REQUIRE(textBox->getText().getSize() == str.size() + edits);
+}
+
+TEST_CASE("[TextBox] Adding and removing lines in a 10 MB text", "[.benchmark]")
+{
+    // Lines of 80 characters followed by a newline
+    std::basic_string<sf::Uint32> str(10 * 1024 * 1024, 'a');
+    for (std::size_t i = 80; i < str.size(); i += 81)
+        str[i] = '\n';
+
+    auto textBox = tgui::TextBox::create();
+    textBox->getRenderer()->setFont("resources/DejaVuSans.ttf");
+    textBox->setSize(400, 300);
+
+    sf::Event::KeyEvent deleteEvent;
+    deleteEvent.control = false;
+    deleteEvent.alt     = false;
+    deleteEvent.shift   = false;
+    deleteEvent.system  = false;
+    deleteEvent.code    = sf::Keyboard::Key::Delete;
+
+    // Every edit splits a line by adding a newline or joins the lines again by removing it, which changes the index in the
+    // text of all lines behind it
+    const unsigned int edits = 1000;
+    const auto makeEdits = [&]{
+        for (unsigned int i = 0; i < edits; ++i)
+        {
+            const std::size_t pos = (static_cast<std::size_t>(i / 2) * 7919 * 1031) % (str.size() - 1);
+            textBox->setCaretPosition(pos);
+            if (i % 2)
+                textBox->keyPressed(deleteEvent);
+            else
+                textBox->textEntered('\n');
+        }
+    };
+
+    sf::Clock clock;
+    textBox->setText(sf::String{str});
+    WARN("Setting a 10 MB word-wrapped text took " << clock.restart().asMicroseconds() << "us");
+
+    makeEdits();
+    WARN("Making " << edits << " edits that split or join lines with word-wrap took " << clock.restart().asMicroseconds() << "us");
+
+    textBox->setHorizontalScrollbarPolicy(tgui::Scrollbar::Policy::Automatic);
+    textBox->setText(sf::String{str});
+    clock.restart();
+
+    makeEdits();
+    WARN("Making " << edits << " edits that split or join lines with a horizontal scrollbar took " << clock.restart().asMicroseconds() << "us");
+
+    REQUIRE(textBox->getText().getSize() == str.size());
+}
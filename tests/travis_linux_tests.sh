@@ -25,4 +25,5 @@ CXXFLAGS="-fprofile-arcs -ftest-coverage -DTGUI_SKIP_DRAW_TESTS -DTGUI_REMOVE_DE
 make -j2
 cd tests/
 ./tests
+./tests-memory
 cd ../..